@@ -24,6 +24,7 @@
                                           //         or use PROFILER for VT100 task profiler.
 #define DEBUG_SERVO                   OFF //    OFF, n. Where n=1 to 9 as the designated axis for logging servo activity.     Option
 #define DEBUG_ECHO_COMMANDS           ON //    OFF, Use ON or ERRORS_ONLY to log commands to the debug serial port.          Option
+#define DEBUG_COMMAND_LATENCY        OFF //    OFF, Use ON to keep command latency histograms per channel, read with :GY#.   Option
 #define SERIAL_DEBUG               Serial // Serial, Use any available h/w serial port. Serial1 or Serial2, etc.              Option
 #define SERIAL_DEBUG_BAUD          230400 // 230400, n. Where n=9600,19200,57600,115200,230400,460800 (common baud rates.)    Option
 
@@ -34,6 +34,9 @@
 #ifndef DEBUG_ECHO_COMMANDS
 #define DEBUG_ECHO_COMMANDS           OFF
 #endif
+#ifndef DEBUG_COMMAND_LATENCY
+#define DEBUG_COMMAND_LATENCY         OFF
+#endif
 #ifndef SERIAL_DEBUG
 #define SERIAL_DEBUG                  Serial
 #endif
@@ -2253,6 +2256,42 @@
   #ifndef ODRIVE_UPDATE_MS
   #define ODRIVE_UPDATE_MS              100                       // 10 HZ update rate
   #endif
+  #ifndef ODRIVE_CAN_ENCODER_MS
+  #define ODRIVE_CAN_ENCODER_MS         10                        // encoder estimates (position, velocity) kept this fresh in ms
+  #endif                                                          // over CAN, 0 requests them on demand instead
+  #ifndef ODRIVE_CAN_IQ_MS
+  #define ODRIVE_CAN_IQ_MS              100                       // Iq setpoint and measured, as above
+  #endif
+  #ifndef ODRIVE_CAN_VBUS_MS
+  #define ODRIVE_CAN_VBUS_MS            1000                      // bus voltage, as above (heartbeats are always cyclic)
+  #endif
+  #ifndef ODRIVE_CAN_ERRORS_MS
+  #define ODRIVE_CAN_ERRORS_MS          500                       // motor and encoder errors, as above
+  #endif
+  #ifndef ODRIVE_RECORD_MS
+  #define ODRIVE_RECORD_MS              5                         // encoder estimates requested this often in ms while the CAN
+  #endif                                                          // telemetry recorder runs (:SQR1#), every frame is recorded
+  #ifndef ODRIVE_TORQUE_CONSTANT
+  #define ODRIVE_TORQUE_CONSTANT        0.2                       // Nm/A, the ODrive's motor.config.torque_constant (8.27/KV),
+  #endif                                                          // the CAN tuning assistant's gains are in Nm like the ODrive's
+  #ifndef ODRIVE_TUNE_BW_HZ
+  #define ODRIVE_TUNE_BW_HZ             4                         // velocity loop bandwidth the tuning assistant proposes gains for
+  #endif
+  #ifndef ODRIVE_TUNE_STEP
+  #define ODRIVE_TUNE_STEP              0.001                     // tuning assistant step in turns, the chirp is a quarter of it
+  #endif
+  #ifndef ODRIVE_FOLLOW_AZM_OVERLOAD
+  #define ODRIVE_FOLLOW_AZM_OVERLOAD    2600                      // arc-seconds, following error RMS over 1 s that warns of an
+  #endif                                                          // overloaded AZM motor (unbalanced, dragging, wind)
+  #ifndef ODRIVE_FOLLOW_ALT_OVERLOAD
+  #define ODRIVE_FOLLOW_ALT_OVERLOAD    6500                      // arc-seconds, as above for the ALT motor
+  #endif
+  #ifndef ODRIVE_FOLLOW_STALL
+  #define ODRIVE_FOLLOW_STALL           39000                     // arc-seconds, a following error this large is a stall if the
+  #endif                                                          // motor isn't moving, a runaway if it's moving away
+  #ifndef ODRIVE_STREAM_HZ
+  #define ODRIVE_STREAM_HZ              OFF                       // OFF or 20 to 100 Hz, streams position with velocity feedforward
+  #endif                                                          // over CAN instead of the ODRIVE_UPDATE_MS updates
   #ifndef ODRIVE_SWAP_AXES
   #define ODRIVE_SWAP_AXES              ON                        // ODrive axis 0 = OnStep Axis2 = DEC or ALT
   #endif                                                          // ODrive axis 1 = OnStep Axis1 = RA or AZM
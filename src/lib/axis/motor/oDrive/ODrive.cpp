@@ -17,8 +17,20 @@ IRAM_ATTR void moveODriveMotorAxis2() { odriveMotorInstance[1]->move(); }
 // ODrive servo motor driver object pointer
 #if ODRIVE_COMM_MODE == OD_UART
   ODriveArduino *_oDriveDriver;
+  __attribute__ ((weak)) void odriveSerialDrain() { }
 #elif ODRIVE_COMM_MODE == OD_CAN
   ODriveTeensyCAN *_oDriveDriver;
+  volatile uint8_t odriveHeld = 0;
+
+  // keeps the subscribed ODrive values fresh
+  uint8_t odriveCanHandle = 0;
+  void odriveCanPoll() { _oDriveDriver->poll(); }
+
+  #if ODRIVE_STREAM_HZ != OFF
+    // one task streams both axes
+    uint8_t odriveStreamHandle = 0;
+    void odriveStream() { for (int i = 0; i < 2; i++) if (odriveMotorInstance[i] != NULL) odriveMotorInstance[i]->stream(); }
+  #endif
 #endif
 
 // constructor
@@ -69,6 +81,27 @@ bool ODriveMotor::init() {
     #elif ODRIVE_COMM_MODE == OD_CAN
       // .begin is done by the constructor
       VF("MSG:"); V(axisPrefix); VLF("CAN channel init");
+
+      if (!odriveCanHandle) {
+        _oDriveDriver->subscribe(ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, ODRIVE_CAN_ENCODER_MS);
+        _oDriveDriver->subscribe(ODriveTeensyCAN::CMD_ID_GET_IQ, ODRIVE_CAN_IQ_MS);
+        _oDriveDriver->subscribe(ODriveTeensyCAN::CMD_ID_GET_VBUS_VOLTAGE_CURRENT, ODRIVE_CAN_VBUS_MS);
+        _oDriveDriver->subscribe(ODriveTeensyCAN::CMD_ID_GET_MOTOR_ERROR, ODRIVE_CAN_ERRORS_MS);
+        _oDriveDriver->subscribe(ODriveTeensyCAN::CMD_ID_GET_ENCODER_ERROR, ODRIVE_CAN_ERRORS_MS);
+
+        VF("MSG:"); V(axisPrefix); VF("start CAN telemetry task (rate 1 ms priority 3)... ");
+        odriveCanHandle = tasks.add(1, 0, true, 3, odriveCanPoll, "ODrvCan");
+        if (odriveCanHandle) { VLF("success"); } else { VLF("FAILED!"); }
+      }
+
+      #if ODRIVE_STREAM_HZ != OFF
+        if (!odriveStreamHandle) {
+          VF("MSG:"); V(axisPrefix); VF("start CAN position stream task (rate " STR(ODRIVE_STREAM_HZ) " Hz priority 1)... ");
+          odriveStreamHandle = tasks.add(0, 0, true, 1, odriveStream, "ODrvStr");
+          if (odriveStreamHandle) { VLF("success"); } else { VLF("FAILED!"); }
+          tasks.setPeriodMicros(odriveStreamHandle, 1000000UL/ODRIVE_STREAM_HZ);
+        }
+      #endif
     #endif
   //}
 
@@ -177,9 +210,17 @@ void ODriveMotor::resetPositionSteps(long value) {
 
   // get ODrive position in fractionial Turns
   #if ODRIVE_COMM_MODE == OD_UART
+    odriveSerialDrain(); // the blocking read below must get its own reply
     oPosition = _oDriveDriver->getPosition(axisNumber - 1)*TWO_PI*stepsPerMeasure; // axis1/2 are in steps per radian
   #elif ODRIVE_COMM_MODE == OD_CAN
-    oPosition = _oDriveDriver->GetPosition(axisNumber - 1)*TWO_PI*stepsPerMeasure; // axis1/2 are in steps per radian
+    // getters give the latest value without waiting, this needs a fresh one
+    byte estimates[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    if (!_oDriveDriver->fetch(axisNumber - 1, ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, estimates, 50)) {
+      VF("MSG:"); V(axisPrefix); VLF("ODrive position request timed out");
+    }
+    float turns;
+    memcpy(&turns, estimates, sizeof(turns));
+    oPosition = turns*TWO_PI*stepsPerMeasure; // axis1/2 are in steps per radian
   #endif
 
   noInterrupts();
@@ -260,6 +301,13 @@ void ODriveMotor::setSlewing(bool state) {
 
 // updates PID and sets odrive position
 void ODriveMotor::poll() {
+  #if ODRIVE_COMM_MODE == OD_CAN
+    #if ODRIVE_STREAM_HZ != OFF
+      return; // stream() does this
+    #endif
+    if (odriveHeld & (1 << (axisNumber - 1))) return;
+  #endif
+
   if ((long)(millis() - lastSetPositionTime) < ODRIVE_UPDATE_MS) return;
   lastSetPositionTime = millis();
 
@@ -277,6 +325,43 @@ void ODriveMotor::poll() {
   #endif
 }
 
+#if ODRIVE_COMM_MODE == OD_CAN && ODRIVE_STREAM_HZ != OFF
+// sends position with velocity feedforward, backs off while the CAN bus is saturated
+void ODriveMotor::stream() {
+  if (!ready || (odriveHeld & (1 << (axisNumber - 1)))) return;
+  if (++streamTick < streamDivider) return;
+  streamTick = 0;
+
+  noInterrupts();
+  #if ODRIVE_SLEW_DIRECT == ON
+    long target = targetSteps + backlashSteps;
+  #else
+    long target = motorSteps + backlashSteps;
+  #endif
+  long stepNow = step;
+  unsigned long period = lastPeriod;
+  interrupts();
+
+  // in turns and turns per second
+  float stepsPerTurn = TWO_PI*stepsPerMeasure;
+  float velocity = 0.0F;
+  if (period != 0) velocity = (16000000.0F/period)*stepNow/stepsPerTurn;
+
+  // at rest the position only needs the occasional refresh
+  if (target == lastStreamTarget && velocity == 0.0F && (long)(millis() - lastSetPositionTime) < ODRIVE_UPDATE_MS) return;
+
+  if (_oDriveDriver->SetPosition(axisNumber - 1, target/stepsPerTurn, velocity)) {
+    lastStreamTarget = target;
+    lastSetPositionTime = millis();
+    // one step back toward the full rate after each second without a failed send
+    if (streamDivider > 1 && (long)(millis() - streamSlowTime) >= 1000) { streamDivider /= 2; streamSlowTime = millis(); }
+  } else {
+    if (streamDivider < 8) { streamDivider *= 2; VF("MSG:"); V(axisPrefix); VF("CAN bus busy, stream rate divided by "); VL(streamDivider); }
+    streamSlowTime = millis();
+  }
+}
+#endif
+
 // sets dir as required and moves coord toward target at setFrequencySteps() rate
 IRAM_ATTR void ODriveMotor::move() {
   if (sync && !inBacklash) targetSteps += step;
@@ -25,6 +25,11 @@
   #define ODRIVE_UPDATE_MS   3000
 #endif
 
+// odrive streaming, the default is in Config.defaults.h
+#if ODRIVE_STREAM_HZ != OFF && (ODRIVE_STREAM_HZ < 20 || ODRIVE_STREAM_HZ > 100)
+  #error "Configuration (Config.h): ODRIVE_STREAM_HZ must be OFF or 20 to 100"
+#endif
+
 // odrive direct slewing ON or OFF (ODrive handles acceleration)
 #ifndef ODRIVE_SLEW_DIRECT
   #define ODRIVE_SLEW_DIRECT OFF
@@ -46,11 +51,17 @@
   #include <ODriveArduino.h> // https://github.com/odriverobotics/ODrive/tree/master/Arduino/ODriveArduino 
   // ODrive servo motor serial driver
   extern ODriveArduino *_oDriveDriver;
+  // waits until no reads are in flight on ODRIVE_SERIAL, a plugin that pipelines reads
+  // (DDScope's ODriveUart) provides it, by default there are none
+  void odriveSerialDrain();
 #elif ODRIVE_COMM_MODE == OD_CAN
   #include <FlexCAN_T4.h> // https://github.com/tonton81/FlexCAN_T4.git
   // changes were required to this CAN library so it is local now
   #include "src/plugins/DDScope/ODriveTeensyCAN/ODriveTeensyCAN.h" //https://github.com/Malaphor/ODriveTeensyCAN.git
   extern ODriveTeensyCAN *_oDriveDriver;
+  // ODrive axes (bit n for axis n) whose setpoints come from elsewhere for now (tuning),
+  // poll() and stream() send nothing to them
+  extern volatile uint8_t odriveHeld;
 #endif
 
 typedef struct ODriveDriverSettings {
@@ -108,6 +119,11 @@ class ODriveMotor : public Motor {
     // sets dir as required and moves coord toward target at setFrequencySteps() rate
     void move();
 
+    #if ODRIVE_COMM_MODE == OD_CAN && ODRIVE_STREAM_HZ != OFF
+    // sends the position with velocity feedforward, at ODRIVE_STREAM_HZ
+    void stream();
+    #endif
+
   private:
 
 //  float o_position0 = 0;
@@ -126,6 +142,12 @@ class ODriveMotor : public Motor {
     #endif
 
     unsigned long lastSetPositionTime = 0;
+    #if ODRIVE_COMM_MODE == OD_CAN && ODRIVE_STREAM_HZ != OFF
+    long lastStreamTarget = 0;
+    uint8_t streamDivider = 1;          // sends every nth tick, more while the CAN bus is busy
+    uint8_t streamTick = 0;
+    unsigned long streamSlowTime = 0;   // millis() of the last change of divider or failed send
+    #endif
     uint8_t oDriveMonitorHandle = 0;
     uint8_t taskHandle = 0;
 
@@ -0,0 +1,58 @@
+// -----------------------------------------------------------------------------------
+// Batched get commands, several queries answered in one frame
+//
+// :GB[:cmd:cmd...]#  for example :GB:GR:GD:GA:GZ:GU#
+//            Returns: the replies in order, '|' separated, each without its '#'
+//                     a failed query gives !n where n is its CommandError
+//            Only get commands (G*) can be batched, and not :GB itself
+#pragma once
+
+#include <Arduino.h>
+#include "CommandErrors.h"
+
+#define COMMAND_BATCH_REPLY_MAX 256   // reply buffer a :GB# needs, '#' included
+#define COMMAND_BATCH_ITEM_MAX  24    // longest single command in a batch
+
+// true if this command is a batch frame
+inline bool isCommandBatch(const char *command) { return command[0] == 'G' && command[1] == 'B'; }
+
+// runs each command in the list through run(reply, command, parameter, supressFrame, numericReply),
+// which returns its CommandError, and writes the combined reply
+template <typename F>
+CommandError commandBatch(char *reply, const char *list, F run) {
+  int length = 0;
+  reply[0] = 0;
+
+  const char *p = list;
+  while (*p == ':') {
+    const char *end = strchr(p + 1, ':');
+    int itemLength = end ? end - p - 1 : strlen(p + 1);
+    if (itemLength < 1 || itemLength >= COMMAND_BATCH_ITEM_MAX) return CE_PARAM_FORM;
+
+    char command[3] = "";
+    char parameter[COMMAND_BATCH_ITEM_MAX] = "";
+    command[0] = p[1];
+    if (itemLength > 1) command[1] = p[2];
+    if (itemLength > 2) { memcpy(parameter, p + 3, itemLength - 2); parameter[itemLength - 2] = 0; }
+
+    char itemReply[80] = "";
+    bool supressFrame = false;
+    bool numericReply = true;
+    CommandError e = CE_CMD_UNKNOWN;
+    if (command[0] == 'G' && !isCommandBatch(command)) e = run(itemReply, command, parameter, &supressFrame, &numericReply);
+
+    if (e > CE_0 && e != CE_NULL && e != CE_1) sprintf(itemReply, "!%d", (int)e); else
+    if (numericReply) strcpy(itemReply, e == CE_0 ? "0" : "1");
+
+    // room for the separator, a checksum and sequence character, and the closing '#'
+    int itemReplyLength = strlen(itemReply);
+    if (length + itemReplyLength + 5 >= COMMAND_BATCH_REPLY_MAX) return CE_PARAM_RANGE;
+    if (length > 0) reply[length++] = '|';
+    strcpy(&reply[length], itemReply);
+    length += itemReplyLength;
+
+    if (!end) return CE_NONE;
+    p = end;
+  }
+  return CE_PARAM_FORM;
+}
@@ -0,0 +1,93 @@
+// -----------------------------------------------------------------------------------
+// Command latency histograms, per command channel
+
+#include "CmdLatency.h"
+
+#if DEBUG_COMMAND_LATENCY == ON
+
+void CommandLatency::idle(char channel) {
+  CmdLatencyChannel *c = find(channel);
+  if (c != NULL) c->idleTime = micros();
+}
+
+unsigned long CommandLatency::waitTime(char channel) {
+  CmdLatencyChannel *c = find(channel);
+  if (c == NULL) return 0;
+  return micros() - c->idleTime;
+}
+
+void CommandLatency::record(char channel, char command, unsigned long waitUs, unsigned long executeUs, unsigned long writeUs) {
+  CmdLatencyChannel *c = find(channel);
+  if (c == NULL) return;
+
+  add(c->stage[CLS_WAIT], waitUs);
+  add(c->stage[CLS_EXECUTE], executeUs);
+  add(c->stage[CLS_WRITE], writeUs);
+
+  int letter = toupper(command) - 'A';
+  if (letter < 0 || letter > 25) letter = 26;
+  add(c->letter[letter], executeUs);
+}
+
+// :GY#       channels with histograms, for example ABLX
+// :GY[c][s]# bucket counts in hex for channel c, s is w (wait), e (execute), r (reply write),
+//            or a command letter A to Z (execute) or * for any other command character
+bool CommandLatency::report(char *reply, char *parameter) {
+  if (parameter[0] == 0) {
+    for (int i = 0; i < channelCount; i++) reply[i] = channels[i].channel;
+    reply[channelCount] = 0;
+    return true;
+  }
+  if (parameter[1] == 0 || parameter[2] != 0) return false;
+
+  CmdLatencyChannel *c = NULL;
+  for (int i = 0; i < channelCount; i++) if (channels[i].channel == parameter[0]) c = &channels[i];
+  if (c == NULL) return false;
+
+  uint16_t *histogram;
+  char s = parameter[1];
+  if (s == 'w') histogram = c->stage[CLS_WAIT]; else
+  if (s == 'e') histogram = c->stage[CLS_EXECUTE]; else
+  if (s == 'r') histogram = c->stage[CLS_WRITE]; else
+  if (s >= 'A' && s <= 'Z') histogram = c->letter[s - 'A']; else
+  if (s == '*') histogram = c->letter[26]; else return false;
+
+  // without the empty buckets at the end
+  int last = 0;
+  for (int i = 0; i < CMD_LATENCY_BUCKETS; i++) if (histogram[i]) last = i;
+  reply[0] = 0;
+  for (int i = 0; i <= last; i++) sprintf(&reply[strlen(reply)], i ? ",%X" : "%X", histogram[i]);
+  return true;
+}
+
+void CommandLatency::reset() {
+  for (int i = 0; i < channelCount; i++) {
+    memset(channels[i].stage, 0, sizeof(channels[i].stage));
+    memset(channels[i].letter, 0, sizeof(channels[i].letter));
+  }
+}
+
+// support functions
+
+// the channel's histograms, added the first time it's seen
+CmdLatencyChannel *CommandLatency::find(char channel) {
+  for (int i = 0; i < channelCount; i++) if (channels[i].channel == channel) return &channels[i];
+  if (channelCount >= CMD_LATENCY_CHANNELS) return NULL;
+
+  CmdLatencyChannel *c = &channels[channelCount++];
+  memset(c, 0, sizeof(CmdLatencyChannel));
+  c->channel = channel;
+  c->idleTime = micros();
+  return c;
+}
+
+void CommandLatency::add(uint16_t *histogram, unsigned long us) {
+  int bucket = 0;
+  us >>= 4;
+  while (us && bucket < CMD_LATENCY_BUCKETS - 1) { us >>= 1; bucket++; }
+  if (histogram[bucket] < 0xFFFF) histogram[bucket]++;
+}
+
+CommandLatency commandLatency;
+
+#endif
@@ -0,0 +1,54 @@
+// -----------------------------------------------------------------------------------
+// Command latency histograms, per command channel
+//
+// Each channel keeps log2 histograms of how long its commands waited to be read,
+// took to execute and took to write the reply, plus an execute histogram per
+// command letter. Bucket n counts times from 2^(n+3) to 2^(n+4) us, bucket 0 also
+// holds anything under 16 us and the last bucket anything over.
+#pragma once
+
+#include <Arduino.h>
+#include "../../Common.h"
+
+#if DEBUG_COMMAND_LATENCY == ON
+
+#define CMD_LATENCY_CHANNELS 8
+#define CMD_LATENCY_BUCKETS  14
+#define CMD_LATENCY_LETTERS  27   // A to Z with lower case folded in, and one for anything else
+
+enum CmdLatencyStage: uint8_t {CLS_WAIT, CLS_EXECUTE, CLS_WRITE, CLS_COUNT};
+
+typedef struct CmdLatencyChannel {
+  char     channel;
+  unsigned long idleTime;   // micros() when the channel last had nothing to read
+  uint16_t stage[CLS_COUNT][CMD_LATENCY_BUCKETS];
+  uint16_t letter[CMD_LATENCY_LETTERS][CMD_LATENCY_BUCKETS];
+} CmdLatencyChannel;
+
+class CommandLatency {
+  public:
+    // the channel had nothing waiting, a command read later waited at most since now
+    void idle(char channel);
+
+    // wait time for a command read now, an upper bound from the last idle()
+    unsigned long waitTime(char channel);
+
+    // add one command's times in microseconds
+    void record(char channel, char command, unsigned long waitUs, unsigned long executeUs, unsigned long writeUs);
+
+    // :GY# reply, the channels seen or the buckets of one histogram
+    bool report(char *reply, char *parameter);
+
+    void reset();
+
+  private:
+    CmdLatencyChannel *find(char channel);
+    void add(uint16_t *histogram, unsigned long us);
+
+    CmdLatencyChannel channels[CMD_LATENCY_CHANNELS];
+    uint8_t channelCount = 0;
+};
+
+extern CommandLatency commandLatency;
+
+#endif
@@ -0,0 +1,6 @@
+// -----------------------------------------------------------------------------------
+// Reply cache for the commands clients poll several times a second
+
+#include "ReplyCache.h"
+
+uint32_t ReplyCache::updateEpoch = 0;
@@ -0,0 +1,40 @@
+// -----------------------------------------------------------------------------------
+// Reply cache for the commands clients poll several times a second (:GR#, :GD#, :GA#, :GZ#, :GU#)
+#pragma once
+
+#include <Arduino.h>
+
+// a reply is reused for the rest of this many ms
+#define REPLY_CACHE_TICK_MS 20
+
+class ReplyCache {
+  public:
+    // copies the reply cached in this tick and epoch for this precision mode, false if there is none
+    inline bool get(char *reply, uint8_t precisionMode = 0) {
+      if (!valid || tick != millis()/REPLY_CACHE_TICK_MS || epoch != updateEpoch || mode != precisionMode) return false;
+      strcpy(reply, cached);
+      return true;
+    }
+
+    // keeps the reply for the rest of this tick, unless it's too long to hold
+    inline void set(const char *reply, uint8_t precisionMode = 0) {
+      valid = strlen(reply) < sizeof(cached);
+      if (!valid) return;
+      strcpy(cached, reply);
+      tick = millis()/REPLY_CACHE_TICK_MS;
+      epoch = updateEpoch;
+      mode = precisionMode;
+    }
+
+    // drops every cached reply, for anything that can change the mount's position or state
+    static inline void invalidate() { updateEpoch++; }
+
+  private:
+    static uint32_t updateEpoch;
+
+    bool valid = false;
+    unsigned long tick = 0;
+    uint32_t epoch = 0;
+    uint8_t mode = 0;
+    char cached[40] = "";
+};
@@ -0,0 +1,88 @@
+// -----------------------------------------------------------------------------------
+// Status streaming, pushes a status record to a command channel that subscribes
+//
+// :Ss[n]#    Set status streaming, n is the most ms between records (100 to 60000) or 0 to stop
+//            Returns: 0 on failure
+//                     1 on success
+//            Once on, a record goes out whenever the status changes (checked every 100 ms)
+//            and otherwise every n ms:
+//            ~S<ra>|<dec>|<target ra>|<target dec>|<status>|<focuser position>#
+//            the fields are the :GR# :GD# :Gr# :Gd# :GU# and :FG# replies, empty if one fails
+//            No command reply starts with '~', so a client can tell records and replies apart
+#pragma once
+
+#include <Arduino.h>
+#include "CommandErrors.h"
+#include "BatchCmds.h"
+
+#define STATUS_STREAM_CHECK_MS   100    // how often the status is checked for a change
+#define STATUS_STREAM_PERIOD_MAX 60000  // longest time allowed between records
+#define STATUS_STREAM_RECORD_MAX COMMAND_BATCH_REPLY_MAX
+
+// true if this command is a status stream subscription
+inline bool isStatusStream(const char *command) { return command[0] == 'S' && command[1] == 's'; }
+
+class StatusStream {
+  public:
+    // starts, changes or stops the stream from the :Ss[n]# parameter, false if it's out of range
+    bool subscribe(const char *parameter) {
+      char *end;
+      long n = strtol(parameter, &end, 10);
+      if (parameter[0] == 0 || *end != 0) return false;
+      if (n != 0 && (n < STATUS_STREAM_CHECK_MS || n > STATUS_STREAM_PERIOD_MAX)) return false;
+
+      // the first record goes out on the next check
+      period = n;
+      lastCheck = millis() - STATUS_STREAM_CHECK_MS;
+      lastHash = 0;
+      return true;
+    }
+
+    inline bool active() { return period != 0; }
+
+    // builds the record with run(reply, command, parameter, supressFrame, numericReply), which returns
+    // its CommandError, and gives true if it should be pushed now
+    template <typename F>
+    bool poll(char *record, F run) {
+      if (period == 0) return false;
+      unsigned long now = millis();
+      if ((long)(now - lastCheck) < STATUS_STREAM_CHECK_MS) return false;
+      lastCheck = now;
+
+      static const char queries[][3] = {"GR", "GD", "Gr", "Gd", "GU", "FG"};
+      int length = 2;
+      strcpy(record, "~S");
+      for (unsigned int i = 0; i < sizeof(queries)/sizeof(queries[0]); i++) {
+        char reply[80] = "";
+        char command[3] = {queries[i][0], queries[i][1], 0};
+        char parameter[1] = "";
+        bool supressFrame = false;
+        bool numericReply = true;
+        CommandError e = run(reply, command, parameter, &supressFrame, &numericReply);
+        if (numericReply || (e > CE_0 && e != CE_NULL && e != CE_1)) reply[0] = 0;
+
+        // room for the separator and the closing '#'
+        int replyLength = strlen(reply);
+        if (length + replyLength + 3 > STATUS_STREAM_RECORD_MAX) replyLength = 0;
+        if (i > 0) record[length++] = '|';
+        memcpy(&record[length], reply, replyLength);
+        length += replyLength;
+      }
+      record[length++] = '#';
+      record[length] = 0;
+
+      // FNV-1a, an unchanged record waits for the period
+      uint32_t hash = 2166136261UL;
+      for (int i = 0; i < length; i++) { hash ^= (uint8_t)record[i]; hash *= 16777619UL; }
+      if (hash == lastHash && (long)(now - lastSent) < period) return false;
+      lastHash = hash;
+      lastSent = now;
+      return true;
+    }
+
+  private:
+    long period = 0;
+    unsigned long lastCheck = 0;
+    unsigned long lastSent = 0;
+    uint32_t lastHash = 0;
+};
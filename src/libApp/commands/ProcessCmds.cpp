@@ -4,6 +4,7 @@
 #include "../../Common.h"
 #include "../../lib/tasks/OnTask.h"
 #include "../../lib/convert/Convert.h"
+#include "../../lib/commands/CmdLatency.h"
 #include "ProcessCmds.h"
 
 #include "../../telescope/Telescope.h"
@@ -111,16 +112,30 @@ CommandProcessor::~CommandProcessor() {
 void CommandProcessor::poll() {
   if (!serialReady) { delay(200); SerialPort.begin(serialBaud); serialReady = true; }
 
+  #if DEBUG_COMMAND_LATENCY == ON
+    if (!SerialPort.available() && !buffer.ready()) commandLatency.idle(channel);
+  #endif
+
   unsigned long tout = micros() + 500;
   while (SerialPort.available()) { char c = SerialPort.read(); buffer.add(c); if (buffer.ready() || (long)(micros() - tout) > 0) break; }
 
   if (buffer.ready()) {
-    char reply[80] = "";
+    char reply[COMMAND_BATCH_REPLY_MAX] = "";
     bool numericReply = true;
     bool supressFrame = false;
 
+    #if DEBUG_COMMAND_LATENCY == ON
+      unsigned long waitUs = commandLatency.waitTime(channel);
+      unsigned long executeStart = micros();
+    #endif
+
     commandError = command(reply, buffer.getCmd(), buffer.getParameter(), &supressFrame, &numericReply);
 
+    #if DEBUG_COMMAND_LATENCY == ON
+      unsigned long executeUs = micros() - executeStart;
+      unsigned long writeStart = micros();
+    #endif
+
     if (numericReply) {
       if (commandError != CE_NONE && commandError != CE_1) strcpy(reply,"0"); else strcpy(reply,"1");
       supressFrame = true;
@@ -135,6 +150,10 @@ void CommandProcessor::poll() {
       SerialPort.write(reply);
     }
 
+    #if DEBUG_COMMAND_LATENCY == ON
+      commandLatency.record(channel, buffer.getCmd()[0], waitUs, executeUs, micros() - writeStart);
+    #endif
+
     // debug, log errors and/or commands
     #ifdef DEBUG_ECHO_COMMANDS_CH
       if (DEBUG_ECHO_COMMANDS_CH == channel) {
@@ -159,11 +178,33 @@ void CommandProcessor::poll() {
 
     buffer.flush();
   }
+
+  // push a status record if this channel subscribed and one is due
+  if (statusStream.active()) {
+    char record[STATUS_STREAM_RECORD_MAX];
+    if (statusStream.poll(record, [this](char *r, char *c, char *p, bool *s, bool *n) { return this->command(r, c, p, s, n); })) SerialPort.write(record);
+  }
 }
 
 CommandError CommandProcessor::command(char *reply, char *command, char *parameter, bool *supressFrame, bool *numericReply) {
   commandError = CE_NONE;
 
+  // :GB[:cmd:cmd...]#  Get the replies to several get commands in one frame, see BatchCmds.h
+  //            Returns: reply|reply|...# or 0 on failure
+  if (isCommandBatch(command)) {
+    CommandError e = commandBatch(reply, parameter, [this](char *r, char *c, char *p, bool *s, bool *n) { return this->command(r, c, p, s, n); });
+    *numericReply = e != CE_NONE;
+    return commandError = e;
+  }
+
+  // :Ss[n]#    Set status streaming on this channel, see StatusStream.h
+  //            Returns: 0 on failure
+  //                     1 on success
+  if (isStatusStream(command)) {
+    if (!statusStream.subscribe(parameter)) commandError = CE_PARAM_RANGE;
+    return commandError;
+  }
+
   // handle telescope commands
   if (telescope.command(reply, command, parameter, supressFrame, numericReply, &commandError)) return commandError;
 
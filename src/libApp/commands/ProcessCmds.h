@@ -6,6 +6,8 @@
 #include "../../lib/commands/BufferCmds.h"
 #include "../../lib/commands/SerialWrapper.h"
 #include "../../lib/commands/CommandErrors.h"
+#include "../../lib/commands/BatchCmds.h"
+#include "../../lib/commands/StatusStream.h"
 
 class CommandProcessor {
   public:
@@ -29,6 +31,7 @@ class CommandProcessor {
     long serialBaud                = 9600;
     char channel                   = '?';
 
+    StatusStream statusStream;
     Buffer buffer;
     SerialWrapper SerialPort;
 };
@@ -44,6 +44,11 @@
 
 #ifdef ODRIVE_MOTOR_PRESENT
   #include "odriveExt/ODriveExt.h"
+  #include "src/lib/axis/motor/oDrive/ODrive.h"
+  #include "odriveExt/ODriveUart.h"
+  #include "odriveExt/ODriveRecorder.h"
+  #include "odriveExt/ODriveTuner.h"
+  #include "odriveExt/ODriveFollow.h"
 #endif
 
 void espWrapper() { wifiDisplay.espPoll(); }
@@ -85,10 +90,15 @@ void DDScope::init() {
 #if ODRIVE_COMM_MODE == OD_UART
   ODRIVE_SERIAL.begin(ODRIVE_SERIAL_BAUD);
   VLF("MSG: ODrive, SERIAL channel init");
+  odriveUart.init();
 #elif ODRIVE_COMM_MODE == OD_CAN
   // .begin is done by the constructor
   // in ODriveTeensyCAN.cpp
   VLF("MSG: ODrive, CAN channel init");
+  oDriveTuner.init();
+#endif
+#ifdef ODRIVE_MOTOR_PRESENT
+  oDriveFollow.init();
 #endif
 
   // Initialize Touchscreen *NOTE: must occur before display.init() since SPI.begin() is done here
@@ -144,6 +154,62 @@ bool DDScope::command(char *reply, char *command, char *parameter, bool *supress
       return true;
     }
   }
+
+  #ifdef ODRIVE_MOTOR_PRESENT
+    // :GQFn#     Get ODrive axis n (0 or 1) following error in arc-seconds, see ODriveFollow.h
+    //            Returns: error,RMS 1s,peak 1s,RMS long,peak long,warning,warnings raised#
+    if (command[0] == 'G' && command[1] == 'Q' && parameter[0] == 'F') {
+      if ((parameter[1] == '0' || parameter[1] == '1') && parameter[2] == 0) {
+        oDriveFollow.report(reply, parameter[1] - '0');
+        *numericReply = false;
+      } else *commandError = CE_PARAM_RANGE;
+      return true;
+    }
+  #endif
+
+  #if defined(ODRIVE_MOTOR_PRESENT) && ODRIVE_COMM_MODE == OD_CAN
+    // :GQ#       Get ODrive CAN bus health
+    //            Returns: load%,frames/s,round trip avg us,round trip max us,timeouts,TX full,bus errors,RX error count,TX error count#
+    // :GQn#      Get ODrive node n (0 or 1) heartbeat health
+    //            Returns: alive (0 or 1),heartbeat age ms,axis state,axis error (hex),state changes,missed heartbeats#
+    // :GQR#      Get ODrive telemetry recorder status
+    //            Returns: recording (0 or 1),records written,records dropped,file#
+    // :GQTn#     Get ODrive axis n (0 or 1) tuning result, see ODriveTuner.h
+    //            Returns: J,b,fit R2,measured overshoot %,measured settling ms,pos_gain,vel_gain,
+    //                     vel_integrator_gain,predicted overshoot %,predicted settling ms# or 0 if none
+    if (command[0] == 'G' && command[1] == 'Q') {
+      ODriveCanHealth health = _oDriveDriver->getHealth();
+      if (parameter[0] == 'R' && parameter[1] == 0) {
+        oDriveRecorder.status(reply);
+        *numericReply = false;
+      } else
+      if (parameter[0] == 'T' && (parameter[1] == '0' || parameter[1] == '1') && parameter[2] == 0) {
+        if (oDriveTuner.report(reply, parameter[1] - '0')) *numericReply = false; else *commandError = CE_0;
+      } else
+      if (parameter[0] == 0) {
+        sprintf(reply, "%u,%u,%lu,%lu,%u,%u,%u,%u,%u", health.loadPercent, health.framesPerSecond, health.rttAverage, health.rttMax,
+                health.timeouts, health.txFull, health.busErrors, health.rxErrorCount, health.txErrorCount);
+        *numericReply = false;
+      } else
+      if (parameter[0] >= '0' && parameter[0] < '0' + ODRIVE_CAN_NODES && parameter[1] == 0) {
+        ODriveCanNodeHealth *node = &health.node[parameter[0] - '0'];
+        sprintf(reply, "%d,%lu,%u,%08lX,%u,%u", node->alive ? 1 : 0, node->age, node->state, (unsigned long)node->axisError,
+                node->transitions, node->missed);
+        *numericReply = false;
+      } else *commandError = CE_PARAM_RANGE;
+      return true;
+    }
+
+    // :SQR[n]#   Set ODrive telemetry recorder, n is 1 to start a new recording or 0 to stop
+    //            Returns: 0 on failure (no SD card)
+    //                     1 on success
+    if (command[0] == 'S' && command[1] == 'Q' && parameter[0] == 'R') {
+      if (parameter[1] == '1' && parameter[2] == 0) { if (!oDriveRecorder.start()) *commandError = CE_0; } else
+      if (parameter[1] == '0' && parameter[2] == 0) oDriveRecorder.stop(); else *commandError = CE_PARAM_RANGE;
+      return true;
+    }
+  #endif
+
   return false;
 }
     
@@ -4,10 +4,8 @@
 #include "Arduino.h"
 #include "FlexCAN_T4.h"
 #include "ODriveTeensyCAN.h"
+#include "src/Common.h"
 #include "src/lib/tasks/OnTask.h"
-//#include "src/lib/debug/Debug.h"
-
-#define TIMEOUT 5 // msec
 
 // static const int kMotorOffsetFloat = 2;
 // static const int kMotorStrideFloat = 28;
@@ -32,17 +30,30 @@ template<>        inline Print& operator <<(Print &obj, float arg) { obj.print(a
 //FlexCAN_T4<CAN0, RX_SIZE_256, TX_SIZE_16> Can0;
 FlexCAN_T4<CAN3, RX_SIZE_256, TX_SIZE_16> Can0;
 
+// the receive interrupt's way back to the driver
+static ODriveTeensyCAN *canDriver = NULL;
+static void canReceive(const CAN_message_t &msg) {
+  if (canDriver != NULL && !msg.flags.remote && !msg.flags.extended) canDriver->receive(msg.id, msg.buf);
+}
+
 ODriveTeensyCAN::ODriveTeensyCAN(int CANBaudRate) {
   this->CANBaudRate = CANBaudRate;
+  memset((void *)signals, 0, sizeof(signals));
+  memset((void *)pending, 0, sizeof(pending));
+  memset(cyclePeriod, 0, sizeof(cyclePeriod));
+  memset((void *)beats, 0, sizeof(beats));
+  memset((void *)inputPosition, 0, sizeof(inputPosition));
+  memset(&health, 0, sizeof(health));
+  canDriver = this;
+
 	Can0.begin();
   Can0.setBaudRate(CANBaudRate);
 
-  // explore using FIFO and interrupts
-  //Can0.setMaxMB(16);
-  //Can0.enableFIFO();
-  //Can0.enableFIFOInterrupt();
-  //Can0.onReceive(canSniff);
-  //Can0.mailboxStatus();
+  // frames are received into the FIFO and handed to canReceive() by interrupt
+  Can0.setMaxMB(16);
+  Can0.enableFIFO();
+  Can0.enableFIFOInterrupt();
+  Can0.onReceive(canReceive);
 }
 	
 // ******CAN Frame******
@@ -60,57 +71,207 @@ ODriveTeensyCAN::ODriveTeensyCAN(int CANBaudRate) {
 // 0x017  |Get Vbus Voltage| Master | Vbus VoltageIEEE       |     0     | 754 Float                    | 32   |  1    | 0
 
 bool ODriveTeensyCAN::sendMessage(int axis_id, int cmd_id, bool remote_transmission_request, int length, byte *signal_bytes) {
+  if (remote_transmission_request) {
+    if (cmd_id < 0 || cmd_id >= ODRIVE_CAN_CMDS || cyclePeriod[cmd_id] == 0) request(axis_id, cmd_id, true, length, NULL);
+    return latest(axis_id, cmd_id, signal_bytes);
+  }
+
   CAN_message_t msg;
-  CAN_message_t return_msg;
+  msg.id = (axis_id << CommandIDLength) + cmd_id;
+  msg.flags.remote = false;
+  msg.len = length;
+  if (length > 0) memcpy(msg.buf, signal_bytes, length);
+  if (Can0.write(msg) > 0) return true;
+  txFull++;
+  return false;
+}
+
+bool ODriveTeensyCAN::request(int axis_id, int cmd_id, bool remote_transmission_request, int length, const byte *signal_bytes, ODriveCanCallback callback) {
+  unsigned long now = millis();
+  int slot = -1;
 
+  noInterrupts();
+  for (int i = 0; i < ODRIVE_CAN_PENDING; i++) {
+    volatile ODriveCanPending *p = &pending[i];
+    if (p->active && (long)(now - p->sent) >= ODRIVE_CAN_TIMEOUT) { p->active = false; timeouts++; }
+    if (p->active && p->axis_id == axis_id && p->cmd_id == cmd_id) { interrupts(); return true; }
+    if (!p->active && slot < 0) slot = i;
+  }
+  if (slot < 0) { interrupts(); return false; }
+  pending[slot].axis_id = axis_id;
+  pending[slot].cmd_id = cmd_id;
+  pending[slot].sent = now;
+  pending[slot].sentMicros = micros();
+  pending[slot].callback = callback;
+  pending[slot].active = true;
+  interrupts();
+
+  CAN_message_t msg;
   msg.id = (axis_id << CommandIDLength) + cmd_id;
   msg.flags.remote = remote_transmission_request;
   msg.len = length;
-  if (!remote_transmission_request) {
-      memcpy(msg.buf, signal_bytes, msg.len);
-      Can0.write(msg);
-      return true;
-  }
-  
-  Can0.write(msg);
+  if (!remote_transmission_request && length > 0) memcpy(msg.buf, signal_bytes, length);
+  if (Can0.write(msg) <= 0) txFull++;
+  return true;
+}
+
+bool ODriveTeensyCAN::latest(int axis_id, int cmd_id, byte *signal_bytes, unsigned long *time) {
+  if (axis_id < 0 || axis_id >= ODRIVE_CAN_NODES || cmd_id < 0 || cmd_id >= ODRIVE_CAN_CMDS) return false;
+  volatile ODriveCanSignal *signal = &signals[axis_id][cmd_id];
+
+  noInterrupts();
+  bool received = signal->count != 0;
+  for (int i = 0; i < 8; i++) signal_bytes[i] = signal->data[i];
+  if (time != NULL) *time = signal->time;
+  interrupts();
+  return received;
+}
+
+uint16_t ODriveTeensyCAN::replyCount(int axis_id, int cmd_id) {
+  if (axis_id < 0 || axis_id >= ODRIVE_CAN_NODES || cmd_id < 0 || cmd_id >= ODRIVE_CAN_CMDS) return 0;
+  return signals[axis_id][cmd_id].count;
+}
+
+bool ODriveTeensyCAN::fetch(int axis_id, int cmd_id, byte *signal_bytes, unsigned long timeout) {
+  uint16_t count = replyCount(axis_id, cmd_id);
+  if (!request(axis_id, cmd_id, true, 8, NULL)) return false;
+
   unsigned long start_time = millis();
-  while (millis() - start_time < TIMEOUT) {
-    if (Can0.read(return_msg) && (return_msg.id == msg.id)) {
-        memcpy(signal_bytes, return_msg.buf, sizeof(return_msg.buf));
-        return true;
-    }
+  while (millis() - start_time < timeout) {
+    if (replyCount(axis_id, cmd_id) != count) return latest(axis_id, cmd_id, signal_bytes);
   }
-  // Show timeout info
-  //SERIAL_DEBUG.println("CAN read Timeout");
-  //SERIAL_DEBUG.print("Axis ID: 0x"); SERIAL_DEBUG.println(axis_id, HEX);
-  //SERIAL_DEBUG.print("Cmd ID: 0x"); SERIAL_DEBUG.println(cmd_id, HEX);
-  //SERIAL_DEBUG.print("Length: "); SERIAL_DEBUG.println(length);
-  //SERIAL_DEBUG.print("msg.id: 0x"); SERIAL_DEBUG.println(msg.id, HEX);  
-  //SERIAL_DEBUG.print("msg.flags.remote: "); SERIAL_DEBUG.println(msg.flags.remote ? "True" : "False");
-  //SERIAL_DEBUG.print("msg.len: "); SERIAL_DEBUG.println(msg.len);
-  //SERIAL_DEBUG.print("signal_bytes: ");
-
-  // for (int i = 0; i < length; i++) {
-  //     SERIAL_DEBUG.print("0x");  // Add prefix
-  //     if (signal_bytes[i] < 0x10) SERIAL_DEBUG.print("0");  // Ensure leading zero for single-digit hex
-  //     SERIAL_DEBUG.print(signal_bytes[i], HEX);
-  //     SERIAL_DEBUG.print(" ");
-  // }
-  // SERIAL_DEBUG.println(); // New line after printing all bytes
-
-  // Print msg.buf
-  // if (!msg.flags.remote) {
-  //     SERIAL_DEBUG.print("msg.buf: ");
-  //     for (int i = 0; i < msg.len; i++) {
-  //         SERIAL_DEBUG.print("0x");  // Add prefix
-  //         if (msg.buf[i] < 0x10) SERIAL_DEBUG.print("0");  // Ensure leading zero
-  //         SERIAL_DEBUG.print(msg.buf[i], HEX);
-  //         SERIAL_DEBUG.print(" ");
-  //     }
-  //     SERIAL_DEBUG.println();
-  // }
   return false;
-  //tasks.yield(); // Remove this because it causes lock ups!!!!!
+}
+
+void ODriveTeensyCAN::subscribe(int cmd_id, uint16_t period) {
+  if (cmd_id < 0 || cmd_id >= ODRIVE_CAN_CMDS) return;
+  cyclePeriod[cmd_id] = period;
+}
+
+void ODriveTeensyCAN::poll() {
+  unsigned long now = millis();
+  if (now - healthTime >= 1000) supervise();
+
+  for (int cmd_id = 0; cmd_id < ODRIVE_CAN_CMDS; cmd_id++) {
+    if (cyclePeriod[cmd_id] == 0) continue;
+    for (int axis_id = 0; axis_id < ODRIVE_CAN_NODES; axis_id++) {
+      volatile ODriveCanSignal *signal = &signals[axis_id][cmd_id];
+      if (signal->count == 0 || now - signal->time >= cyclePeriod[cmd_id]) request(axis_id, cmd_id, true, 8, NULL);
+    }
+  }
+}
+
+ODriveCanHealth ODriveTeensyCAN::getHealth() {
+  ODriveCanHealth h = health;
+  unsigned long now = millis();
+  for (int i = 0; i < ODRIVE_CAN_NODES; i++) {
+    noInterrupts();
+    unsigned long time = beats[i].time;
+    interrupts();
+    h.node[i].age = time ? now - time : now;
+  }
+  return h;
+}
+
+// once a second, the bus figures for the last second and the node heartbeats
+void ODriveTeensyCAN::supervise() {
+  unsigned long now = millis();
+  unsigned long elapsed = now - healthTime;
+  healthTime = now;
+
+  // requests that will never be answered count now, not at the next request
+  noInterrupts();
+  for (int i = 0; i < ODRIVE_CAN_PENDING; i++) {
+    if (pending[i].active && (long)(now - pending[i].sent) >= ODRIVE_CAN_TIMEOUT) { pending[i].active = false; timeouts++; }
+  }
+  uint32_t framesNow = frames;
+  health.rttAverage = rttCount ? rttSum/rttCount : 0;
+  health.rttMax = rttMax;
+  rttSum = 0;
+  rttCount = 0;
+  rttMax = 0;
+  health.timeouts = timeouts;
+  health.txFull = txFull;
+  interrupts();
+
+  // a standard frame with 8 data bytes is about 125 bits with stuffing
+  health.framesPerSecond = elapsed ? (framesNow - healthFrames)*1000UL/elapsed : 0;
+  healthFrames = framesNow;
+  health.loadPercent = min(100UL, health.framesPerSecond*125UL*100UL/CANBaudRate);
+
+  CAN_error_t error;
+  while (Can0.error(error, false)) {
+    health.busErrors++;
+    health.rxErrorCount = error.RX_ERR_COUNTER;
+    health.txErrorCount = error.TX_ERR_COUNTER;
+  }
+
+  for (int i = 0; i < ODRIVE_CAN_NODES; i++) {
+    noInterrupts();
+    ODriveCanBeat beat;
+    beat.time = beats[i].time;
+    beat.state = beats[i].state;
+    beat.axisError = beats[i].axisError;
+    beat.transitions = beats[i].transitions;
+    beat.missed = beats[i].missed;
+    interrupts();
+
+    ODriveCanNodeHealth *node = &health.node[i];
+    bool alive = beat.time != 0 && now - beat.time < ODRIVE_CAN_HEARTBEAT_MS*3;
+    if (alive != node->alive) { VF("MSG: ODrive, node "); V(i); if (alive) { VLF(" heartbeat found"); } else { VLF(" heartbeat lost!"); } }
+    if (alive && beat.state != node->state) { VF("MSG: ODrive, node "); V(i); VF(" axis state "); VL(beat.state); }
+    if (alive && beat.axisError != node->axisError) {
+      char hex[9];
+      sprintf(hex, "%08lX", (unsigned long)beat.axisError);
+      VF("MSG: ODrive, node "); V(i); VF(" axis error 0x"); VL(hex);
+    }
+
+    node->alive = alive;
+    node->state = beat.state;
+    node->axisError = beat.axisError;
+    node->transitions = beat.transitions;
+    node->missed = beat.missed;
+  }
+}
+
+// runs in the CAN interrupt, stores the frame and completes any request waiting for it
+void ODriveTeensyCAN::receive(uint32_t id, const uint8_t *buf) {
+  int axis_id = id >> CommandIDLength;
+  int cmd_id = id & (ODRIVE_CAN_CMDS - 1);
+  if (axis_id >= ODRIVE_CAN_NODES) return;
+
+  volatile ODriveCanSignal *signal = &signals[axis_id][cmd_id];
+  for (int i = 0; i < 8; i++) signal->data[i] = buf[i];
+  signal->time = millis();
+  if (++signal->count == 0) signal->count = 1;
+  frames++;
+  if (monitorCallback != NULL) monitorCallback(axis_id, cmd_id, buf);
+
+  if (cmd_id == CMD_ID_ODRIVE_HEARTBEAT_MESSAGE) {
+    heartbeatNode = axis_id;
+    volatile ODriveCanBeat *beat = &beats[axis_id];
+    unsigned long now = signal->time;
+    if (beat->time != 0) {
+      unsigned long gap = now - beat->time;
+      if (gap > ODRIVE_CAN_HEARTBEAT_MS*3/2) beat->missed += (gap + ODRIVE_CAN_HEARTBEAT_MS/2)/ODRIVE_CAN_HEARTBEAT_MS - 1;
+      if (buf[4] != beat->state) beat->transitions++;
+    }
+    beat->time = now ? now : 1;
+    beat->state = buf[4];
+    beat->axisError = buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((uint32_t)buf[3] << 24);
+  }
+
+  for (int i = 0; i < ODRIVE_CAN_PENDING; i++) {
+    volatile ODriveCanPending *p = &pending[i];
+    if (p->active && p->axis_id == axis_id && p->cmd_id == cmd_id) {
+      p->active = false;
+      unsigned long rtt = micros() - p->sentMicros;
+      rttSum += rtt;
+      rttCount++;
+      if (rtt > rttMax) rttMax = rtt;
+      if (p->callback != NULL) p->callback(axis_id, cmd_id, buf);
+    }
+  }
 }
 
 // # 0x001 - Heartbeat 
@@ -120,12 +281,11 @@ bool ODriveTeensyCAN::sendMessage(int axis_id, int cmd_id, bool remote_transmiss
 // encoderFlags:    bits 48 - 55, byte 6
 // controllerFlags: bits 56 - 63, byte 7
 int ODriveTeensyCAN::Heartbeat() {
-  CAN_message_t return_msg;
-	if(Can0.read(return_msg) == 1) {
-		return (int)(return_msg.id >> 5);
-	} else {
-		return -1;
-	}
+  noInterrupts();
+  int node = heartbeatNode;
+  heartbeatNode = -1;
+  interrupts();
+  return node;
 }
 
 void ODriveTeensyCAN::SetAxisNodeId(int axis_id, int node_id) {
@@ -155,15 +315,15 @@ void ODriveTeensyCAN::SetControllerModes(int axis_id, int control_mode, int inpu
 	sendMessage(axis_id, CMD_ID_SET_CONTROLLER_MODES, false, 8, msg_data);
 }
 
-void ODriveTeensyCAN::SetPosition(int axis_id, float position) {
-  SetPosition(axis_id, position, 0.0f, 0.0f);
+bool ODriveTeensyCAN::SetPosition(int axis_id, float position) {
+  return SetPosition(axis_id, position, 0.0f, 0.0f);
 }
 
-void ODriveTeensyCAN::SetPosition(int axis_id, float position, float velocity_feedforward) {
-  SetPosition(axis_id, position, velocity_feedforward, 0.0f);
+bool ODriveTeensyCAN::SetPosition(int axis_id, float position, float velocity_feedforward) {
+  return SetPosition(axis_id, position, velocity_feedforward, 0.0f);
 }
 
-void ODriveTeensyCAN::SetPosition(int axis_id, float position, float velocity_feedforward, float current_feedforward) {
+bool ODriveTeensyCAN::SetPosition(int axis_id, float position, float velocity_feedforward, float current_feedforward) {
   int16_t vel_ff = (int16_t) (feedforwardFactor * velocity_feedforward);
   int16_t curr_ff = (int16_t) (feedforwardFactor * current_feedforward);
 
@@ -181,7 +341,8 @@ void ODriveTeensyCAN::SetPosition(int axis_id, float position, float velocity_fe
   msg_data[6] = current_feedforward_b[0];
   msg_data[7] = current_feedforward_b[1];
 
-  sendMessage(axis_id, CMD_ID_SET_INPUT_POS, false, 8, msg_data);
+  if (axis_id >= 0 && axis_id < ODRIVE_CAN_NODES) inputPosition[axis_id] = position;
+  return sendMessage(axis_id, CMD_ID_SET_INPUT_POS, false, 8, msg_data);
 }
 
 void ODriveTeensyCAN::SetVelocity(int axis_id, float velocity) {
@@ -288,6 +449,11 @@ void ODriveTeensyCAN::SetVelocityGains(int axis_id, float velocity_gain, float v
 
 //////////// Get functions ///////////
 
+float ODriveTeensyCAN::GetInputPosition(int axis_id) {
+  if (axis_id < 0 || axis_id >= ODRIVE_CAN_NODES) return 0;
+  return inputPosition[axis_id];
+}
+
 float ODriveTeensyCAN::GetPosition(int axis_id) {
   byte msg_data[8] = {0, 0, 0, 0, 0, 0, 0, 0};
 
@@ -419,60 +585,31 @@ uint32_t ODriveTeensyCAN::GetEncoderError(int axis_id) {
   return output;
 }
 
-// NOTE: The CAN default Heartbeat is 100 msec. 
+// NOTE: The CAN default Heartbeat is 100 msec, these give the latest one received
 uint32_t ODriveTeensyCAN::GetAxisError(int axis_id) {
   byte msg_data[8] = {0, 0, 0, 0, 0, 0, 0, 0};
   uint32_t output;
-  CAN_message_t return_msg;
-  uint32_t msg_id = (axis_id << CommandIDLength) + CMD_ID_ODRIVE_HEARTBEAT_MESSAGE;
-
-  while(true) {
-      if (Can0.read(return_msg) && (return_msg.id == msg_id)) {
-          memcpy(msg_data, return_msg.buf, sizeof(return_msg.buf));
-          *((uint8_t *)(&output) + 0) = msg_data[0];
-          *((uint8_t *)(&output) + 1) = msg_data[1];
-          *((uint8_t *)(&output) + 2) = msg_data[2];
-          *((uint8_t *)(&output) + 3) = msg_data[3];
-          return output;  // Successfully received message
-      }
-    tasks.yield();
-  }
+
+  latest(axis_id, CMD_ID_ODRIVE_HEARTBEAT_MESSAGE, msg_data);
+  *((uint8_t *)(&output) + 0) = msg_data[0];
+  *((uint8_t *)(&output) + 1) = msg_data[1];
+  *((uint8_t *)(&output) + 2) = msg_data[2];
+  *((uint8_t *)(&output) + 3) = msg_data[3];
+  return output;
 }
 
 uint8_t ODriveTeensyCAN::GetControllerFlags(int axis_id) {
   byte msg_data[8] = {0, 0, 0, 0, 0, 0, 0, 0};
-  uint8_t output;
-
-  CAN_message_t return_msg;
 
-  uint32_t msg_id = (axis_id << CommandIDLength) + CMD_ID_ODRIVE_HEARTBEAT_MESSAGE;
-
-  while (true) {
-    if (Can0.read(return_msg) && (return_msg.id == msg_id)) {
-      memcpy(msg_data, return_msg.buf, sizeof(return_msg.buf));
-      *((uint8_t *)(&output) + 0) = msg_data[7];
-      return output;
-    }
-  }
-  tasks.yield();
+  latest(axis_id, CMD_ID_ODRIVE_HEARTBEAT_MESSAGE, msg_data);
+  return msg_data[7];
 }
 
 uint8_t ODriveTeensyCAN::GetCurrentState(int axis_id) {
   byte msg_data[8] = {0, 0, 0, 0, 0, 0, 0, 0};
-  uint8_t output;
-
-  CAN_message_t return_msg;
 
-  uint32_t msg_id = (axis_id << CommandIDLength) + CMD_ID_ODRIVE_HEARTBEAT_MESSAGE;
-
-  while (true) {
-    if (Can0.read(return_msg) && (return_msg.id == msg_id)) {
-      memcpy(msg_data, return_msg.buf, sizeof(return_msg.buf));
-      *((uint8_t *)(&output) + 0) = msg_data[4];
-      return output;
-    }
-  }
-  tasks.yield();
+  latest(axis_id, CMD_ID_ODRIVE_HEARTBEAT_MESSAGE, msg_data);
+  return msg_data[4];
 }
 
 // Some Documentation indicates this returns both voltage and current but only using voltage here
@@ -488,19 +625,17 @@ float ODriveTeensyCAN::GetVbusVoltage(int axis_id) {  //message can be sent to e
     *((uint8_t *)(&output) + 1) = msg_data[1];
     *((uint8_t *)(&output) + 2) = msg_data[2];
     *((uint8_t *)(&output) + 3) = msg_data[3];
-    *((uint8_t *)(&output) + 4) = msg_data[4];
-    *((uint8_t *)(&output) + 5) = msg_data[5];
-    *((uint8_t *)(&output) + 6) = msg_data[6];
-    *((uint8_t *)(&output) + 7) = msg_data[7];
     return output;
 }
 
+// the reply is for whichever gpio was asked for last
 float ODriveTeensyCAN::GetADCVoltage(int axis_id, uint8_t gpio_num) {
-  byte msg_data[4] = {0, 0, 0, 0};
+  byte msg_data[8] = {0, 0, 0, 0, 0, 0, 0, 0};
 
 	msg_data[0] = gpio_num;
 	
-  sendMessage(axis_id, CMD_ID_GET_ADC_VOLTAGE, false, 1, msg_data);  //RTR must be false!
+  request(axis_id, CMD_ID_GET_ADC_VOLTAGE, false, 1, msg_data);  //RTR must be false!
+  latest(axis_id, CMD_ID_GET_ADC_VOLTAGE, msg_data);
 
   float_t output;
   *((uint8_t *)(&output) + 0) = msg_data[0];
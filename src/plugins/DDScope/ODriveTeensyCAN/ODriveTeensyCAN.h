@@ -3,6 +3,66 @@
 
 #include "Arduino.h"
 
+// Frames are received by interrupt (FIFO) into a latest-value store, one slot per node and
+// command id. Getters send a request if none is outstanding and return the latest value
+// right away, nothing waits on the bus. A getter's value is 0 until the first reply.
+// A subscribed command is kept fresh by poll() instead, and its getters only read the store.
+// If the ODrive already sends it cyclically (its can.*_rate_ms settings) nothing is requested.
+#define ODRIVE_CAN_NODES   2  // axis (node) ids kept in the store, frames from others are ignored
+#define ODRIVE_CAN_CMDS    32 // command ids per node, 0x00 to 0x1F
+#define ODRIVE_CAN_PENDING 8  // requests waiting for a reply at once
+#define ODRIVE_CAN_TIMEOUT 5  // ms before an unanswered request is given up and can be sent again
+#define ODRIVE_CAN_HEARTBEAT_MS 100 // the ODrive's heartbeat period (its can.heartbeat_rate_ms)
+
+// called from the CAN receive interrupt with the reply to a request(), keep it short
+typedef void (*ODriveCanCallback)(int axis_id, int cmd_id, const uint8_t *data);
+
+typedef struct ODriveCanSignal {
+  uint8_t data[8];
+  unsigned long time;   // millis() when it arrived
+  uint16_t count;       // frames received, changes with each one
+} ODriveCanSignal;
+
+typedef struct ODriveCanPending {
+  bool active;
+  uint8_t axis_id;
+  uint8_t cmd_id;
+  unsigned long sent;   // millis() when the request went out
+  unsigned long sentMicros;
+  ODriveCanCallback callback;
+} ODriveCanPending;
+
+// heartbeat tracking for one node, kept by the receive interrupt
+typedef struct ODriveCanBeat {
+  unsigned long time;   // millis() of the last heartbeat, 0 if none yet
+  uint8_t state;        // axis state
+  uint32_t axisError;   // axis error bits
+  uint16_t transitions; // axis state changes
+  uint16_t missed;      // heartbeats that didn't arrive
+} ODriveCanBeat;
+
+typedef struct ODriveCanNodeHealth {
+  bool alive;           // a heartbeat within the last three periods
+  unsigned long age;    // ms since the last heartbeat
+  uint8_t state;
+  uint32_t axisError;
+  uint16_t transitions;
+  uint16_t missed;
+} ODriveCanNodeHealth;
+
+typedef struct ODriveCanHealth {
+  ODriveCanNodeHealth node[ODRIVE_CAN_NODES];
+  uint16_t framesPerSecond;   // frames received over the last second
+  uint8_t loadPercent;        // bus load those frames are, of the bit rate
+  unsigned long rttAverage;   // request round trip in us over the last second
+  unsigned long rttMax;
+  uint16_t timeouts;          // requests that got no reply
+  uint16_t txFull;            // frames that found the TX queue full
+  uint16_t busErrors;         // errors flagged by the CAN controller
+  uint8_t rxErrorCount;       // the controller's error counters when last flagged
+  uint8_t txErrorCount;
+} ODriveCanHealth;
+
 class ODriveTeensyCAN {
   public:
     
@@ -63,18 +123,50 @@ class ODriveTeensyCAN {
     
     int CANBaudRate = 250000;  //250,000 is odrive default
 
+    // writes a frame, false if there was no room to queue it, for a remote transmission request it
+    // also requests the reply (see request()) and copies the latest value into signal_bytes, false
+    // if there is none yet
     bool sendMessage(int axis_id, int cmd_id, bool remote_transmission_request, int length, byte *signal_bytes);
+
+    // sends a request unless one for this node and command is waiting, the callback (optional)
+    // runs when the reply arrives, false if the pending table is full
+    bool request(int axis_id, int cmd_id, bool remote_transmission_request, int length, const byte *signal_bytes, ODriveCanCallback callback = NULL);
+
+    // copies the latest frame received for this node and command, false if there is none
+    bool latest(int axis_id, int cmd_id, byte *signal_bytes, unsigned long *time = NULL);
+
+    // frames received for this node and command so far, compare to see a new reply arrived
+    uint16_t replyCount(int axis_id, int cmd_id);
+
+    // requests and waits up to timeout ms for a fresh reply, other frames are still stored
+    // this blocks, for setup only
+    bool fetch(int axis_id, int cmd_id, byte *signal_bytes, unsigned long timeout);
+
+    // keeps this command's latest value on every node no older than period ms, 0 stops
+    void subscribe(int cmd_id, uint16_t period);
+
+    // requests the subscribed values that are due, call every ms or so
+    void poll();
+
+    // heartbeats, bus load, round trip and error counts, updated each second by poll()
+    ODriveCanHealth getHealth();
+
+    // called by the receive interrupt for each frame
+    void receive(uint32_t id, const uint8_t *buf);
+
+    // the callback (NULL for none) also runs in the receive interrupt, with every frame stored
+    void monitor(ODriveCanCallback callback) { monitorCallback = callback; }
     
-    // Heartbeat
+    // Heartbeat, the node of the last heartbeat received since the previous call or -1
     int Heartbeat();
 
     // Setters
     void SetAxisNodeId(int axis_id, int node_id);
     void SetControllerModes(int axis_id, int control_mode, int input_mode);
     void SetControllerModes(int axis_id, int control_mode);
-    void SetPosition(int axis_id, float position);
-    void SetPosition(int axis_id, float position, float velocity_feedforward);
-    void SetPosition(int axis_id, float position, float velocity_feedforward, float current_feedforward);
+    bool SetPosition(int axis_id, float position);
+    bool SetPosition(int axis_id, float position, float velocity_feedforward);
+    bool SetPosition(int axis_id, float position, float velocity_feedforward, float current_feedforward);
     void SetVelocity(int axis_id, float velocity);
     void SetVelocity(int axis_id, float velocity, float current_feedforward);
     void SetTorque(int axis_id, float torque);
@@ -87,6 +179,7 @@ class ODriveTeensyCAN {
     void SetVelocityGains(int axis_id, float velocity_gain, float velocity_integrator_gain);
 
     // Getters
+    float GetInputPosition(int axis_id);  // the last position sent, read locally
     float GetPosition(int axis_id);
     float GetVelocity(int axis_id);
     int32_t GetEncoderShadowCount(int axis_id);
@@ -112,6 +205,26 @@ class ODriveTeensyCAN {
     // State helper
     bool RunState(int axis_id, int requested_state);
 
+  private:
+    void supervise();
+
+    volatile ODriveCanSignal signals[ODRIVE_CAN_NODES][ODRIVE_CAN_CMDS];
+    volatile ODriveCanPending pending[ODRIVE_CAN_PENDING];
+    volatile int heartbeatNode = -1;
+    uint16_t cyclePeriod[ODRIVE_CAN_CMDS];
+    volatile ODriveCanCallback monitorCallback = NULL;
+    volatile float inputPosition[ODRIVE_CAN_NODES];
+
+    volatile ODriveCanBeat beats[ODRIVE_CAN_NODES];
+    volatile uint32_t frames = 0;
+    volatile uint32_t rttSum = 0;
+    volatile uint16_t rttCount = 0;
+    volatile unsigned long rttMax = 0;
+    volatile uint16_t timeouts = 0;
+    volatile uint16_t txFull = 0;
+    ODriveCanHealth health;
+    unsigned long healthTime = 0;
+    uint32_t healthFrames = 0;
 };
 
 #endif
\ No newline at end of file
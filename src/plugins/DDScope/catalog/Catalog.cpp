@@ -11,6 +11,9 @@
 #include "Catalog.h"
 #include "CatalogTypes.h"
 #include "CatalogConfig.h"
+#include "SdCatalog.h"
+#include "CatalogRecord.h"
+#include "SkyContext.h"
 
 // Bayer designation, the Greek letter for each star within a constellation
 const char* Txt_Bayer[25] = {
@@ -40,17 +43,12 @@ const double Rad=57.29577951;
 
 // initialization
 void CatMgr::setLat(double lat) {
-  _lat=lat;
-  if (lat<9999) {
-    _cosLat=cos(lat/Rad);
-    _sinLat=sin(lat/Rad);
-  }
+  skyContext.setLat(lat);
 }
 
 // Set Local Sidereal Time, and number of milliseconds
 void CatMgr::setLstT0(double lstT0) {
-  _lstT0=lstT0;
-  _lstMillisT0=millis();
+  skyContext.setLstT0(lstT0);
 }
 
 // Set last Tele RA/Dec
@@ -60,20 +58,17 @@ void CatMgr::setLastTeleEqu(double RA, double Dec) {
 }
 
 bool CatMgr::isInitialized() {
-  return ((_lat<9999) && (_lstT0!=0));
+  return skyContext.isInitialized();
 }
 
 // Get Local Sidereal Time, converted from hours to degrees
 double CatMgr::lstDegs() {
-  return (lstHours()*15.0);
+  return skyContext.lstDegs();
 }
 
 // Get Local Sidereal Time, in hours, and adjust for time inside the menus
 double CatMgr::lstHours() {
-  double msSinceT0=(unsigned long)(millis()-_lstMillisT0);
-  // Convert from Solar to Sidereal
-  double siderealSecondsSinceT0=(msSinceT0/1000.0)*1.00277778;
-  return _lstT0+siderealSecondsSinceT0/3600.0;
+  return skyContext.lstHours();
 }
 
 // number of catalogs available
@@ -84,37 +79,59 @@ int CatMgr::numCatalogs() {
   return 32;
 }
 
-gen_star_t*       _genStarCatalog      = NULL;
-gen_star_vcomp_t* _genStarVCompCatalog = NULL;
-dbl_star_t*       _dblStarCatalog      = NULL;
-dbl_star_comp_t*  _dblStarCompCatalog  = NULL;
-var_star_t*       _varStarCatalog      = NULL;
-var_star_comp_t*  _varStarCompCatalog  = NULL;
-dso_t*            _dsoCatalog          = NULL;
-dso_comp_t*       _dsoCompCatalog      = NULL;
-dso_vcomp_t*      _dsoVCompCatalog     = NULL;
-
 // handle catalog selection (0..n)
 void CatMgr::select(int number) {
-  _genStarCatalog      =NULL;
-  _genStarVCompCatalog =NULL;
-  _dblStarCatalog      =NULL;
-  _dsoCatalog          =NULL;
-  _dsoCompCatalog      =NULL;
-  _dsoVCompCatalog     =NULL;
   if ((number<0) || (number>=numCatalogs())) number=-1; // invalid catalog?
   _selected=number;
-  if (_selected>=0) {
-    if (catalog[_selected].CatalogType==CAT_GEN_STAR)       _genStarCatalog     =(gen_star_t*)catalog[_selected].Objects; else
-    if (catalog[_selected].CatalogType==CAT_GEN_STAR_VCOMP) _genStarVCompCatalog=(gen_star_vcomp_t*)catalog[_selected].Objects; else
-    if (catalog[_selected].CatalogType==CAT_DBL_STAR)       _dblStarCatalog     =(dbl_star_t*)catalog[_selected].Objects; else
-    if (catalog[_selected].CatalogType==CAT_DBL_STAR_COMP)  _dblStarCompCatalog =(dbl_star_comp_t*)catalog[_selected].Objects; else
-    if (catalog[_selected].CatalogType==CAT_VAR_STAR)       _varStarCatalog     =(var_star_t*)catalog[_selected].Objects; else
-    if (catalog[_selected].CatalogType==CAT_VAR_STAR_COMP)  _varStarCompCatalog =(var_star_comp_t*)catalog[_selected].Objects; else
-    if (catalog[_selected].CatalogType==CAT_DSO)            _dsoCatalog         =(dso_t*)catalog[_selected].Objects; else
-    if (catalog[_selected].CatalogType==CAT_DSO_COMP)       _dsoCompCatalog     =(dso_comp_t*)catalog[_selected].Objects; else
-    if (catalog[_selected].CatalogType==CAT_DSO_VCOMP)      _dsoVCompCatalog    =(dso_vcomp_t*)catalog[_selected].Objects; else _selected=-1;
+  if (_selected>=0 && SdCatalog::recordSize(catalog[_selected].CatalogType)==0) _selected=-1;
+  if (_selected>=0) skyContext.setEpoch(catalog[_selected].Epoch);
+  seekRecord();
+}
+
+// point _rec at the current record, SD card catalogs have no record array in memory so
+// the record is copied into _recBuf
+void CatMgr::seekRecord() {
+  if (_selected<0) { _rec=NULL; return; }
+  long i=catalog[_selected].Index;
+  if ((i<0) || (i>getMaxIndex())) i=0;
+  _rec=record(i,_recBuf);
+
+  // decode the coordinates once, they are read several times per record
+  _recRah=recordRah();
+  _recDec=recordDec();
+  skyContext.toJ2000(_recRah,_recDec);
+}
+
+// record index of the selected catalog, in flash or copied into buf from the SD card
+const void* CatMgr::record(long index, unsigned char *buf) {
+  if (catalog[_selected].Objects==NULL) {
+    if (!sdCatalog.getRecord(catalog[_selected].SdIndex,index,buf)) memset(buf,0,sizeof(_recBuf));
+    return buf;
   }
+  return (const uint8_t*)catalog[_selected].Objects+index*SdCatalog::recordSize(catalogType());
+}
+
+// append the catalogs in the SD card container to the catalog list, returns the number added
+int CatMgr::addSdCatalogs() {
+  if (!sdCatalog.open()) return 0;
+  int added=0;
+  for (int i=0; i<sdCatalog.count(); i++) {
+    int n=numCatalogs();
+    if (n>=MaxCatalogs-1) break; // keep the terminating entry
+    const cat_bin_dir_t *d=sdCatalog.dir(i);
+    strncpy(catalog[n].Title,d->Title,sizeof(catalog[n].Title)-1);
+    catalog[n].Prefix=sdCatalog.prefix(i);
+    catalog[n].Objects=NULL;
+    catalog[n].ObjectNames=NULL;
+    catalog[n].ObjectSubIds=NULL;
+    catalog[n].CatalogType=(CAT_TYPES)d->CatalogType;
+    catalog[n].Epoch=d->Epoch;
+    catalog[n].Index=0;
+    catalog[n].SdIndex=i;
+    catalog[n].NumObjects=d->NumObjects; // last, a non-zero count makes the entry visible
+    added++;
+  }
+  return added;
 }
 
 //  Get active catalog type
@@ -184,9 +201,9 @@ const char* CatMgr::catalogTitle() {
 // Get active catalog submenu
 const char* CatMgr::catalogSubMenu() {
   if (_selected<0) return "";
-  static char thisSubMenu[16];
+  static char thisSubMenu[CAT_TITLE_SIZE];
   
-  strcpy(thisSubMenu,catalog[_selected].Title);
+  strlcpy(thisSubMenu,catalog[_selected].Title,sizeof(thisSubMenu));
   char *subMenu=strstr(thisSubMenu,">");
   if (subMenu) {
     subMenu[0]=0;
@@ -293,34 +310,149 @@ bool CatMgr::hasActiveFilter() {
   return false;
 }  
 
-// checks to see if the currently selected object is filtered (returns true if filtered out)
-bool CatMgr::isFiltered() {
+// checks to see if record r is filtered (returns true if filtered out)
+template <typename T> bool CatMgr::isFiltered(const T &r) {
+  typedef CatLayout<T> L;
   if (!isInitialized()) return false;
   if (_fm == FM_NONE)   return false;
-  if (_fm & FM_CONSTELLATION) { if (constellation()!=_fm_con) return true; }
-  if (_fm & FM_OBJ_TYPE)      { if (isDsoCatalog() && (objectType()!=_fm_obj_type)) return true; }
-  if (_fm & FM_BY_MAG)        { if (magnitude()>=_fm_mag_limit) return true; }
-  if (_fm & FM_NEARBY)        { if (DistFromEqu(_lastTeleRA,_lastTeleDec)>=_fm_nearby_dist) return true; }
-  if (_fm & FM_DBL_MAX_SEP)   { if (isDblStarCatalog() && ((separation()>_fm_dbl_max) || (separation()<0))) return true; }
-  if (_fm & FM_DBL_MIN_SEP)   { if (isDblStarCatalog() && ((separation()<_fm_dbl_min) || (separation()<0))) return true; }
-  if (_fm & FM_VAR_MAX_PER)   { if (isVarStarCatalog() && ((period()    >_fm_var_max) || (period()    <0))) return true; }
-  if (_fm & FM_ABOVE_HORIZON) { if (alt()<10.0) return true; } //DD Note: changed to 10.0 from the original 0.0
+  double ra=0, dec=0;
+  if (_fm & (FM_NEARBY | FM_ABOVE_HORIZON | FM_ALIGN_ALL_SKY)) {
+    ra=L::rah(r); dec=L::dec(r);
+    skyContext.toJ2000(ra,dec);
+    ra*=15.0;
+  }
+  if (_fm & FM_CONSTELLATION) { if (L::cons(r)!=_fm_con) return true; }
+  if (_fm & FM_OBJ_TYPE)      { if (L::IsDso && (L::objType(r)!=_fm_obj_type)) return true; }
+  if (_fm & FM_BY_MAG)        { if (L::mag(r)>=_fm_mag_limit) return true; }
+  if (_fm & FM_NEARBY)        { if (DistFromEqu(ra,dec,_lastTeleRA,_lastTeleDec)>=_fm_nearby_dist) return true; }
+  if (_fm & FM_DBL_MAX_SEP)   { if (L::IsDblStar && ((L::separation(r)>_fm_dbl_max) || (L::separation(r)<0))) return true; }
+  if (_fm & FM_DBL_MIN_SEP)   { if (L::IsDblStar && ((L::separation(r)<_fm_dbl_min) || (L::separation(r)<0))) return true; }
+  if (_fm & FM_VAR_MAX_PER)   { if (L::IsVarStar && ((L::period(r)    >_fm_var_max) || (L::period(r)    <0))) return true; }
+  if (_fm & FM_ABOVE_HORIZON) { double a; EquToAlt(ra,dec,&a); if (a<10.0) return true; } //DD Note: changed to 10.0 from the original 0.0
   if (_fm & FM_ALIGN_ALL_SKY) {
-    if (magnitude()>3.0) return true; // maximum magnitude 3.0
-    if (alt()<10.0) return true;      // minimum 10 degrees altitude
-    if (abs(dec())>80.0) return true; // minimum 10 degrees from the pole (for accuracy)
+    if (L::mag(r)>3.0) return true;   // maximum magnitude 3.0
+    double a; EquToAlt(ra,dec,&a);
+    if (a<10.0) return true;          // minimum 10 degrees altitude
+    if (abs(dec)>80.0) return true;   // minimum 10 degrees from the pole (for accuracy)
   }
   return false;
-}  
+}
+
+// RA hour zones that can hold records within _fm_nearby_dist of the telescope, false if that's all of them
+bool CatMgr::nearbyZones(bool *zones) {
+  double dist=_fm_nearby_dist+0.5; // margin for the J2000 conversion and rounding at the zone edges
+  if (fabs(_lastTeleDec)+dist>=90.0) return false;
+  double width=asin(sin(dist/Rad)/cos(_lastTeleDec/Rad))*Rad; // widest RA difference at that distance
+  long first=floor((_lastTeleRA-width)/15.0);
+  long last=floor((_lastTeleRA+width)/15.0);
+  if (last-first+1>=SD_CAT_ZONES) return false;
+  for (int z=0; z<SD_CAT_ZONES; z++) zones[z]=false;
+  for (long h=first; h<=last; h++) zones[((h%SD_CAT_ZONES)+SD_CAT_ZONES)%SD_CAT_ZONES]=true;
+  return true;
+}
+
+// as scan() below for an SD card catalog, stepping through its RA zone index so only the records in
+// the given zones are read; the zones keep record order so the records come up in the same order
+template <typename T> bool CatMgr::scanZones(int step, const bool *zones) {
+  int n=catalog[_selected].SdIndex;
+  long index=catalog[_selected].Index;
+  long from=index;
+  bool wrapped=false;
+  bool filtered=true;
+  unsigned char buf[sizeof(_recBuf)];
+  for (;;) {
+    long next=-1;
+    for (int z=0; z<SD_CAT_ZONES; z++) {
+      if (!zones[z]) continue;
+      long r=sdCatalog.zoneNext(n,z,from,step);
+      if (r>=0 && (next<0 || (step>0 ? r<next : r>next))) next=r;
+    }
+    if (next<0) {
+      if (wrapped) break;
+      wrapped=true;
+      from=(step>0) ? -1 : getMaxIndex()+1;
+      continue;
+    }
+    if (wrapped && (step>0 ? next>index : next<index)) break;
+    from=next;
+    filtered=isFiltered(*(const T*)record(next,buf));
+    if (!filtered) { index=next; break; }
+  }
+  catalog[_selected].Index=index;
+  seekRecord();
+  return !filtered;
+}
+
+// step through the catalog (step is +1 or -1) to the next record that isn't filtered
+// the record layout is resolved once so the filter tests compile to direct field reads
+template <typename T> bool CatMgr::scan(int step) {
+  if ((_fm & FM_NEARBY) && catalog[_selected].Objects==NULL && isInitialized()) {
+    bool zones[SD_CAT_ZONES];
+    if (nearbyZones(zones)) return scanZones<T>(step,zones);
+  }
+  long index=catalog[_selected].Index;
+  long maxIndex=getMaxIndex();
+  bool filtered=false;
+  unsigned char buf[sizeof(_recBuf)];
+  for (long i=maxIndex; i>=0; i--) {
+    index+=step;
+    if (index>maxIndex) index=0;
+    if (index<0) index=maxIndex;
+    if (_fm==FM_NONE) { filtered=false; break; }
+    filtered=isFiltered(*(const T*)record(index,buf));
+    if (!filtered) break;
+  }
+  catalog[_selected].Index=index;
+  seekRecord();
+  return !filtered;
+}
+
+bool CatMgr::scan(int step) {
+  if (_selected<0) return false;
+  switch (catalogType()) {
+    case CAT_GEN_STAR:       return scan<gen_star_t>(step);
+    case CAT_GEN_STAR_VCOMP: return scan<gen_star_vcomp_t>(step);
+    case CAT_DBL_STAR:       return scan<dbl_star_t>(step);
+    case CAT_DBL_STAR_COMP:  return scan<dbl_star_comp_t>(step);
+    case CAT_VAR_STAR:       return scan<var_star_t>(step);
+    case CAT_VAR_STAR_COMP:  return scan<var_star_comp_t>(step);
+    case CAT_DSO:            return scan<dso_t>(step);
+    case CAT_DSO_COMP:       return scan<dso_comp_t>(step);
+    case CAT_DSO_VCOMP:      return scan<dso_vcomp_t>(step);
+    default:                 return false;
+  }
+}
 
 // select catalog record
 bool CatMgr::setIndex(long index) {
   if (_selected<0) return false;
   catalog[_selected].Index=index;
+  seekRecord();
   decIndex();
   return incIndex();
 }
 
+// select a catalog and record directly, any active filters are ignored
+bool CatMgr::selectRecord(int cat, long index) {
+  select(cat);
+  if (_selected<0 || index<0 || index>getMaxIndex()) return false;
+  catalog[_selected].Index=index;
+  seekRecord();
+  return true;
+}
+
+// J2000 coordinates of a record, the selected catalog and the record each catalog is on stay as they were
+bool CatMgr::recordCoords(int cat, long index, double &raHours, double &decDegs) {
+  if ((cat<0) || (cat>=numCatalogs())) return false;
+  int selected=_selected;
+  long catIndex=catalog[cat].Index;
+  bool found=selectRecord(cat,index);
+  if (found) { raHours=rah(); decDegs=dec(); }
+  catalog[cat].Index=catIndex;
+  select(selected);
+  return found;
+}
+
 long CatMgr::getIndex() {
   return catalog[_selected].Index;
 }
@@ -330,23 +462,11 @@ long CatMgr::getMaxIndex() {
 }
 
 bool CatMgr::incIndex() {
-  long i=getMaxIndex()+1;
-  do {
-    i--;
-    catalog[_selected].Index++;
-    if (catalog[_selected].Index > getMaxIndex()) catalog[_selected].Index=0;
-  } while (isFiltered() && (i>0));
-  if (isFiltered()) return false; else return true;
+  return scan(1);
 }
 
 bool CatMgr::decIndex() {
-  long i=getMaxIndex()+1;
-  do {
-    i--;
-    catalog[_selected].Index--;
-    if (catalog[_selected].Index<0) catalog[_selected].Index=getMaxIndex();
-  } while (isFiltered() && (i>0));
-  if (isFiltered()) return false; else return true;
+  return scan(-1);
 }
 
 // get catalog contents
@@ -356,18 +476,16 @@ double CatMgr::ra() {
   return rah()*15.0;
 }
 
-// RA in hours
+// RA in hours, J2000
 double CatMgr::rah() {
   if (_selected<0) return 0;
-  if (catalogType()==CAT_GEN_STAR)       return _genStarCatalog[catalog[_selected].Index].RA; else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) return _genStarVCompCatalog[catalog[_selected].Index].RA/2730.6666666666666; else
-  if (catalogType()==CAT_DBL_STAR)       return _dblStarCatalog[catalog[_selected].Index].RA; else
-  if (catalogType()==CAT_DBL_STAR_COMP)  return _dblStarCompCatalog[catalog[_selected].Index].RA/2730.6666666666666; else
-  if (catalogType()==CAT_VAR_STAR)       return _varStarCatalog[catalog[_selected].Index].RA; else
-  if (catalogType()==CAT_VAR_STAR_COMP)  return _varStarCompCatalog[catalog[_selected].Index].RA/2730.6666666666666; else
-  if (catalogType()==CAT_DSO)            return _dsoCatalog[catalog[_selected].Index].RA; else
-  if (catalogType()==CAT_DSO_COMP)       return _dsoCompCatalog[catalog[_selected].Index].RA/2730.6666666666666; else
-  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].RA/2730.6666666666666; else return 0;
+  return _recRah;
+}
+
+// RA in hours as stored in the record, at the catalog's epoch
+double CatMgr::recordRah() {
+  if (_selected<0) return 0;
+  CAT_LAYOUT_CALL(catalogType(),_rec,0,rah);
 }
 
 // HA in degrees
@@ -393,17 +511,16 @@ void CatMgr::raHMS(uint8_t &h, uint8_t &m, uint8_t &s) {
   s = (int)s1;
 }
 
-// Dec in degrees
+// Dec in degrees, J2000
 double CatMgr::dec() {
-  if (catalogType()==CAT_GEN_STAR)       return _genStarCatalog[catalog[_selected].Index].DE; else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) return _genStarVCompCatalog[catalog[_selected].Index].DE/364.07777777777777; else
-  if (catalogType()==CAT_DBL_STAR)       return _dblStarCatalog[catalog[_selected].Index].DE; else
-  if (catalogType()==CAT_DBL_STAR_COMP)  return _dblStarCompCatalog[catalog[_selected].Index].DE/364.07777777777777; else
-  if (catalogType()==CAT_VAR_STAR)       return _varStarCatalog[catalog[_selected].Index].DE; else
-  if (catalogType()==CAT_VAR_STAR_COMP)  return _varStarCompCatalog[catalog[_selected].Index].DE/364.07777777777777; else
-  if (catalogType()==CAT_DSO)            return _dsoCatalog[catalog[_selected].Index].DE; else
-  if (catalogType()==CAT_DSO_COMP)       return _dsoCompCatalog[catalog[_selected].Index].DE/364.07777777777777; else
-  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].DE/364.07777777777777; else return 0;
+  if (_selected<0) return 0;
+  return _recDec;
+}
+
+// Dec in degrees as stored in the record, at the catalog's epoch
+double CatMgr::recordDec() {
+  if (_selected<0) return 0;
+  CAT_LAYOUT_CALL(catalogType(),_rec,0,dec);
 }
 
 // Declination as degrees, minutes, seconds
@@ -479,7 +596,7 @@ void CatMgr::topocentricToObservedPlace(float *RA, float *Dec) {
     double r=*RA*15.0;
     double d=*Dec;
     EquToHor(r,d,&Alt,&Azm);
-    Alt = Alt+TrueRefrac(Alt) / 60.0;
+    Alt = Alt+skyContext.trueRefrac(Alt) / 60.0;
     HorToEqu(Alt,Azm,&r,&d);
     *RA=r/15.0; *Dec=d;
   }
@@ -489,80 +606,35 @@ void CatMgr::topocentricToObservedPlace(float *RA, float *Dec) {
 // -2 = irregular, -1 = unknown
 float CatMgr::period() {
   if (_selected<0) return -1;
-  float p;
-  if (catalogType()==CAT_VAR_STAR) p=_varStarCatalog[catalog[_selected].Index].Period; else
-  if (catalogType()==CAT_VAR_STAR_COMP) p=_varStarCatalog[catalog[_selected].Index].Period; else return -1;
-  // Period 0.00 to 9.99 days (0 to 999) period 10.0 to 3186.6 days (1000 to 32766), 32766 = Irregular, 32767 = Unknown
-  if ((p>=0)  && (p<=999)) return p/100.0; else
-  if ((p>999) && (p<=32765)) return (p-900)/10.0; else
-  if (p==32766) return -2; else return -1;
+  CAT_LAYOUT_CALL(catalogType(),_rec,-1,period);
 }
 
 // Position angle of double star, in degrees
 // -1 = Unknown
 int CatMgr::positionAngle() {
   if (_selected<0) return -1;
-  int p;
-  if (catalogType()==CAT_DBL_STAR) p=_dblStarCatalog[catalog[_selected].Index].PA; else
-  if (catalogType()==CAT_DBL_STAR_COMP) p=_dblStarCompCatalog[catalog[_selected].Index].PA; else return -1;
-  // Position angle 0 to 360 degrees, 361 = Unknown
-  if (p==361) return -1; else return p;
+  CAT_LAYOUT_CALL(catalogType(),_rec,-1,positionAngle);
 }
 
 // Separation of double star, in arc-seconds
 // -1 = Unknown
 float CatMgr::separation() {
   if (_selected<0) return -1;
-  float s;
-  if (catalogType()==CAT_DBL_STAR) s=_dblStarCatalog[catalog[_selected].Index].Sep/10.0; else
-  if (catalogType()==CAT_DBL_STAR_COMP) s=_dblStarCompCatalog[catalog[_selected].Index].Sep/10.0; else return -1;
-  // Seperation 0 to 999.8 (0 to 9998) arc-seconds, 9999=unknown
-  if (abs(s-999.9)<0.01) return -1; else return s;
+  CAT_LAYOUT_CALL(catalogType(),_rec,-1,separation);
 }
 
 // Magnitude of an object
 // 99.9 = Unknown
 float CatMgr::magnitude() {
   if (_selected<0) return 99.9;
-  if (catalogType()==CAT_GEN_STAR)       return _genStarCatalog[catalog[_selected].Index].Mag/100.0; else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) { int m=_genStarVCompCatalog[catalog[_selected].Index].Mag; if (m==255) return 99.9; else return (m/10.0)-2.5; } else
-  if (catalogType()==CAT_DBL_STAR)       return _dblStarCatalog[catalog[_selected].Index].Mag/100.0; else
-  if (catalogType()==CAT_DBL_STAR_COMP)  { int m=_dblStarCompCatalog[catalog[_selected].Index].Mag; if (m==255) return 99.9; else return (m/10.0)-2.5; } else
-  if (catalogType()==CAT_VAR_STAR)       return _varStarCatalog[catalog[_selected].Index].Mag/100.0; else
-  if (catalogType()==CAT_VAR_STAR_COMP)  { int m=_varStarCompCatalog[catalog[_selected].Index].Mag; if (m==255) return 99.9; else return (m/10.0)-2.5; } else
-  if (catalogType()==CAT_DSO)            return _dsoCatalog[catalog[_selected].Index].Mag/100.0; else
-  if (catalogType()==CAT_DSO_COMP)       { int m=_dsoCompCatalog[catalog[_selected].Index].Mag; if (m==255) return 99.9; else return (m/10.0)-2.5; } else
-  if (catalogType()==CAT_DSO_VCOMP)      { int m=_dsoVCompCatalog[catalog[_selected].Index].Mag; if (m==255) return 99.9; else return (m/10.0)-2.5; } else return 99.9;
+  CAT_LAYOUT_CALL(catalogType(),_rec,99.9,mag);
 }
 
 // Secondary magnitude of an star.  For double stars this is the magnitude of the secondary.  For variables this is the minimum brightness.
 // 99.9 = Unknown
 float CatMgr::magnitude2() {
-  if (_selected < 0) {
-    return 99.9;
-  }
-  
-  if (catalogType() == CAT_DBL_STAR) {
-    return _dblStarCatalog[catalog[_selected].Index].Mag2 / 100.0;
-  } else if (catalogType() == CAT_DBL_STAR_COMP) {
-    int m = _dblStarCompCatalog[catalog[_selected].Index].Mag2;
-    if (m == 255) {
-      return 99.9;
-    } else {
-      return (m / 10.0) - 2.5;
-    }
-  } else if (catalogType() == CAT_VAR_STAR) {
-    return _varStarCatalog[catalog[_selected].Index].Mag2 / 100.0;
-  } else if (catalogType() == CAT_VAR_STAR_COMP) {
-    int m = _varStarCompCatalog[catalog[_selected].Index].Mag2;
-    if (m == 255) {
-      return 99.9;
-    } else {
-      return (m / 10.0) - 2.5;
-    }
-  }
-  
-  return 99.9;
+  if (_selected<0) return 99.9;
+  CAT_LAYOUT_CALL(catalogType(),_rec,99.9,mag2);
 }
 
 
@@ -570,15 +642,7 @@ float CatMgr::magnitude2() {
 // 89 = Unknown
 byte CatMgr::constellation() {
   if (_selected<0) return 89;
-  if (catalogType()==CAT_GEN_STAR)       return _genStarCatalog[catalog[_selected].Index].Cons; else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) return _genStarVCompCatalog[catalog[_selected].Index].Cons; else
-  if (catalogType()==CAT_DBL_STAR)       return _dblStarCatalog[catalog[_selected].Index].Cons; else
-  if (catalogType()==CAT_DBL_STAR_COMP)  return _dblStarCompCatalog[catalog[_selected].Index].Cons; else
-  if (catalogType()==CAT_VAR_STAR)       return _varStarCatalog[catalog[_selected].Index].Cons; else
-  if (catalogType()==CAT_VAR_STAR_COMP)  return _varStarCompCatalog[catalog[_selected].Index].Cons; else
-  if (catalogType()==CAT_DSO)            return _dsoCatalog[catalog[_selected].Index].Cons; else
-  if (catalogType()==CAT_DSO_COMP)       return _dsoCompCatalog[catalog[_selected].Index].Cons; else
-  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].Cons; else return 89;
+  CAT_LAYOUT_CALL(catalogType(),_rec,89,cons);
 }
 
 // Constellation string
@@ -594,15 +658,7 @@ const char* CatMgr::constellationCodeToStr(int code) {
 // Object type code
 byte CatMgr::objectType() {
   if (_selected<0) return -1;
-  if (catalogType()==CAT_GEN_STAR)       return 2; else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) return 2; else
-  if (catalogType()==CAT_DBL_STAR)       return 2; else
-  if (catalogType()==CAT_DBL_STAR_COMP)  return 2; else
-  if (catalogType()==CAT_VAR_STAR)       return 2; else
-  if (catalogType()==CAT_VAR_STAR_COMP)  return 2; else
-  if (catalogType()==CAT_DSO)            return _dsoCatalog[catalog[_selected].Index].Obj_type; else
-  if (catalogType()==CAT_DSO_COMP)       return _dsoCompCatalog[catalog[_selected].Index].Obj_type; else
-  if (catalogType()==CAT_DSO_VCOMP)      return _dsoVCompCatalog[catalog[_selected].Index].Obj_type; else return -1;
+  CAT_LAYOUT_CALL(catalogType(),_rec,-1,objType);
 }
 
 // Object type string
@@ -619,33 +675,40 @@ const char* CatMgr::objectTypeCodeToStr(int code) {
 // Object name code (encoded by Has_name.)  Returns -1 if the object doesn't have a name code.
 long CatMgr::objectName() {
   if (_selected<0) return -1;
+  switch (catalogType()) {
+    case CAT_GEN_STAR:       return elementCode<gen_star_t>(false);
+    case CAT_GEN_STAR_VCOMP: return elementCode<gen_star_vcomp_t>(false);
+    case CAT_DBL_STAR:       return elementCode<dbl_star_t>(false);
+    case CAT_DBL_STAR_COMP:  return elementCode<dbl_star_comp_t>(false);
+    case CAT_VAR_STAR:       return elementCode<var_star_t>(false);
+    case CAT_VAR_STAR_COMP:  return elementCode<var_star_comp_t>(false);
+    case CAT_DSO:            return elementCode<dso_t>(false);
+    case CAT_DSO_COMP:       return elementCode<dso_comp_t>(false);
+    case CAT_DSO_VCOMP:      return elementCode<dso_vcomp_t>(false);
+    default:                 return -1;
+  }
+}
 
-  // does it have a name? if not just return
-  if (catalogType()==CAT_GEN_STAR)       { if (!_genStarCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) { if (!_genStarVCompCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_DBL_STAR)       { if (!_dblStarCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_DBL_STAR_COMP)  { if (!_dblStarCompCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_VAR_STAR)       { if (!_varStarCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_VAR_STAR_COMP)  { if (!_varStarCompCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_DSO)            { if (!_dsoCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_DSO_COMP)       { if (!_dsoCompCatalog[catalog[_selected].Index].Has_name) return -1; } else
-  if (catalogType()==CAT_DSO_VCOMP)      { if (!_dsoVCompCatalog[catalog[_selected].Index].Has_name) return -1; } else return -1;
-
-  // find the code
-  long result=-1;
+// name (or subId) code of the current record, the number of records up to it that have one
+template <typename T> long CatMgr::elementCode(bool isSubId) {
+  typedef CatLayout<T> L;
+
+  // does it have one? if not just return
+  const T &r=*(const T*)_rec;
+  if (isSubId ? !L::hasSubId(r) : !L::hasName(r)) return -1;
+
+  // find the code, SD card catalogs have it indexed
   long j=catalog[_selected].Index;
   if (j>getMaxIndex()) j=-1;
   if (j<0) return -1;
-  if (catalogType()==CAT_GEN_STAR)       { for (long i=0; i<=j; i++) { if (_genStarCatalog[i].Has_name) result++; } } else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) { for (long i=0; i<=j; i++) { if (_genStarVCompCatalog[i].Has_name) result++; } } else
-  if (catalogType()==CAT_DBL_STAR)       { for (long i=0; i<=j; i++) { if (_dblStarCatalog[i].Has_name) result++; } } else
-  if (catalogType()==CAT_DBL_STAR_COMP)  { for (long i=0; i<=j; i++) { if (_dblStarCompCatalog[i].Has_name) result++; } } else
-  if (catalogType()==CAT_VAR_STAR)       { for (long i=0; i<=j; i++) { if (_varStarCatalog[i].Has_name) result++; } } else
-  if (catalogType()==CAT_VAR_STAR_COMP)  { for (long i=0; i<=j; i++) { if (_varStarCompCatalog[i].Has_name) result++; } } else
-  if (catalogType()==CAT_DSO)            { for (long i=0; i<=j; i++) { if (_dsoCatalog[i].Has_name) result++; } } else
-  if (catalogType()==CAT_DSO_COMP)       { for (long i=0; i<=j; i++) { if (_dsoCompCatalog[i].Has_name) result++; } } else
-  if (catalogType()==CAT_DSO_VCOMP)      { for (long i=0; i<=j; i++) { if (_dsoVCompCatalog[i].Has_name) result++; } } else return -1;
-
+  if (catalog[_selected].Objects==NULL) {
+    if (isSubId) return sdCatalog.subIdCode(catalog[_selected].SdIndex,j);
+    return sdCatalog.nameCode(catalog[_selected].SdIndex,j);
+  }
+  const T *records=(const T*)catalog[_selected].Objects;
+  long result=-1;
+  if (isSubId) { for (long i=0; i<=j; i++) { if (L::hasSubId(records[i])) result++; } }
+  else         { for (long i=0; i<=j; i++) { if (L::hasName(records[i])) result++; } }
   return result;
 }
 
@@ -653,22 +716,27 @@ long CatMgr::objectName() {
 const char* CatMgr::objectNameStr() {
   if (_selected<0) return "";
   long elementNum=objectName();
-  if (elementNum>=0) return getElementFromString(catalog[_selected].ObjectNames,elementNum); else return "";
+  if (elementNum<0) return "";
+  if (catalog[_selected].Objects==NULL) return sdCatalog.nameStr(catalog[_selected].SdIndex,elementNum);
+  return getElementFromString(catalog[_selected].ObjectNames,elementNum);
 }
 
 // Object Id
 long CatMgr::primaryId() {
-  long id=-1;
   if (_selected<0) return -1;
-  if (catalogType()==CAT_GEN_STAR)       id=_genStarCatalog[catalog[_selected].Index].Obj_id; else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) id= catalog[_selected].Index+1; else
-  if (catalogType()==CAT_DBL_STAR)       id=_dblStarCatalog[catalog[_selected].Index].Obj_id; else
-  if (catalogType()==CAT_DBL_STAR_COMP)  id=_dblStarCompCatalog[catalog[_selected].Index].Obj_id; else
-  if (catalogType()==CAT_VAR_STAR)       id=_varStarCatalog[catalog[_selected].Index].Obj_id; else
-  if (catalogType()==CAT_VAR_STAR_COMP)  id=_varStarCompCatalog[catalog[_selected].Index].Obj_id; else
-  if (catalogType()==CAT_DSO)            id=_dsoCatalog[catalog[_selected].Index].Obj_id; else
-  if (catalogType()==CAT_DSO_COMP)       id=_dsoCompCatalog[catalog[_selected].Index].Obj_id; else
-  if (catalogType()==CAT_DSO_VCOMP)      id=catalog[_selected].Index+1; else return -1;
+  long id;
+  switch (catalogType()) {
+    case CAT_GEN_STAR:       id=CatLayout<gen_star_t>::primaryId(*(const gen_star_t*)_rec,catalog[_selected].Index); break;
+    case CAT_GEN_STAR_VCOMP: id=CatLayout<gen_star_vcomp_t>::primaryId(*(const gen_star_vcomp_t*)_rec,catalog[_selected].Index); break;
+    case CAT_DBL_STAR:       id=CatLayout<dbl_star_t>::primaryId(*(const dbl_star_t*)_rec,catalog[_selected].Index); break;
+    case CAT_DBL_STAR_COMP:  id=CatLayout<dbl_star_comp_t>::primaryId(*(const dbl_star_comp_t*)_rec,catalog[_selected].Index); break;
+    case CAT_VAR_STAR:       id=CatLayout<var_star_t>::primaryId(*(const var_star_t*)_rec,catalog[_selected].Index); break;
+    case CAT_VAR_STAR_COMP:  id=CatLayout<var_star_comp_t>::primaryId(*(const var_star_comp_t*)_rec,catalog[_selected].Index); break;
+    case CAT_DSO:            id=CatLayout<dso_t>::primaryId(*(const dso_t*)_rec,catalog[_selected].Index); break;
+    case CAT_DSO_COMP:       id=CatLayout<dso_comp_t>::primaryId(*(const dso_comp_t*)_rec,catalog[_selected].Index); break;
+    case CAT_DSO_VCOMP:      id=CatLayout<dso_vcomp_t>::primaryId(*(const dso_vcomp_t*)_rec,catalog[_selected].Index); break;
+    default:                 return -1;
+  }
   if (id<1) return -1;
   return id;
 }
@@ -676,54 +744,33 @@ long CatMgr::primaryId() {
 // Object note code (encoded by Has_note.)  Returns -1 if the object doesn't have a note code.
 long CatMgr::subId() {
   if (_selected<0) return -1;
-
-  // does it have a note? if not just return
-  if (catalogType()==CAT_GEN_STAR)       { if (!_genStarCatalog[catalog[_selected].Index].Has_subId) return -1; } else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) { if (!_genStarVCompCatalog[catalog[_selected].Index].Has_subId) return -1; } else
-  if (catalogType()==CAT_DBL_STAR)       { if (!_dblStarCatalog[catalog[_selected].Index].Has_subId) return -1; } else
-  if (catalogType()==CAT_DBL_STAR_COMP)  { if (!_dblStarCompCatalog[catalog[_selected].Index].Has_subId) return -1; } else
-  if (catalogType()==CAT_VAR_STAR)       { if (!_varStarCatalog[catalog[_selected].Index].Has_subId) return -1; } else
-  if (catalogType()==CAT_VAR_STAR_COMP)  { if (!_varStarCompCatalog[catalog[_selected].Index].Has_subId) return -1; } else
-  if (catalogType()==CAT_DSO)            { if (!_dsoCatalog[catalog[_selected].Index].Has_subId) return -1; } else
-  if (catalogType()==CAT_DSO_COMP)       { if (!_dsoCompCatalog[catalog[_selected].Index].Has_subId) return -1; } else
-  if (catalogType()==CAT_DSO_VCOMP)      { if (!_dsoVCompCatalog[catalog[_selected].Index].Has_subId) return -1; } else return -1;
-
-  // find the code
-  long result=-1;
-  long j=catalog[_selected].Index;
-  if (j>getMaxIndex()) j=-1;
-  if (j<0) return -1;
-  if (catalogType()==CAT_GEN_STAR)       { for (long i=0; i<=j; i++) { if (_genStarCatalog[i].Has_subId) result++; } } else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) { for (long i=0; i<=j; i++) { if (_genStarVCompCatalog[i].Has_subId) result++; } } else
-  if (catalogType()==CAT_DBL_STAR)       { for (long i=0; i<=j; i++) { if (_dblStarCatalog[i].Has_subId) result++; } } else
-  if (catalogType()==CAT_DBL_STAR_COMP)  { for (long i=0; i<=j; i++) { if (_dblStarCompCatalog[i].Has_subId) result++; } } else
-  if (catalogType()==CAT_VAR_STAR)       { for (long i=0; i<=j; i++) { if (_varStarCatalog[i].Has_subId) result++; } } else
-  if (catalogType()==CAT_VAR_STAR_COMP)  { for (long i=0; i<=j; i++) { if (_varStarCompCatalog[i].Has_subId) result++; } } else
-  if (catalogType()==CAT_DSO)            { for (long i=0; i<=j; i++) { if (_dsoCatalog[i].Has_subId) result++; } } else
-  if (catalogType()==CAT_DSO_COMP)       { for (long i=0; i<=j; i++) { if (_dsoCompCatalog[i].Has_subId) result++; } } else
-  if (catalogType()==CAT_DSO_VCOMP)      { for (long i=0; i<=j; i++) { if (_dsoVCompCatalog[i].Has_subId) result++; } } else return -1;
-
-  return result;
+  switch (catalogType()) {
+    case CAT_GEN_STAR:       return elementCode<gen_star_t>(true);
+    case CAT_GEN_STAR_VCOMP: return elementCode<gen_star_vcomp_t>(true);
+    case CAT_DBL_STAR:       return elementCode<dbl_star_t>(true);
+    case CAT_DBL_STAR_COMP:  return elementCode<dbl_star_comp_t>(true);
+    case CAT_VAR_STAR:       return elementCode<var_star_t>(true);
+    case CAT_VAR_STAR_COMP:  return elementCode<var_star_comp_t>(true);
+    case CAT_DSO:            return elementCode<dso_t>(true);
+    case CAT_DSO_COMP:       return elementCode<dso_comp_t>(true);
+    case CAT_DSO_VCOMP:      return elementCode<dso_vcomp_t>(true);
+    default:                 return -1;
+  }
 }
 
 // Object note string
 const char* CatMgr::subIdStr() {
   if (_selected<0) return "";
   long elementNum=subId();
-  if (elementNum>=0) return getElementFromString(catalog[_selected].ObjectSubIds,elementNum); else return "";
+  if (elementNum<0) return "";
+  if (catalog[_selected].Objects==NULL) return sdCatalog.subIdStr(catalog[_selected].SdIndex,elementNum);
+  return getElementFromString(catalog[_selected].ObjectSubIds,elementNum);
 }
 
 // For Bayer designated Stars 0 = Alp, etc. to 23. For Fleemstead designated Stars 25 = '1', etc.
 int CatMgr::bayerFlam() {
   if (_selected<0) return -1;
-  int bf=24;
-  if (catalogType()==CAT_GEN_STAR)       bf=_genStarCatalog[catalog[_selected].Index].BayerFlam; else
-  if (catalogType()==CAT_GEN_STAR_VCOMP) bf=_genStarVCompCatalog[catalog[_selected].Index].BayerFlam; else
-  if (catalogType()==CAT_DBL_STAR)       bf=_dblStarCatalog[catalog[_selected].Index].BayerFlam; else
-  if (catalogType()==CAT_DBL_STAR_COMP)  bf=_dblStarCompCatalog[catalog[_selected].Index].BayerFlam; else
-  if (catalogType()==CAT_VAR_STAR)       bf=_varStarCatalog[catalog[_selected].Index].BayerFlam; else
-  if (catalogType()==CAT_VAR_STAR_COMP)  bf=_varStarCompCatalog[catalog[_selected].Index].BayerFlam; else return -1;
-  if (bf==24) return -1; else return bf;
+  CAT_LAYOUT_CALL(catalogType(),_rec,-1,bayerFlam);
 }
 
 // For Bayer designated Stars return greek letter or Flamsteed designated stars return number
@@ -772,8 +819,13 @@ const char* CatMgr::getElementFromString(const char *data, long elementNum) {
 
 // angular distance from current Equ coords, in degrees
 double CatMgr::DistFromEqu(double RA, double Dec) {
+  return DistFromEqu(ra(),dec(),RA,Dec);
+}
+
+// angular distance between two Equ coords, in degrees
+double CatMgr::DistFromEqu(double RA1, double Dec1, double RA, double Dec) {
   RA=RA/Rad; Dec=Dec/Rad;
-  return acos( sin(dec()/Rad)*sin(Dec) + cos(dec()/Rad)*cos(Dec)*cos(ra()/Rad - RA))*Rad;
+  return acos( sin(Dec1/Rad)*sin(Dec) + cos(Dec1/Rad)*cos(Dec)*cos(RA1/Rad - RA))*Rad;
 }
 
 // convert an HA to RA, in degrees
@@ -788,10 +840,11 @@ void CatMgr::EquToHor(double RA, double Dec, double *Alt, double *Azm) {
   while (HA>=360.0) HA=HA-360.0;
   HA =HA/Rad;
   Dec=Dec/Rad;
-  double SinAlt = (sin(Dec) * _sinLat) + (cos(Dec) * _cosLat * cos(HA));  
+  double sinLat=skyContext.sinLat(), cosLat=skyContext.cosLat();
+  double SinAlt = (sin(Dec) * sinLat) + (cos(Dec) * cosLat * cos(HA));  
   *Alt   = asin(SinAlt);
   double t1=sin(HA);
-  double t2=cos(HA)*_sinLat-tan(Dec)*_cosLat;
+  double t2=cos(HA)*sinLat-tan(Dec)*cosLat;
   *Azm=atan2(t1,t2)*Rad;
   *Azm=*Azm+180.0;
   *Alt = *Alt*Rad;
@@ -804,7 +857,7 @@ void CatMgr::EquToAlt(double RA, double Dec, double *Alt) {
   while (HA>=360.0) HA=HA-360.0;
   HA =HA/Rad;
   Dec=Dec/Rad;
-  double SinAlt = (sin(Dec) * _sinLat) + (cos(Dec) * _cosLat * cos(HA));  
+  double SinAlt = (sin(Dec) * skyContext.sinLat()) + (cos(Dec) * skyContext.cosLat() * cos(HA));  
   *Alt = asin(SinAlt);
   *Alt = *Alt*Rad;
 }
@@ -815,10 +868,11 @@ void CatMgr::HorToEqu(double Alt, double Azm, double *RA, double *Dec) {
   while (Azm>=360.0) Azm=Azm-360.0;
   Alt  = Alt/Rad;
   Azm  = Azm/Rad;
-  double SinDec = (sin(Alt) * _sinLat) + (cos(Alt) * _cosLat * cos(Azm));  
+  double sinLat=skyContext.sinLat(), cosLat=skyContext.cosLat();
+  double SinDec = (sin(Alt) * sinLat) + (cos(Alt) * cosLat * cos(Azm));  
   *Dec = asin(SinDec); 
   double t1=sin(Azm);
-  double t2=cos(Azm)*_sinLat-tan(Alt)*_cosLat;
+  double t2=cos(Azm)*sinLat-tan(Alt)*cosLat;
   double HA=atan2(t1,t2)*Rad;
   HA=HA+180.0;
   *Dec = *Dec*Rad;
@@ -828,15 +882,4 @@ void CatMgr::HorToEqu(double Alt, double Azm, double *RA, double *Dec) {
   *RA=(lstDegs()-HA);
 }
 
-// returns the amount of refraction (in arcminutes) at the given true altitude (degrees), pressure (millibars), and temperature (celsius)
-double CatMgr::TrueRefrac(double Alt, double Pressure, double Temperature) {
-  double TPC=(Pressure/1010.0) * (283.0/(273.0+Temperature));
-  double r=( ( 1.02*cot( (Alt+(10.3/(Alt+5.11)))/Rad ) ) ) * TPC;  if (r<0.0) r=0.0;
-  return r;
-}
-
-double CatMgr::cot(double n) {
-  return 1.0/tan(n);
-}
-
 CatMgr cat_mgr;
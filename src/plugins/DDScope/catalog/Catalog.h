@@ -18,6 +18,9 @@ const unsigned int FM_DBL_MIN_SEP    = 64;
 const unsigned int FM_DBL_MAX_SEP    = 128;
 const unsigned int FM_VAR_MAX_PER    = 256;
 
+// catalog title buffer size, titles from the SD card are up to 31 characters
+const unsigned int CAT_TITLE_SIZE    = 32;
+
 enum CAT_TYPES {CAT_NONE, CAT_GEN_STAR, CAT_GEN_STAR_VCOMP, CAT_DBL_STAR, CAT_DBL_STAR_COMP, CAT_VAR_STAR, CAT_VAR_STAR_COMP, CAT_DSO, CAT_DSO_COMP, CAT_DSO_VCOMP};
 
 class CatMgr {
@@ -27,6 +30,7 @@ class CatMgr {
     void        setLstT0(double lstT0);
     void        setLastTeleEqu(double RA, double Dec);
     bool        isInitialized();
+    int         addSdCatalogs();
 
 // time
     double      lstDegs();
@@ -60,6 +64,8 @@ class CatMgr {
     long        getMaxIndex();
     bool        incIndex();
     bool        decIndex();
+    bool        selectRecord(int cat, long index);
+    bool        recordCoords(int cat, long index, double &raHours, double &decDegs);
 
 // get catalog contents
     int         epoch();
@@ -105,13 +111,8 @@ class CatMgr {
     const char* bayerFlamStr();
 
 private:
-    double _lat=-10000;
-    double _cosLat=0;
-    double _sinLat=0;
-    double _lstT0=0;
     double _lastTeleRA=0;
     double _lastTeleDec=0;
-    unsigned long _lstMillisT0=0;
     
     int _fm=FM_NONE;
     int _fm_con=0;
@@ -123,17 +124,29 @@ private:
     double _fm_var_max=100000.0;
     
     int _selected=0;
-
-    bool isFiltered();
+    unsigned char _recBuf[32]; // current record of an SD card catalog
+
+    const void *_rec=NULL;      // current record of the selected catalog
+    double _recRah=0;           // its coordinates, J2000
+    double _recDec=0;
+
+    template <typename T> bool isFiltered(const T &r);
+    template <typename T> bool scan(int step);
+    template <typename T> bool scanZones(int step, const bool *zones);
+    bool nearbyZones(bool *zones);
+    bool scan(int step);
+    template <typename T> long elementCode(bool isSubId);
+    void seekRecord();
+    const void* record(long index, unsigned char *buf);
+    double recordRah();
+    double recordDec();
 
     const char* getElementFromString(const char *data, long elementNum);
     double DistFromEqu(double RA, double Dec);
+    double DistFromEqu(double RA1, double Dec1, double RA, double Dec);
     
     void EquToAlt(double RA, double Dec, double *Alt);
     void HorToEqu(double Alt, double Azm, double *RA, double *Dec);
-    double TrueRefrac(double Alt, double Pressure=1010.0, double Temperature=10.0);
-
-    double cot(double n);
 };
 
 extern CatMgr cat_mgr;
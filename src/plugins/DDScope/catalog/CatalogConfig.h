@@ -15,7 +15,17 @@
 // ngc_select_c.h // for a selection of the brighter objects from the ngc catalog at somewhat reduced accuracy.
 
 // Note: You can navigate to and open the SmartHandController's catalogs directory in the Arduino IDE to see the available catalogs.
-#if defined(ESP32)
+
+//=====================================================================================
+// COMPILE-TIME SWITCH to read all catalogs from catalogs.bin on the SD card (see SdCatalog.h)
+// instead of flash, build it with tools/mkCatalogBin.py in the same order as the table below.
+// Catalogs found on the SD card are always appended after the ones compiled in.
+//#define CATALOGS_ON_SD  // Uncomment this line to leave the catalogs out of flash
+//=====================================================================================
+
+#if defined(CATALOGS_ON_SD)
+  // nothing compiled in
+#elif defined(ESP32)
   #include "../libCatalogs/stars.h"           // Catalog of 408 bright stars
   #include "../libCatalogs/stf.h"             // Struve STF catalog, limited to 4313 double stars
   #include "../libCatalogs/stt.h"             // Struve STT catalog, limited to 766 double stars
@@ -54,10 +64,12 @@
 #endif
 
 // Note: There should be a matching line below for every catalog #included above (catalogs appear in the menus in the order the appear below):
-catalog_t catalog[] = {
+// Note: The table is sized for MaxCatalogs, the unused entries are filled from the SD card by CatMgr::addSdCatalogs().
+catalog_t catalog[MaxCatalogs] = {
 // Note: Alignment always uses the first catalog!
 // Note: Sub Menu items should be grouped together in this list!
 // Sub Menu     Title               Prefix               Num records   Catalog data  Catalog name string  Catalog subId string  Type                Epoch
+#ifndef CATALOGS_ON_SD
   {"Stars>"     Cat_Stars_Title,    Cat_Stars_Prefix,    NUM_STARS,    Cat_Stars,    Cat_Stars_Names,     Cat_Stars_SubId,      Cat_Stars_Type,     2000, 0},
  // {"Stars>"     Cat_STF_Title,      Cat_STF_Prefix,      NUM_STF,      Cat_STF,      Cat_STF_Names,       Cat_STF_SubId,        Cat_STF_Type,       2000, 0},
  // {"Stars>"     Cat_STT_Title,      Cat_STT_Prefix,      NUM_STT,      Cat_STT,      Cat_STT_Names,       Cat_STT_SubId,        Cat_STT_Type,       2000, 0},
@@ -69,5 +81,9 @@ catalog_t catalog[] = {
  // {"Deep Sky>"  Cat_Collinder_Title,Cat_Collinder_Prefix,NUM_COLLINDER,Cat_Collinder,Cat_Collinder_Names, Cat_Collinder_SubId,  Cat_Collinder_Type, 2000, 0},
  // {"Deep Sky>"  Cat_NGC_Title,      Cat_NGC_Prefix,      NUM_NGC,      Cat_NGC,      Cat_NGC_Names,       Cat_NGC_SubId,        Cat_NGC_Type,       2000, 0},
   {"IndexCat>"  Cat_IC_Title,       Cat_IC_Prefix,       NUM_IC,       Cat_IC,       Cat_IC_Names,        Cat_IC_SubId,         Cat_IC_Type,        2000, 0},
+#endif
   {             "",                 "",                  0,            NULL,         NULL,                NULL,                 CAT_NONE,           0,    0}
 };
+
+// Common name index for the catalogs above, regenerate with tools/mkNameIndex.py when a catalog changes
+#include "../libCatalogs/name_index.h"
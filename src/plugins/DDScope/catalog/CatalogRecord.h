@@ -0,0 +1,150 @@
+// =====================================================
+// CatalogRecord.h
+//
+// Field decoders for each record layout in CatalogTypes.h. CatLayout<T>
+// has the same set of static functions for every layout so code templated
+// on the record type compiles to direct field reads with no per record
+// switch on CAT_TYPES, CatMgr selects the layout once per catalog scan.
+
+#pragma once
+
+#include <Arduino.h>
+#include "CatalogTypes.h"
+
+// magnitude stored in tenths offset by 2.5, 255 = Unknown
+inline float catCompMag(int m) { if (m==255) return 99.9; else return (m/10.0)-2.5; }
+
+// Period 0.00 to 9.99 days (0 to 999) period 10.0 to 3186.6 days (1000 to 32766), 32766 = Irregular, 32767 = Unknown
+inline float catPeriod(float p) {
+  if ((p>=0)  && (p<=999)) return p/100.0; else
+  if ((p>999) && (p<=32765)) return (p-900)/10.0; else
+  if (p==32766) return -2; else return -1;
+}
+
+// Position angle 0 to 360 degrees, 361 = Unknown
+inline int catPositionAngle(int p) { if (p==361) return -1; else return p; }
+
+// Seperation 0 to 999.8 (0 to 9998) arc-seconds, 9999=unknown
+inline float catSeparation(float s) { if (abs(s-999.9)<0.01) return -1; else return s; }
+
+// coordinates as float hours/degrees, magnitude in hundredths
+template <typename T> struct CatFullCoords {
+  static double rah(const T &r) { return r.RA; }
+  static double dec(const T &r) { return r.DE; }
+  static float  mag(const T &r) { return r.Mag/100.0; }
+};
+
+// coordinates scaled to 16 bit integers, magnitude in tenths
+template <typename T> struct CatCompCoords {
+  static double rah(const T &r) { return r.RA/2730.6666666666666; }
+  static double dec(const T &r) { return r.DE/364.07777777777777; }
+  static float  mag(const T &r) { return catCompMag(r.Mag); }
+};
+
+// fields common to the deep sky object layouts
+template <typename T> struct CatDso {
+  static const bool IsDso=true;
+  static const bool IsDblStar=false;
+  static const bool IsVarStar=false;
+  static bool  hasName(const T &r)   { return r.Has_name; }
+  static bool  hasSubId(const T &r)  { return r.Has_subId; }
+  static byte  cons(const T &r)      { return r.Cons; }
+  static byte  objType(const T &r)   { return r.Obj_type; }
+  static int   bayerFlam(const T &)  { return -1; }
+  static float mag2(const T &)       { return 99.9; }
+  static float period(const T &)     { return -1; }
+  static int   positionAngle(const T &) { return -1; }
+  static float separation(const T &) { return -1; }
+};
+
+// fields common to the star layouts
+template <typename T> struct CatStar {
+  static const bool IsDso=false;
+  static const bool IsDblStar=false;
+  static const bool IsVarStar=false;
+  static bool  hasName(const T &r)   { return r.Has_name; }
+  static bool  hasSubId(const T &r)  { return r.Has_subId; }
+  static byte  cons(const T &r)      { return r.Cons; }
+  static byte  objType(const T &)    { return 2; }
+  static int   bayerFlam(const T &r) { int bf=r.BayerFlam; if (bf==24) return -1; else return bf; }
+  static float mag2(const T &)       { return 99.9; }
+  static float period(const T &)     { return -1; }
+  static int   positionAngle(const T &) { return -1; }
+  static float separation(const T &) { return -1; }
+};
+
+template <typename T> struct CatLayout;
+
+template <> struct CatLayout<dso_t> : CatFullCoords<dso_t>, CatDso<dso_t> {
+  static const CAT_TYPES Type=CAT_DSO;
+  static long primaryId(const dso_t &r, long) { return r.Obj_id; }
+};
+
+template <> struct CatLayout<dso_comp_t> : CatCompCoords<dso_comp_t>, CatDso<dso_comp_t> {
+  static const CAT_TYPES Type=CAT_DSO_COMP;
+  static long primaryId(const dso_comp_t &r, long) { return r.Obj_id; }
+};
+
+template <> struct CatLayout<dso_vcomp_t> : CatCompCoords<dso_vcomp_t>, CatDso<dso_vcomp_t> {
+  static const CAT_TYPES Type=CAT_DSO_VCOMP;
+  static long primaryId(const dso_vcomp_t &, long index) { return index+1; }
+};
+
+template <> struct CatLayout<gen_star_t> : CatFullCoords<gen_star_t>, CatStar<gen_star_t> {
+  static const CAT_TYPES Type=CAT_GEN_STAR;
+  static long primaryId(const gen_star_t &r, long) { return r.Obj_id; }
+};
+
+template <> struct CatLayout<gen_star_vcomp_t> : CatCompCoords<gen_star_vcomp_t>, CatStar<gen_star_vcomp_t> {
+  static const CAT_TYPES Type=CAT_GEN_STAR_VCOMP;
+  static long primaryId(const gen_star_vcomp_t &, long index) { return index+1; }
+};
+
+template <> struct CatLayout<dbl_star_t> : CatFullCoords<dbl_star_t>, CatStar<dbl_star_t> {
+  static const CAT_TYPES Type=CAT_DBL_STAR;
+  static const bool IsDblStar=true;
+  static long  primaryId(const dbl_star_t &r, long) { return r.Obj_id; }
+  static float mag2(const dbl_star_t &r)          { return r.Mag2/100.0; }
+  static int   positionAngle(const dbl_star_t &r) { return catPositionAngle(r.PA); }
+  static float separation(const dbl_star_t &r)    { return catSeparation(r.Sep/10.0); }
+};
+
+template <> struct CatLayout<dbl_star_comp_t> : CatCompCoords<dbl_star_comp_t>, CatStar<dbl_star_comp_t> {
+  static const CAT_TYPES Type=CAT_DBL_STAR_COMP;
+  static const bool IsDblStar=true;
+  static long  primaryId(const dbl_star_comp_t &r, long) { return r.Obj_id; }
+  static float mag2(const dbl_star_comp_t &r)          { return catCompMag(r.Mag2); }
+  static int   positionAngle(const dbl_star_comp_t &r) { return catPositionAngle(r.PA); }
+  static float separation(const dbl_star_comp_t &r)    { return catSeparation(r.Sep/10.0); }
+};
+
+template <> struct CatLayout<var_star_t> : CatFullCoords<var_star_t>, CatStar<var_star_t> {
+  static const CAT_TYPES Type=CAT_VAR_STAR;
+  static const bool IsVarStar=true;
+  static long  primaryId(const var_star_t &r, long) { return r.Obj_id; }
+  static float mag2(const var_star_t &r)   { return r.Mag2/100.0; }
+  static float period(const var_star_t &r) { return catPeriod(r.Period); }
+};
+
+template <> struct CatLayout<var_star_comp_t> : CatCompCoords<var_star_comp_t>, CatStar<var_star_comp_t> {
+  static const CAT_TYPES Type=CAT_VAR_STAR_COMP;
+  static const bool IsVarStar=true;
+  static long  primaryId(const var_star_comp_t &r, long) { return r.Obj_id; }
+  static float mag2(const var_star_comp_t &r)   { return catCompMag(r.Mag2); }
+  static float period(const var_star_comp_t &r) { return catPeriod(r.Period); }
+};
+
+// calls CatLayout<T>::fn(record, ...) with T the record layout of catalog type, else returns notFound
+#define CAT_LAYOUT_CALL(type, record, notFound, fn, ...) \
+  switch (type) { \
+    case CAT_GEN_STAR:       return CatLayout<gen_star_t>::fn(*(const gen_star_t*)(record), ##__VA_ARGS__); \
+    case CAT_GEN_STAR_VCOMP: return CatLayout<gen_star_vcomp_t>::fn(*(const gen_star_vcomp_t*)(record), ##__VA_ARGS__); \
+    case CAT_DBL_STAR:       return CatLayout<dbl_star_t>::fn(*(const dbl_star_t*)(record), ##__VA_ARGS__); \
+    case CAT_DBL_STAR_COMP:  return CatLayout<dbl_star_comp_t>::fn(*(const dbl_star_comp_t*)(record), ##__VA_ARGS__); \
+    case CAT_VAR_STAR:       return CatLayout<var_star_t>::fn(*(const var_star_t*)(record), ##__VA_ARGS__); \
+    case CAT_VAR_STAR_COMP:  return CatLayout<var_star_comp_t>::fn(*(const var_star_comp_t*)(record), ##__VA_ARGS__); \
+    case CAT_DSO:            return CatLayout<dso_t>::fn(*(const dso_t*)(record), ##__VA_ARGS__); \
+    case CAT_DSO_COMP:       return CatLayout<dso_comp_t>::fn(*(const dso_comp_t*)(record), ##__VA_ARGS__); \
+    case CAT_DSO_VCOMP:      return CatLayout<dso_vcomp_t>::fn(*(const dso_vcomp_t*)(record), ##__VA_ARGS__); \
+    default:                 return notFound; \
+  }
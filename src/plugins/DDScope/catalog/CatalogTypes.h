@@ -16,19 +16,21 @@
 // have to be in sync with the extraction scripts.
 
 // Struct for catalog header
+// Catalogs read from the SD card (see SdCatalog.h) have Objects, ObjectNames and ObjectSubIds NULL
 typedef struct {
-  const char           Title[32];
+  char                 Title[32];
   const char*          Prefix;
-  const unsigned short NumObjects;
+  unsigned long        NumObjects;
   const void*          Objects;
   const char*          ObjectNames;
   const char*          ObjectSubIds;
   CAT_TYPES            CatalogType;
   int                  Epoch;
   long                 Index;
+  int                  SdIndex;      // directory entry in the SD card catalog container
 } catalog_t;
 
-#pragma pack(1)
+#pragma pack(push, 1) // up to the pack(pop) at the end of this file
 
 // Struct for Deep Space Objects (Messier, Herschel, ..etc.)
 typedef struct {
@@ -148,3 +150,65 @@ typedef struct {
   const unsigned short RA;
   const signed   short DE;
 } var_star_comp_t; // compact, 12 bytes per record
+
+// ----------------------------------------------------------
+// Common name index, generated by tools/mkNameIndex.py into libCatalogs/name_index.h
+
+// Struct for one named object, sorted by the keypad digits of its name
+typedef struct {
+  const unsigned short Name;    // offset of the name in the section's ';' separated name string
+  const unsigned short Record;  // record index in the catalog, or row in mod1_treasure.csv
+} name_idx_t; // 4 bytes per record
+
+// Struct for coordinates of objects that are not in a compiled in catalog
+typedef struct {
+  const float          RA;      // J2000 hours
+  const float          DE;      // J2000 degrees
+} name_idx_coord_t; // 8 bytes per record
+
+// Struct for the name index of one catalog
+typedef struct {
+  const void*              Objects;     // catalog records this section belongs to, NULL for mod1_treasure.csv
+  CAT_TYPES                CatalogType; // CAT_NONE if shared by all variants of the catalog
+  const char*              Names;
+  const name_idx_t*        Entries;
+  const name_idx_coord_t*  Coords;      // only for sections without catalog records
+  const unsigned short     NumEntries;
+} name_idx_section_t;
+
+extern const name_idx_section_t NameIdx_Sections[];
+
+// ----------------------------------------------------------
+// SD card catalog container (catalogs.bin), generated by tools/mkCatalogBin.py
+// All values little endian, file offsets from the start of the file.
+
+// Struct for the container header
+typedef struct {
+  char           Magic[4];      // "DDCB"
+  uint16_t       Version;       // SD_CAT_VERSION
+  uint16_t       NumCatalogs;   // directory entries following the header
+  uint32_t       DirSize;       // bytes per directory entry
+  uint32_t       Reserved;
+} cat_bin_header_t; // 16 bytes
+
+// Struct for one catalog's directory entry
+typedef struct {
+  char           Title[32];
+  uint8_t        CatalogType;   // CAT_TYPES, records are stored in that type's struct layout above
+  uint8_t        RecordSize;
+  int16_t        Epoch;
+  uint32_t       NumObjects;
+  uint32_t       Records;       // page aligned, a record never crosses an SD_CAT_PAGE_SIZE page
+  uint32_t       Prefix;        // ';' separated string, same as Cat_X_Prefix
+  uint16_t       PrefixLen;
+  uint32_t       Names;         // ';' separated string, same as Cat_X_Names
+  uint32_t       SubIds;        // ';' separated string, same as Cat_X_SubId
+  uint32_t       NameIdx;       // NumObjects name codes, each record's element number in Names or -1
+  uint32_t       SubIdIdx;      // NumObjects subId codes, as above in SubIds
+  uint32_t       NameOffsets;   // offset from Names of each element, indexed by name code
+  uint32_t       SubIdOffsets;  // offset from SubIds of each element, indexed by subId code
+  uint32_t       Zones;         // 25 indexes into ZoneRecords, where each RA hour starts and the end
+  uint32_t       ZoneRecords;   // NumObjects record numbers by RA hour, in record order within an hour
+} cat_bin_dir_t; // 82 bytes
+
+#pragma pack(pop)
@@ -0,0 +1,185 @@
+// =====================================================
+// CsvIndex.cpp
+//
+// The rows live in a caller supplied buffer (EXTMEM on the Teensy 4.1): the
+// records first, then the string table, the same order as in the index file so
+// a load is a single read. While building, the strings are collected after room
+// for _maxRows records and moved down once the row count is known.
+
+#include "CsvIndex.h"
+#include "src/Common.h"
+
+// modify time of a file as seconds since 1970, 0 if the file system has none
+static uint32_t modifyTime(File &f) {
+  DateTimeFields t;
+  if (!f.getModifyTime(t)) return 0;
+  return makeTime(t);
+}
+
+CsvIndex::CsvIndex(const char *csvName, const char *idxName, uint8_t numFields, CsvIdxParser parser,
+                   uint8_t *buf, uint32_t bufSize, uint16_t maxRows) {
+  _csvName = csvName;
+  _idxName = idxName;
+  _numFields = numFields > CSV_IDX_MAX_FIELDS ? CSV_IDX_MAX_FIELDS : numFields;
+  _parser = parser;
+  _buf = buf;
+  _bufSize = bufSize;
+  _maxRows = maxRows;
+}
+
+bool CsvIndex::load() {
+  if (_csvName == NULL) return _loaded;
+  File csv = SD.open(_csvName, FILE_READ);
+  if (!csv) { VF("MSG: CsvIndex, no "); VL(_csvName); invalidate(); return false; }
+  uint32_t csvSize = csv.size();
+  uint32_t csvTime = modifyTime(csv);
+
+  // same CSV as the rows already in RAM
+  if (_loaded && csvSize == _csvSize && csvTime == _csvTime) { csv.close(); return true; }
+
+  if (readIndex(csvSize, csvTime)) {
+    VF("MSG: CsvIndex, "); V(_idxName); VF(" loaded with "); V(_count); VLF(" rows");
+  } else {
+    if (!build(csv)) { csv.close(); invalidate(); return false; }
+    VF("MSG: CsvIndex, "); V(_csvName); VF(" indexed with "); V(_count); VLF(" rows");
+    writeIndex(csvSize, csvTime);
+  }
+  csv.close();
+
+  _csvSize = csvSize;
+  _csvTime = csvTime;
+  _loaded = true;
+  return true;
+}
+
+// field f of a row, "" if the row or field doesn't exist
+const char* CsvIndex::field(uint16_t row, uint8_t f) {
+  if (row >= _count || f >= _numFields) return "";
+  return &_strings[rec(row)->Field[f]];
+}
+
+// support functions
+
+// read the index file if it was built from this CSV
+bool CsvIndex::readIndex(uint32_t csvSize, uint32_t csvTime) {
+  csv_idx_header_t header;
+
+  File idx = SD.open(_idxName, FILE_READ);
+  if (!idx) return false;
+  bool ok = idx.read(&header, sizeof(header)) == sizeof(header) &&
+            strncmp(header.Magic, "DDCX", 4) == 0 &&
+            header.Version == CSV_IDX_VERSION &&
+            header.NumFields == _numFields &&
+            header.RecordSize == sizeof(csv_idx_rec_t) &&
+            header.CsvSize == csvSize && header.CsvTime == csvTime &&
+            header.NumRows <= _maxRows &&
+            header.NumRows*sizeof(csv_idx_rec_t) + header.StringsSize <= _bufSize;
+  if (ok) {
+    uint32_t len = header.NumRows*sizeof(csv_idx_rec_t) + header.StringsSize;
+    ok = (uint32_t)idx.read(_buf, len) == len;
+  }
+  idx.close();
+  if (!ok) return false;
+
+  _count = header.NumRows;
+  _strings = (char*)&_buf[_count*sizeof(csv_idx_rec_t)];
+  _stringsSize = header.StringsSize;
+  return true;
+}
+
+// parse the whole CSV into the buffer
+bool CsvIndex::build(File &csv) {
+  char block[CSV_IDX_BLOCK];
+  char line[CSV_IDX_LINE_LEN];
+  int  lineLen = 0;
+
+  if (!csv.seek(0)) return false;
+  begin();
+  bool room = true;
+  int n;
+  while (room && (n = csv.read(block, sizeof(block))) > 0) {
+    for (int i = 0; i < n && room; i++) {
+      char c = block[i];
+      if (c == '\n') {
+        line[lineLen] = 0;
+        room = addRow(line);
+        lineLen = 0;
+      } else if (lineLen < CSV_IDX_LINE_LEN - 1) line[lineLen++] = c; // longer lines are truncated
+    }
+  }
+  // last line without a newline
+  if (room && lineLen > 0) { line[lineLen] = 0; addRow(line); }
+  end();
+  return true;
+}
+
+void CsvIndex::begin() {
+  _count = 0;
+  _strings = (char*)&_buf[_maxRows*sizeof(csv_idx_rec_t)];
+  _stringsSize = 0;
+  _loaded = false;
+}
+
+void CsvIndex::end() {
+  // records and strings contiguous, as in the index file
+  char *strings = (char*)&_buf[_count*sizeof(csv_idx_rec_t)];
+  memmove(strings, _strings, _stringsSize);
+  _strings = strings;
+  if (_csvName == NULL) _loaded = true;
+}
+
+// split a line into the string table and add its record, false if the buffer is full
+bool CsvIndex::addRow(char *line) {
+  int len = strlen(line);
+  if (len > 0 && line[len - 1] == '\r') line[--len] = 0;
+  if (len == 0) return true; // blank line
+
+  if (_count >= _maxRows ||
+      _maxRows*sizeof(csv_idx_rec_t) + _stringsSize + len + _numFields > _bufSize ||
+      _stringsSize + len + _numFields > 0xFFFF) {
+    VF("MSG: CsvIndex, "); V(_idxName); VF(" has more than "); V(_count); VLF(" rows, rest ignored");
+    return false;
+  }
+
+  csv_idx_rec_t *r = rec(_count);
+  char *field[CSV_IDX_MAX_FIELDS];
+  char *p = line;
+  for (int f = 0; f < _numFields; f++) {
+    char *end = (f < _numFields - 1) ? strchr(p, ';') : NULL;
+    int fieldLen = end ? end - p : strlen(p);
+
+    r->Field[f] = _stringsSize;
+    field[f] = &_strings[_stringsSize];
+    memcpy(field[f], p, fieldLen);
+    field[f][fieldLen] = 0;
+    _stringsSize += fieldLen + 1;
+
+    p = end ? end + 1 : p + fieldLen; // missing fields are empty
+  }
+  for (int f = _numFields; f < CSV_IDX_MAX_FIELDS; f++) r->Field[f] = r->Field[0];
+
+  r->RA = 0; r->DE = 0; r->Mag = 99.9;
+  if (!_parser(field, r)) { VF("MSG: CsvIndex, bad coordinates in "); VL(field[0]); }
+  _count++;
+  return true;
+}
+
+// save the rows for the next load, on failure they still work from RAM
+void CsvIndex::writeIndex(uint32_t csvSize, uint32_t csvTime) {
+  csv_idx_header_t header;
+  memcpy(header.Magic, "DDCX", 4);
+  header.Version = CSV_IDX_VERSION;
+  header.NumFields = _numFields;
+  header.RecordSize = sizeof(csv_idx_rec_t);
+  header.CsvSize = csvSize;
+  header.CsvTime = csvTime;
+  header.NumRows = _count;
+  header.StringsSize = _stringsSize;
+
+  if (SD.exists(_idxName)) SD.remove(_idxName);
+  File idx = SD.open(_idxName, FILE_WRITE);
+  if (!idx) { VF("MSG: CsvIndex, can't write "); VL(_idxName); return; }
+  idx.write((const uint8_t*)&header, sizeof(header));
+  idx.write(_buf, _count*sizeof(csv_idx_rec_t) + _stringsSize);
+  idx.close();
+}
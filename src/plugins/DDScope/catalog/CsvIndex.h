@@ -0,0 +1,95 @@
+// =====================================================
+// CsvIndex.h
+//
+// Binary index of a ';' separated catalog file on the SD card (mod1_treasure.csv),
+// also used to hold the rows of the custom catalog journal. The first time a CSV
+// is loaded it is parsed once into fixed width records (RA, Dec and magnitude as
+// floats, offsets of the fields in a string table) and saved next to it. Later
+// loads check the CSV's size and modify time against the index header and read
+// the records and strings in one block, or skip the SD card entirely if the same
+// CSV is already in RAM.
+
+#pragma once
+
+#include <Arduino.h>
+#include <SD.h>
+
+#define CSV_IDX_VERSION    1
+#define CSV_IDX_MAX_FIELDS 8
+#define CSV_IDX_LINE_LEN   110 // longest CSV line, also the most string table space a row can use
+#define CSV_IDX_BLOCK      512 // CSV read size while building the index
+
+#pragma pack(push, 1)
+
+// Struct for the index file header
+typedef struct {
+  char           Magic[4];      // "DDCX"
+  uint16_t       Version;       // CSV_IDX_VERSION
+  uint8_t        NumFields;
+  uint8_t        RecordSize;
+  uint32_t       CsvSize;       // size and modify time of the CSV the index was built from
+  uint32_t       CsvTime;
+  uint32_t       NumRows;
+  uint32_t       StringsSize;   // string table follows the NumRows records
+} csv_idx_header_t; // 24 bytes
+
+// Struct for one CSV row
+typedef struct {
+  float          RA;            // hours
+  float          DE;            // degrees
+  float          Mag;           // 99.9 if unknown
+  uint16_t       Field[CSV_IDX_MAX_FIELDS]; // offsets of the NUL terminated fields in the string table
+} csv_idx_rec_t; // 28 bytes
+
+#pragma pack(pop)
+
+// bytes of buffer needed for rows
+#define CSV_IDX_BUF_SIZE(rows) ((rows)*(sizeof(csv_idx_rec_t) + CSV_IDX_LINE_LEN))
+
+// fills in RA, DE and Mag of a row from its fields, false if the coordinates can't be read
+typedef bool (*CsvIdxParser)(char **field, csv_idx_rec_t *rec);
+
+class CsvIndex {
+  public:
+    CsvIndex(const char *csvName, const char *idxName, uint8_t numFields, CsvIdxParser parser,
+             uint8_t *buf, uint32_t bufSize, uint16_t maxRows);
+
+    // load the CSV's rows, rebuilding the index if the CSV changed, false if there is no CSV
+    bool        load();
+    // forget the rows in RAM, the next load() checks the SD card again
+    void        invalidate() { _loaded = false; _count = 0; }
+
+    // rows from somewhere other than a CSV file (csvName NULL, idxName only names it in messages):
+    // begin(), addRow() for each line, end()
+    void        begin();
+    bool        addRow(char *line);
+    void        end();
+
+    uint16_t    count() { return _count; }
+    const char* field(uint16_t row, uint8_t f);
+    float       ra(uint16_t row)  { return row < _count ? rec(row)->RA : 0; }
+    float       dec(uint16_t row) { return row < _count ? rec(row)->DE : 0; }
+    float       mag(uint16_t row) { return row < _count ? rec(row)->Mag : 99.9; }
+
+  private:
+    csv_idx_rec_t* rec(uint16_t row) { return &((csv_idx_rec_t*)_buf)[row]; }
+    bool        readIndex(uint32_t csvSize, uint32_t csvTime);
+    bool        build(File &csv);
+    void        writeIndex(uint32_t csvSize, uint32_t csvTime);
+
+    const char   *_csvName;
+    const char   *_idxName;
+    uint8_t       _numFields;
+    CsvIdxParser  _parser;
+
+    uint8_t      *_buf;
+    uint32_t      _bufSize;
+    uint16_t      _maxRows;
+    char         *_strings = NULL;
+    uint32_t      _stringsSize = 0;
+
+    bool          _loaded = false;
+    uint16_t      _count = 0;
+    uint32_t      _csvSize = 0;
+    uint32_t      _csvTime = 0;
+};
@@ -0,0 +1,359 @@
+// =====================================================
+// CustomStore.cpp
+//
+// Journal records are only ever appended; the rows in RAM are rebuilt by
+// replaying the journal when it has changed, first collecting the tombstones
+// then adding the live lines in the order they were saved.
+
+#include "CustomStore.h"
+#include "src/Common.h"
+#include "src/lib/convert/Convert.h"
+#include "src/lib/tasks/OnTask.h"
+#include "../screens/CatalogDefs.h"
+
+// custom.csv file format = ObjName;Mag;Cons;ObjType;SubId;cRahhmmss;cDecsddmmss
+// RA/DEC/Mag fields are converted to numbers as the rows are loaded
+static bool parseCustomRow(char **field, csv_idx_rec_t *rec) {
+  double ra, dec;
+  // Note: PM_HIGH is required for the format used here
+  if (!convert.hmsToDouble(&ra, field[CF_RA], PM_HIGH)) return false;
+  if (!convert.dmsToDouble(&dec, field[CF_DEC], true, PM_HIGH)) return false;
+  rec->RA = ra;
+  rec->DE = dec;
+
+  char *_end;
+  double mag = strtod(field[CF_MAG], &_end);
+  if (_end != field[CF_MAG]) rec->Mag = mag;
+  return true;
+}
+
+EXTMEM uint8_t customRowsBuf[CSV_IDX_BUF_SIZE(MAX_CUSTOM_CATALOG_ROWS)];
+EXTMEM uint16_t customRowId[MAX_CUSTOM_CATALOG_ROWS];
+CsvIndex customRows(NULL, CUSTOM_JNL_FILE, CF_COUNT, parseCustomRow,
+                    customRowsBuf, sizeof(customRowsBuf), MAX_CUSTOM_CATALOG_ROWS);
+
+// CRC-32 (IEEE), four bits at a time
+static uint32_t crc32(uint32_t crc, const uint8_t *p, uint32_t len) {
+  static const uint32_t table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+  crc = ~crc;
+  while (len--) {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ table[crc & 15];
+    crc = (crc >> 4) ^ table[crc & 15];
+  }
+  return ~crc;
+}
+
+static uint32_t recordCrc(const custom_jnl_rec_t *h, const char *line) {
+  uint32_t crc = crc32(0, &h->Type, sizeof(h->Type) + sizeof(h->Len) + sizeof(h->Id));
+  return crc32(crc, (const uint8_t*)line, h->Len);
+}
+
+// header and line of a record into buf, returns its size
+static uint16_t makeRecord(uint8_t *buf, uint8_t type, uint16_t id, const char *line, uint8_t len) {
+  custom_jnl_rec_t *h = (custom_jnl_rec_t*)buf;
+  h->Magic = CUSTOM_JNL_MAGIC;
+  h->Type = type;
+  h->Len = len;
+  h->Id = id;
+  memcpy(&buf[sizeof(custom_jnl_rec_t)], line, len);
+  h->Crc = recordCrc(h, line);
+  return sizeof(custom_jnl_rec_t) + len;
+}
+
+// next record at the file position, false at the end of the journal or at a torn record
+static bool readRecord(File &f, custom_jnl_rec_t *h, char *line) {
+  if (f.read(h, sizeof(custom_jnl_rec_t)) != sizeof(custom_jnl_rec_t)) return false;
+  if (h->Magic != CUSTOM_JNL_MAGIC || (h->Type != CJ_ADD && h->Type != CJ_DEL)) return false;
+  if (h->Id >= CUSTOM_JNL_MAX_IDS || h->Len >= CSV_IDX_LINE_LEN) return false;
+  if (f.read(line, h->Len) != h->Len) return false;
+  line[h->Len] = 0;
+  return h->Crc == recordCrc(h, line);
+}
+
+// the next good record at or after *pos that ends by end, with *pos set to where it starts, false
+// if there is none. A damaged record is stepped over by its length when that lands on a good one,
+// otherwise the journal is searched a byte at a time for the next good record
+static bool nextRecord(File &f, uint32_t *pos, uint32_t end, custom_jnl_rec_t *h, char *line) {
+  if (*pos + sizeof(custom_jnl_rec_t) > end) return false;
+  f.seek(*pos);
+  if (readRecord(f, h, line)) return *pos + sizeof(custom_jnl_rec_t) + h->Len <= end;
+
+  if (h->Magic == CUSTOM_JNL_MAGIC) {
+    uint32_t next = *pos + sizeof(custom_jnl_rec_t) + h->Len;
+    f.seek(next);
+    if (next + sizeof(custom_jnl_rec_t) <= end && readRecord(f, h, line) && next + sizeof(custom_jnl_rec_t) + h->Len <= end) {
+      *pos = next;
+      return true;
+    }
+  }
+
+  for (uint32_t next = *pos + 1; next + sizeof(custom_jnl_rec_t) <= end; next++) {
+    f.seek(next);
+    if (readRecord(f, h, line) && next + sizeof(custom_jnl_rec_t) + h->Len <= end) {
+      *pos = next;
+      return true;
+    }
+  }
+  return false;
+}
+
+void customStoreWrapper() { customStore.poll(); }
+
+void CustomStore::init() {
+  load();
+  VF("MSG: CustomStore, start compaction task (rate " STR(CUSTOM_JNL_PERIOD_MS) " ms priority 7)... ");
+  if (tasks.add(CUSTOM_JNL_PERIOD_MS, 0, true, 7, customStoreWrapper, "CustomStore")) { VLF("success"); } else { VLF("FAILED!"); }
+}
+
+bool CustomStore::load() {
+  if (_loaded) {
+    File jnl = SD.open(CUSTOM_JNL_FILE, FILE_READ);
+    uint32_t size = jnl ? jnl.size() : 0;
+    if (jnl) jnl.close();
+    if (size == _jnlSize) return count() > 0;
+  }
+  replay();
+  return count() > 0;
+}
+
+bool CustomStore::add(const char *line) {
+  if (!_replayed) replay();
+  stopCompaction();
+
+  // ids are reused only after a compaction
+  if (_nextId >= CUSTOM_JNL_MAX_IDS) {
+    if (startCompaction()) while (stepCompaction(CUSTOM_JNL_COMPACT_STEP)) {}
+    if (_nextId >= CUSTOM_JNL_MAX_IDS) { VLF("MSG: CustomStore, journal full"); return false; }
+  }
+
+  int len = strlen(line);
+  while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) len--;
+  if (len == 0) return false;
+  if (len > CSV_IDX_LINE_LEN - 1) len = CSV_IDX_LINE_LEN - 1;
+  if (!append(CJ_ADD, _nextId, line, len)) return false;
+
+  _nextId++;
+  _live++;
+  _loaded = false;
+  return true;
+}
+
+bool CustomStore::remove(uint16_t row) {
+  if (!_loaded) replay();
+  if (row >= count()) return false;
+  stopCompaction();
+
+  uint16_t id = customRowId[row];
+  if (deleted(id)) return false;
+  if (!append(CJ_DEL, id, "", 0)) return false;
+
+  setDeleted(id);
+  _live--;
+  _dead += 2; // the row's add record and its tombstone
+  _loaded = false;
+  return true;
+}
+
+void CustomStore::clear() {
+  stopCompaction();
+  if (SD.exists(CUSTOM_JNL_FILE)) SD.remove(CUSTOM_JNL_FILE);
+  if (SD.exists(CUSTOM_CSV_FILE)) SD.remove(CUSTOM_CSV_FILE);
+
+  memset(_deleted, 0, sizeof(_deleted));
+  _jnlSize = 0;
+  _nextId = _live = _dead = 0;
+  customRows.begin();
+  customRows.end();
+  _replayed = _loaded = true;
+}
+
+uint16_t CustomStore::count() { return customRows.count(); }
+const char* CustomStore::field(uint16_t row, uint8_t f) { return customRows.field(row, f); }
+float CustomStore::ra(uint16_t row) { return customRows.ra(row); }
+float CustomStore::dec(uint16_t row) { return customRows.dec(row); }
+
+// compact once dead records outnumber the live ones, a few records per call
+void CustomStore::poll() {
+  if (!_compacting) {
+    if (!_replayed || _dead < CUSTOM_JNL_COMPACT_DEAD || _dead <= _live) return;
+    if (!startCompaction()) return;
+  }
+  stepCompaction(CUSTOM_JNL_COMPACT_STEP);
+}
+
+// support functions
+
+// rebuild the ids, counts and rows from the journal
+bool CustomStore::replay() {
+  custom_jnl_rec_t h;
+  char line[CSV_IDX_LINE_LEN];
+
+  stopCompaction();
+  recover();
+
+  memset(_deleted, 0, sizeof(_deleted));
+  _jnlSize = 0;
+  _nextId = _live = _dead = 0;
+  customRows.begin();
+  _replayed = _loaded = true;
+
+  File jnl = SD.open(CUSTOM_JNL_FILE, FILE_READ);
+  if (!jnl) { customRows.end(); return false; }
+
+  // tombstones and the next free id, damaged records are skipped
+  uint32_t size = jnl.size();
+  uint16_t adds = 0, dels = 0, skipped = 0;
+  uint32_t end = 0;
+  for (uint32_t pos = 0; nextRecord(jnl, &pos, size, &h, line); pos += sizeof(h) + h.Len) {
+    if (pos != end) skipped++;
+    if (h.Type == CJ_ADD) { adds++; if (h.Id >= _nextId) _nextId = h.Id + 1; } else { dels++; setDeleted(h.Id); }
+    end = pos + sizeof(h) + h.Len;
+  }
+
+  // live rows in the order they were saved
+  for (uint32_t pos = 0; nextRecord(jnl, &pos, end, &h, line); pos += sizeof(h) + h.Len) {
+    if (h.Type != CJ_ADD || deleted(h.Id)) continue;
+    _live++;
+    if (customRows.count() < MAX_CUSTOM_CATALOG_ROWS) {
+      customRowId[customRows.count()] = h.Id;
+      customRows.addRow(line);
+    }
+  }
+  customRows.end();
+  jnl.close();
+
+  // damaged records stay in the journal as dead ones until the next compaction
+  _dead = adds - _live + dels + skipped;
+  if (skipped > 0) { VF("MSG: CustomStore, skipped "); V(skipped); VLF(" damaged records"); }
+
+  // nothing good follows a record torn by a power cut, cut it off so later records are appended after good ones
+  if (end < size) {
+    VF("MSG: CustomStore, dropping "); V(size - end); VLF(" bytes of torn record");
+    File f = SD.open(CUSTOM_JNL_FILE, FILE_WRITE);
+    if (f) { f.truncate(end); f.close(); }
+  }
+  _jnlSize = end;
+
+  VF("MSG: CustomStore, "); V(_live); VF(" rows, "); V(_dead); VLF(" dead records");
+  return true;
+}
+
+// finish or undo a compaction cut short, import custom.csv if there is no journal yet
+void CustomStore::recover() {
+  bool hasJnl = SD.exists(CUSTOM_JNL_FILE);
+  if (SD.exists(CUSTOM_JNL_TMP)) {
+    // the copy is complete only once the old journal has been removed
+    if (hasJnl) SD.remove(CUSTOM_JNL_TMP); else hasJnl = SD.rename(CUSTOM_JNL_TMP, CUSTOM_JNL_FILE);
+  }
+  if (!hasJnl && SD.exists(CUSTOM_CSV_FILE)) importCsv();
+}
+
+// one add record per line of custom.csv, the CSV is kept as custom.bak
+bool CustomStore::importCsv() {
+  File csv = SD.open(CUSTOM_CSV_FILE, FILE_READ);
+  if (!csv) return false;
+  File jnl = SD.open(CUSTOM_JNL_FILE, FILE_WRITE);
+  if (!jnl) { csv.close(); return false; }
+
+  char block[CSV_IDX_BLOCK];
+  char line[CSV_IDX_LINE_LEN];
+  uint8_t rec[sizeof(custom_jnl_rec_t) + CSV_IDX_LINE_LEN];
+  int lineLen = 0;
+  uint16_t id = 0;
+  int n;
+  while ((n = csv.read(block, sizeof(block))) > 0) {
+    for (int i = 0; i < n; i++) {
+      char c = block[i];
+      if (c == '\n') {
+        if (lineLen > 0 && id < CUSTOM_JNL_MAX_IDS) jnl.write(rec, makeRecord(rec, CJ_ADD, id++, line, lineLen));
+        lineLen = 0;
+      } else if (c != '\r' && lineLen < CSV_IDX_LINE_LEN - 1) line[lineLen++] = c;
+    }
+  }
+  // last line without a newline
+  if (lineLen > 0 && id < CUSTOM_JNL_MAX_IDS) jnl.write(rec, makeRecord(rec, CJ_ADD, id++, line, lineLen));
+  jnl.close();
+  csv.close();
+
+  if (SD.exists(CUSTOM_CSV_BAK)) SD.remove(CUSTOM_CSV_BAK);
+  SD.rename(CUSTOM_CSV_FILE, CUSTOM_CSV_BAK);
+  VF("MSG: CustomStore, imported "); V(id); VLF(" rows from " CUSTOM_CSV_FILE);
+  return true;
+}
+
+// one record at the end of the journal, a single SD write
+bool CustomStore::append(uint8_t type, uint16_t id, const char *line, uint8_t len) {
+  uint8_t rec[sizeof(custom_jnl_rec_t) + CSV_IDX_LINE_LEN];
+  uint16_t size = makeRecord(rec, type, id, line, len);
+
+  File jnl = SD.open(CUSTOM_JNL_FILE, FILE_WRITE);
+  if (!jnl) { VLF("MSG: CustomStore, can't open " CUSTOM_JNL_FILE); return false; }
+  bool ok = jnl.write(rec, size) == size;
+  jnl.close();
+  if (!ok) { VLF("MSG: CustomStore, write failed"); _replayed = _loaded = false; return false; }
+  _jnlSize += size;
+  return true;
+}
+
+// live add records are copied to custom.tmp with new ids from 0, tombstones are dropped
+bool CustomStore::startCompaction() {
+  if (SD.exists(CUSTOM_JNL_TMP)) SD.remove(CUSTOM_JNL_TMP);
+  _src = SD.open(CUSTOM_JNL_FILE, FILE_READ);
+  if (!_src) return false;
+  _dst = SD.open(CUSTOM_JNL_TMP, FILE_WRITE);
+  if (!_dst) { _src.close(); return false; }
+  _srcEnd = _jnlSize;
+  _newId = 0;
+  _compacting = true;
+  VF("MSG: CustomStore, compacting "); V(_dead); VLF(" dead records");
+  return true;
+}
+
+// copy up to records records, false once the compaction is finished or stopped
+bool CustomStore::stepCompaction(int records) {
+  if (!_compacting) return false;
+
+  custom_jnl_rec_t h;
+  char line[CSV_IDX_LINE_LEN];
+  uint8_t rec[sizeof(custom_jnl_rec_t) + CSV_IDX_LINE_LEN];
+  for (int i = 0; i < records; i++) {
+    if (_src.position() >= _srcEnd) {
+      uint32_t size = _dst.size();
+      _src.close();
+      _dst.close();
+      _compacting = false;
+      // swap in the copy, recover() completes this if the power goes between the two
+      SD.remove(CUSTOM_JNL_FILE);
+      if (!SD.rename(CUSTOM_JNL_TMP, CUSTOM_JNL_FILE)) { _replayed = _loaded = false; return false; }
+
+      // live rows keep their order so row n now has id n
+      memset(_deleted, 0, sizeof(_deleted));
+      for (uint16_t r = 0; r < customRows.count(); r++) customRowId[r] = r;
+      _nextId = _newId;
+      _dead = 0;
+      _jnlSize = size;
+      VLF("MSG: CustomStore, compaction done");
+      return false;
+    }
+    // damaged records are left behind
+    uint32_t pos = _src.position();
+    if (!nextRecord(_src, &pos, _srcEnd, &h, line)) { _src.seek(_srcEnd); continue; }
+    if (h.Type != CJ_ADD || deleted(h.Id)) continue;
+    uint16_t size = makeRecord(rec, CJ_ADD, _newId++, line, h.Len);
+    if (_dst.write(rec, size) != size) { stopCompaction(); return false; }
+  }
+  return true;
+}
+
+void CustomStore::stopCompaction() {
+  if (!_compacting) return;
+  _src.close();
+  _dst.close();
+  SD.remove(CUSTOM_JNL_TMP);
+  _compacting = false;
+}
+
+CustomStore customStore;
@@ -0,0 +1,98 @@
+// =====================================================
+// CustomStore.h
+//
+// The Custom (user) catalog, kept on the SD card as an append-only journal
+// (custom.jnl) of custom.csv style lines. Saving an object appends an add
+// record and deleting one appends a tombstone naming the row's id, so both are
+// a single short write however long the list is. Each record carries a CRC, a
+// record torn by a power cut is dropped and cut off the end of the journal on
+// the next load, a damaged record elsewhere is skipped and the ones after it
+// kept. Once dead records outnumber live ones the journal is copied to
+// custom.tmp in the background, a few records per tick, and swapped in.
+//
+// An existing custom.csv is imported into a new journal and kept as custom.bak.
+
+#pragma once
+
+#include <Arduino.h>
+#include <SD.h>
+#include "CsvIndex.h"
+
+#define CUSTOM_JNL_FILE         "custom.jnl"
+#define CUSTOM_JNL_TMP          "custom.tmp"
+#define CUSTOM_CSV_FILE         "custom.csv"
+#define CUSTOM_CSV_BAK          "custom.bak"
+#define CUSTOM_JNL_MAGIC        0xC57A
+#define CUSTOM_JNL_MAX_IDS      8192 // ids are renumbered from 0 by each compaction
+#define CUSTOM_JNL_COMPACT_DEAD 32   // compact when at least this many records are dead and more than are live
+#define CUSTOM_JNL_COMPACT_STEP 32   // records copied per background tick
+#define CUSTOM_JNL_PERIOD_MS    1000
+
+// custom.csv fields
+enum CustomField {CF_OBJNAME, CF_MAG, CF_CONS, CF_OBJTYPE, CF_SUBID, CF_RA, CF_DEC, CF_COUNT};
+
+enum CustomJnlType : uint8_t {CJ_ADD = 1, CJ_DEL = 2};
+
+#pragma pack(push, 1)
+
+// Struct for the journal record header, followed by Len bytes of the line for CJ_ADD
+typedef struct {
+  uint16_t       Magic;         // CUSTOM_JNL_MAGIC
+  uint8_t        Type;          // CustomJnlType
+  uint8_t        Len;
+  uint16_t       Id;            // CJ_ADD: id of the new row, CJ_DEL: id of the row deleted
+  uint32_t       Crc;           // CRC-32 of Type, Len, Id and the line
+} custom_jnl_rec_t; // 10 bytes
+
+#pragma pack(pop)
+
+class CustomStore {
+  public:
+    // start the background compaction task, call after the SD card is started
+    void        init();
+
+    // replay the journal into the rows if it changed since the last load, false if there are no rows
+    bool        load();
+    // append a custom.csv style line, a trailing newline is ignored
+    bool        add(const char *line);
+    // delete a row by its position in the list
+    bool        remove(uint16_t row);
+    // delete the whole catalog
+    void        clear();
+
+    uint16_t    count();
+    const char* field(uint16_t row, uint8_t f);
+    float       ra(uint16_t row);
+    float       dec(uint16_t row);
+
+    // one step of background compaction
+    void        poll();
+
+  private:
+    bool        replay();
+    void        recover();
+    bool        importCsv();
+    bool        append(uint8_t type, uint16_t id, const char *line, uint8_t len);
+    bool        startCompaction();
+    bool        stepCompaction(int records);
+    void        stopCompaction();
+    bool        deleted(uint16_t id)         { return _deleted[id >> 3] & (1 << (id & 7)); }
+    void        setDeleted(uint16_t id)      { _deleted[id >> 3] |= (1 << (id & 7)); }
+
+    bool        _replayed = false; // journal ids, live and dead counts are known
+    bool        _loaded = false;   // rows in RAM match the journal
+    uint32_t    _jnlSize = 0;
+    uint16_t    _nextId = 0;
+    uint16_t    _live = 0;
+    uint16_t    _dead = 0;
+    uint8_t     _deleted[CUSTOM_JNL_MAX_IDS/8];
+
+    // compaction in progress
+    bool        _compacting = false;
+    File        _src;
+    File        _dst;
+    uint32_t    _srcEnd = 0;
+    uint16_t    _newId = 0;
+};
+
+extern CustomStore customStore;
@@ -0,0 +1,160 @@
+// =====================================================
+// NameIndex.cpp
+//
+// Each catalog's entries are sorted by the keypad digits of their names so
+// the names matching the keys typed so far are always one contiguous run.
+// Each key narrows that run with two binary searches that read the names
+// straight from flash, so a keystroke costs a few hundred character reads.
+
+#include "NameIndex.h"
+#include "Catalog.h"
+
+extern catalog_t catalog[];
+
+// keypad digit of a name character, must match t9_key() in tools/mkNameIndex.py
+static char nameIdxKey(char c) {
+  if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+  if (c >= 'a' && c <= 'z') return "22233344455566677778889999"[c - 'a'];
+  if (c >= '0' && c <= '9') return c;
+  if (c == ' ') return '0';
+  return '1';
+}
+
+// map the generated sections onto the catalogs listed in catalog[]
+void NameIndex::init() {
+  _numSect = 0;
+  for (int i = 0; NameIdx_Sections[i].Entries != NULL && _numSect < NAME_IDX_MAX_SECTIONS; i++) {
+    const name_idx_section_t *s = &NameIdx_Sections[i];
+    int cat = -1;
+    if (s->Objects != NULL) {
+      for (int j = 0; j < cat_mgr.numCatalogs(); j++) {
+        if (catalog[j].Objects == s->Objects && (s->CatalogType == CAT_NONE || s->CatalogType == catalog[j].CatalogType)) cat = j;
+      }
+      if (cat < 0) continue; // compiled in but not listed in catalog[], or a different variant
+    }
+    _sect[_numSect] = s;
+    _cat[_numSect] = cat;
+    _numSect++;
+  }
+  _initialized = true;
+}
+
+// forget all keys, everything matches
+void NameIndex::clear() {
+  if (!_initialized) init();
+  for (int i = 0; i < _numSect; i++) {
+    _first[i] = 0;
+    _last[i] = _sect[i]->NumEntries;
+  }
+  _numKeys = 0;
+  _keys[0] = 0;
+}
+
+// add a key ('0' to '9'), false and ignored if nothing would match
+bool NameIndex::pushKey(char key) {
+  if (!_initialized) clear();
+  if (key < '0' || key > '9' || _numKeys >= NAME_IDX_MAX_KEYS) return false;
+
+  unsigned short first[NAME_IDX_MAX_SECTIONS];
+  unsigned short last[NAME_IDX_MAX_SECTIONS];
+  if (!narrow(key, first, last)) return false;
+
+  memcpy(_first, first, sizeof(_first));
+  memcpy(_last, last, sizeof(_last));
+  _keys[_numKeys++] = key;
+  _keys[_numKeys] = 0;
+  return true;
+}
+
+// remove the last key, the ranges are rebuilt from the remaining keys
+void NameIndex::popKey() {
+  if (_numKeys == 0) return;
+  char keys[NAME_IDX_MAX_KEYS + 1];
+  strcpy(keys, _keys);
+  keys[_numKeys - 1] = 0;
+  clear();
+  for (int i = 0; keys[i]; i++) pushKey(keys[i]);
+}
+
+int NameIndex::count() {
+  if (!_initialized) clear();
+  int n = 0;
+  for (int i = 0; i < _numSect; i++) n += _last[i] - _first[i];
+  return n;
+}
+
+// copy the name of match n, up to len-1 characters
+bool NameIndex::getName(int n, char *name, int len) {
+  int sect; long entry;
+  if (!find(n, sect, entry)) { name[0] = 0; return false; }
+  const char *s = _sect[sect]->Names + _sect[sect]->Entries[entry].Name;
+  int i = 0;
+  while (i < len - 1 && s[i] != ';' && s[i] != 0) { name[i] = s[i]; i++; }
+  name[i] = 0;
+  return true;
+}
+
+const char* NameIndex::getCatalogTitle(int n) {
+  int sect; long entry;
+  if (!find(n, sect, entry)) return "";
+  if (_cat[sect] < 0) return "Treasure";
+  const char *subMenu = strstr(catalog[_cat[sect]].Title, ">");
+  return subMenu ? &subMenu[1] : catalog[_cat[sect]].Title;
+}
+
+// J2000 coordinates of match n, a catalog match is also made the cat_mgr's current record
+bool NameIndex::getCoords(int n, double &raHours, double &decDegs) {
+  int sect; long entry;
+  if (!find(n, sect, entry)) return false;
+  const name_idx_section_t *s = _sect[sect];
+  if (_cat[sect] < 0) {
+    raHours = s->Coords[entry].RA;
+    decDegs = s->Coords[entry].DE;
+    return true;
+  }
+  // the catalog being browsed is left selected
+  return cat_mgr.recordCoords(_cat[sect], s->Entries[entry].Record, raHours, decDegs);
+}
+
+// locate match n as a section and entry
+bool NameIndex::find(int n, int &sect, long &entry) {
+  if (!_initialized) clear();
+  if (n < 0) return false;
+  for (int i = 0; i < _numSect; i++) {
+    int num = _last[i] - _first[i];
+    if (n < num) { sect = i; entry = _first[i] + n; return true; }
+    n -= num;
+  }
+  return false;
+}
+
+// keypad digit at position pos of an entry's name, 0 past its end so shorter names sort first
+char NameIndex::keyAt(int sect, long entry, int pos) {
+  const char *name = _sect[sect]->Names + _sect[sect]->Entries[entry].Name;
+  for (int i = 0; i < pos; i++) if (name[i] == ';' || name[i] == 0) return 0;
+  if (name[pos] == ';' || name[pos] == 0) return 0;
+  return nameIdxKey(name[pos]);
+}
+
+// ranges of the entries matching the current keys followed by key, false if all are empty
+bool NameIndex::narrow(char key, unsigned short *first, unsigned short *last) {
+  bool found = false;
+  for (int i = 0; i < _numSect; i++) {
+    long lo = _first[i], hi = _last[i];
+    while (lo < hi) {
+      long mid = (lo + hi)/2;
+      if (keyAt(i, mid, _numKeys) < key) lo = mid + 1; else hi = mid;
+    }
+    first[i] = lo;
+    hi = _last[i];
+    while (lo < hi) {
+      long mid = (lo + hi)/2;
+      if (keyAt(i, mid, _numKeys) <= key) lo = mid + 1; else hi = mid;
+    }
+    last[i] = lo;
+    if (last[i] > first[i]) found = true;
+  }
+  return found;
+}
+
+NameIndex nameIndex;
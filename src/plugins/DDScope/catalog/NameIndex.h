@@ -0,0 +1,49 @@
+// =====================================================
+// NameIndex.h
+//
+// Incremental prefix search of common object names (e.g. "Whirlpool", "Albireo")
+// typed on a phone style keypad, 2=ABC .. 9=WXYZ, 0=space, 1=punctuation.
+// The index is generated offline into flash (libCatalogs/name_index.h) so only
+// the current range of matches per catalog is kept in RAM.
+
+#pragma once
+
+#include <Arduino.h>
+#include "CatalogTypes.h"
+
+#define NAME_IDX_MAX_KEYS     20
+#define NAME_IDX_MAX_SECTIONS 16
+
+class NameIndex {
+  public:
+    void        clear();
+    bool        pushKey(char key);
+    void        popKey();
+    const char* keys() { return _keys; }
+    int         numKeys() { return _numKeys; }
+
+    // matches are numbered 0 to count()-1, grouped by catalog and sorted by name
+    int         count();
+    bool        getName(int n, char *name, int len);
+    const char* getCatalogTitle(int n);
+    bool        getCoords(int n, double &raHours, double &decDegs);
+
+  private:
+    void        init();
+    bool        find(int n, int &sect, long &entry);
+    bool        narrow(char key, unsigned short *first, unsigned short *last);
+    char        keyAt(int sect, long entry, int pos);
+
+    bool _initialized = false;
+    int  _numSect = 0;
+    const name_idx_section_t *_sect[NAME_IDX_MAX_SECTIONS];
+    int  _cat[NAME_IDX_MAX_SECTIONS];  // index into catalog[], -1 if not a compiled in catalog
+
+    unsigned short _first[NAME_IDX_MAX_SECTIONS];
+    unsigned short _last[NAME_IDX_MAX_SECTIONS];
+
+    char _keys[NAME_IDX_MAX_KEYS + 1] = "";
+    int  _numKeys = 0;
+};
+
+extern NameIndex nameIndex;
@@ -0,0 +1,222 @@
+// =====================================================
+// PlanetCache.cpp
+//
+// Uses the Ephemeris by:
+// Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+
+#include "PlanetCache.h"
+#include "src/Common.h"
+#include <Ephemeris.h>
+#include "src/lib/calendars/Calendars.h"
+#include "src/telescope/mount/site/Site.h"
+
+static const double Rad=57.29577951;
+static const char PlanetNames[PLANET_COUNT][8]={"Mercury", "Venus", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune", "Moon"};
+
+// SolarSystemObjectIndex from Ephemeris.hpp, without the Sun and Earth
+static const SolarSystemObjectIndex EphIndex[PLANET_COUNT]={Mercury, Venus, Mars, Jupiter, Saturn, Uranus, Neptune, EarthsMoon};
+
+static Ephemeris ephemeris;
+
+// run the full theory at a Julian date (UT)
+static void theory(uint8_t planet, double jd, double &raHours, double &decDegs, double &dist) {
+  JulianDate j;
+  j.day=floor(jd-0.5)+0.5;
+  j.hour=(jd-j.day)*24.0;
+  GregorianDate date=calendars.julianToGregorian(j);
+  long s=lround(date.hour*3600.0);
+  if (s>86399) s=86399;
+
+  SolarSystemObject obj=ephemeris.solarSystemObjectAtDateAndTime(EphIndex[planet], date.day, date.month, date.year, s/3600, (s/60)%60, s%60);
+  raHours=obj.equaCoordinates.ra;
+  decDegs=obj.equaCoordinates.dec;
+  dist=obj.distance;
+}
+
+// Chebyshev series at x in -1..1 (Clenshaw), c[0] already halved
+static double cheb(const double *c, double x) {
+  double b1=0, b2=0;
+  for (int j=PLANET_CHEB_TERMS-1; j>=1; j--) { double t=2.0*x*b1-b2+c[j]; b2=b1; b1=t; }
+  return x*b1-b2+c[0];
+}
+
+// derivative of a Chebyshev series with respect to x
+static double chebDeriv(const double *c, double x) {
+  double d[PLANET_CHEB_TERMS];
+  d[PLANET_CHEB_TERMS-1]=0;
+  d[PLANET_CHEB_TERMS-2]=2.0*(PLANET_CHEB_TERMS-1)*c[PLANET_CHEB_TERMS-1];
+  for (int j=PLANET_CHEB_TERMS-3; j>=0; j--) d[j]=d[j+2]+2.0*(j+1)*c[j+1];
+  d[0]/=2.0;
+  return cheb(d, x);
+}
+
+static double rangeHours(double h) {
+  h=fmod(h, 24.0);
+  if (h<0.0) h+=24.0;
+  return h;
+}
+
+const char* PlanetCache::name(uint8_t planet) {
+  return planet<PLANET_COUNT ? PlanetNames[planet] : "";
+}
+
+double PlanetCache::now() {
+  JulianDate j=site.getDateTime();
+  return j.day+j.hour/24.0;
+}
+
+void PlanetCache::position(uint8_t planet, double jd, double &raHours, double &decDegs) {
+  evaluate(planet, jd, raHours, decDegs);
+  raHours=rangeHours(raHours);
+}
+
+double PlanetCache::distance(uint8_t planet, double jd) {
+  planet_seg_t *seg=segment(planet, jd);
+  return cheb(seg->dist, 2.0*(jd-seg->start)/seg->span-1.0);
+}
+
+void PlanetCache::rates(uint8_t planet, double jd, double &raRate, double &decRate) {
+  planet_seg_t *seg=segment(planet, jd);
+  double x=2.0*(jd-seg->start)/seg->span-1.0;
+  double perHour=2.0/(seg->span*24.0);
+  raRate=chebDeriv(seg->ra, x)*perHour;
+  decRate=chebDeriv(seg->dec, x)*perHour;
+}
+
+void PlanetCache::altAzm(uint8_t planet, double jd, double &alt, double &azm) {
+  double ra, dec;
+  evaluate(planet, jd, ra, dec);
+  double ha=(lstHours(jd)-ra)*15.0/Rad;
+  double lat=site.location.latitude;
+  dec/=Rad;
+  alt=asin(sin(dec)*sin(lat)+cos(dec)*cos(lat)*cos(ha))*Rad;
+  azm=atan2(-cos(dec)*sin(ha), sin(dec)*cos(lat)-cos(dec)*sin(lat)*cos(ha))*Rad;
+  if (azm<0.0) azm+=360.0;
+}
+
+// hour angle (hours, -12..12) at jd
+double PlanetCache::hourAngle(uint8_t planet, double jd) {
+  double ra, dec;
+  evaluate(planet, jd, ra, dec);
+  return rangeHours(lstHours(jd)-ra+12.0)-12.0;
+}
+
+// scans the night in PLANET_RTS_STEP_MIN steps and interpolates the crossings
+const planet_rts_t* PlanetCache::riseTransitSet(uint8_t planet, double jd) {
+  if (planet>=PLANET_COUNT) planet=0;
+  planet_rts_t *rts=&_rts[planet];
+  checkSite();
+
+  // JD is a whole number at noon, so the night starts at the whole local JD
+  double tz=site.location.timezone/24.0;
+  double night=floor(jd-tz)+tz;
+  if (rts->night==night) return rts;
+
+  // the scan refits segments across the night, keep the one in use
+  planet_seg_t current=_seg[planet];
+
+  // apparent altitude of the upper limb at rise and set, the Moon's includes its parallax
+  double h0=(planet==PLANET_MOON) ? 0.125 : -0.5667;
+  const int steps=24*60/PLANET_RTS_STEP_MIN;
+  const double step=1.0/steps;
+
+  rts->night=night;
+  rts->rise=0; rts->transit=0; rts->set=0;
+  double t0=night, alt0=altitude(planet, t0), ha0=hourAngle(planet, t0);
+  for (int i=1; i<=steps; i++) {
+    double t1=night+i*step;
+    double alt1=altitude(planet, t1), ha1=hourAngle(planet, t1);
+
+    if (rts->rise==0 && alt0<h0 && alt1>=h0) rts->rise=t0+step*(h0-alt0)/(alt1-alt0);
+    if (rts->set==0 && alt0>=h0 && alt1<h0) rts->set=t0+step*(alt0-h0)/(alt0-alt1);
+    if (rts->transit==0 && ha0<0.0 && ha1>=0.0 && ha1-ha0<1.0) rts->transit=t0+step*(-ha0)/(ha1-ha0);
+
+    t0=t1; alt0=alt1; ha0=ha1;
+  }
+
+  _seg[planet]=current;
+  return rts;
+}
+
+double PlanetCache::localHours(double jd) {
+  return rangeHours((jd-0.5-floor(jd-0.5))*24.0-site.location.timezone);
+}
+
+void PlanetCache::invalidate() {
+  for (int i=0; i<PLANET_COUNT; i++) { _seg[i].span=0; _rts[i].night=0; }
+}
+
+// support functions
+
+// the segment covering jd, fitted if needed
+planet_seg_t* PlanetCache::segment(uint8_t planet, double jd) {
+  if (planet>=PLANET_COUNT) planet=0;
+  checkSite();
+  planet_seg_t *seg=&_seg[planet];
+  if (seg->span>0 && jd>=seg->start && jd<seg->start+seg->span) return seg;
+
+  double span=((planet==PLANET_MOON) ? MOON_SEG_HOURS : PLANET_SEG_HOURS)/24.0;
+  fit(planet, floor(jd/span)*span, span, seg);
+  return seg;
+}
+
+// Chebyshev fit at the segment's nodes, PLANET_CHEB_TERMS runs of the theory
+void PlanetCache::fit(uint8_t planet, double start, double span, planet_seg_t *seg) {
+  const int n=PLANET_CHEB_TERMS;
+  double ra[n], dec[n], dist[n];
+
+  ephemeris.setLocationOnEarth((float)(site.location.latitude*Rad), (float)(site.location.longitude*Rad));
+  ephemeris.flipLongitude(true); // true = positive = West, as in OnStep
+
+  unsigned long t=micros();
+  for (int k=0; k<n; k++) {
+    double x=cos(M_PI*(k+0.5)/n);
+    theory(planet, start+(x+1.0)*0.5*span, ra[k], dec[k], dist[k]);
+    // keep RA continuous across 0h
+    while (ra[k]-ra[0]>12.0) ra[k]-=24.0;
+    while (ra[k]-ra[0]<-12.0) ra[k]+=24.0;
+  }
+
+  for (int j=0; j<n; j++) {
+    double sr=0, sd=0, sa=0;
+    for (int k=0; k<n; k++) {
+      double c=cos(M_PI*j*(k+0.5)/n);
+      sr+=ra[k]*c; sd+=dec[k]*c; sa+=dist[k]*c;
+    }
+    seg->ra[j]=sr*2.0/n; seg->dec[j]=sd*2.0/n; seg->dist[j]=sa*2.0/n;
+  }
+  seg->ra[0]/=2.0; seg->dec[0]/=2.0; seg->dist[0]/=2.0;
+  seg->start=start;
+  seg->span=span;
+
+  VF("MSG: PlanetCache, fit "); V(PlanetNames[planet]); VF(" in "); V(micros()-t); VLF(" us");
+}
+
+void PlanetCache::evaluate(uint8_t planet, double jd, double &raHours, double &decDegs) {
+  planet_seg_t *seg=segment(planet, jd);
+  double x=2.0*(jd-seg->start)/seg->span-1.0;
+  raHours=cheb(seg->ra, x);
+  decDegs=cheb(seg->dec, x);
+}
+
+double PlanetCache::altitude(uint8_t planet, double jd) {
+  double alt, azm;
+  altAzm(planet, jd, alt, azm);
+  return alt;
+}
+
+// local sidereal time at jd, from the mount's sidereal clock
+double PlanetCache::lstHours(double jd) {
+  return rangeHours(site.getSiderealTime()+(jd-now())*24.0*1.00273790935);
+}
+
+// the Moon's place depends on the site, so do rise and set
+void PlanetCache::checkSite() {
+  if (site.location.latitude!=_lat || site.location.longitude!=_long) {
+    invalidate();
+    _lat=site.location.latitude;
+    _long=site.location.longitude;
+  }
+}
+
+PlanetCache planetCache;
@@ -0,0 +1,77 @@
+// =====================================================
+// PlanetCache.h
+//
+// Planet and Moon positions for the Planets page, goto and tracking. The full
+// Ephemeris theory is only run at the nodes of a short Chebyshev segment per
+// object (a day for the planets, two hours for the Moon); positions inside a
+// segment are then a few multiply-adds, and so are the rates used to track.
+// Rise, transit and set are found once per night from the same segments.
+
+#pragma once
+
+#include <Arduino.h>
+
+#define PLANET_COUNT           8    // Mercury..Neptune and the Moon, in Planets page order
+#define PLANET_MOON            7
+#define PLANET_CHEB_TERMS      8    // Chebyshev coefficients per coordinate
+#define PLANET_SEG_HOURS    24.0
+#define MOON_SEG_HOURS       2.0
+#define PLANET_RTS_STEP_MIN   10    // rise/transit/set search step
+
+// Struct for one object's fitted segment
+typedef struct {
+  double start;                     // Julian date (UT) the segment starts
+  double span;                      // days
+  double ra[PLANET_CHEB_TERMS];     // hours, unwrapped so it may leave 0..24 inside the segment
+  double dec[PLANET_CHEB_TERMS];    // degrees
+  double dist[PLANET_CHEB_TERMS];   // AU
+} planet_seg_t;
+
+// Struct for the night's events, Julian dates (UT), 0 if the event doesn't happen
+typedef struct {
+  double night;                     // local noon the night starts
+  double rise;
+  double transit;
+  double set;
+} planet_rts_t;
+
+class PlanetCache {
+  public:
+    static const char* name(uint8_t planet);
+
+    // UT now as a Julian date
+    double now();
+
+    // RA (hours), Dec (degrees) and distance (AU) at the Julian date jd
+    void   position(uint8_t planet, double jd, double &raHours, double &decDegs);
+    double distance(uint8_t planet, double jd);
+    // motion in RA (hours per hour) and Dec (degrees per hour) at jd
+    void   rates(uint8_t planet, double jd, double &raRate, double &decRate);
+    // altitude and azimuth (degrees, no refraction) at jd
+    void   altAzm(uint8_t planet, double jd, double &alt, double &azm);
+
+    // rise, transit and set for the night containing jd
+    const planet_rts_t* riseTransitSet(uint8_t planet, double jd);
+
+    // local standard time of day (hours) of a Julian date
+    double localHours(double jd);
+
+    // drop all segments, e.g. after the site or date changes
+    void   invalidate();
+
+  private:
+    planet_seg_t* segment(uint8_t planet, double jd);
+    void   fit(uint8_t planet, double start, double span, planet_seg_t *seg);
+    void   evaluate(uint8_t planet, double jd, double &raHours, double &decDegs);
+    double altitude(uint8_t planet, double jd);
+    double hourAngle(uint8_t planet, double jd);
+    double lstHours(double jd);
+    void   checkSite();
+
+    planet_seg_t _seg[PLANET_COUNT];
+    planet_rts_t _rts[PLANET_COUNT];
+    double _lat = -10000;
+    double _long = -10000;
+};
+
+extern PlanetCache planetCache;
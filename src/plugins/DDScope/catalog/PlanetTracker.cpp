@@ -0,0 +1,87 @@
+// =====================================================
+// PlanetTracker.cpp
+
+#include "PlanetTracker.h"
+#include "PlanetCache.h"
+#include "src/Common.h"
+#include "src/lib/tasks/OnTask.h"
+#include "src/telescope/mount/Mount.h"
+#include "src/telescope/mount/goto/Goto.h"
+
+// one sidereal second in UT seconds, the tracking rate offsets are per sidereal second
+#define SIDEREAL_SECOND 0.99726957
+
+void planetTrackerWrapper() { planetTracker.poll(); }
+
+void PlanetTracker::init() {
+  VF("MSG: PlanetTracker, start task (rate " STR(PLANET_TRACK_POLL_MS) " ms priority 6)... ");
+  if (tasks.add(PLANET_TRACK_POLL_MS, 0, true, 6, planetTrackerWrapper, "PlanetTrk")) { VLF("success"); } else { VLF("FAILED!"); }
+}
+
+void PlanetTracker::select(uint8_t planet, double raHours, double decDegs) {
+  _planet = planet;
+  _selected = true;
+  _r = hrsToRad(raHours);
+  _d = degToRad(decDegs);
+}
+
+void PlanetTracker::gotoStarted() {
+  if (!_selected || !isOurTarget()) { stop(); return; }
+  if (!_active) { VF("MSG: PlanetTracker, tracking "); VL(planetCache.name(_planet)); }
+  _active = true;
+  update();
+}
+
+void PlanetTracker::stop() {
+  if (_active) {
+    VLF("MSG: PlanetTracker, back to sidereal");
+    mount.trackingRateOffsetRA = 0.0F;
+    mount.trackingRateOffsetDec = 0.0F;
+  }
+  _active = false;
+}
+
+void PlanetTracker::poll() {
+  if (!_active) {
+    // a goto to the selected planet that didn't come through MountApi, over LX200
+    if (_selected && goTo.state != GS_NONE && isOurTarget()) gotoStarted();
+    return;
+  }
+
+  // a goto elsewhere, or homing, ends planet tracking
+  if ((mount.isSlewing() && !isOurTarget()) || mount.isHome()) { _selected = false; stop(); return; }
+
+  if (millis() - _updated >= PLANET_TRACK_PERIOD_MS) update();
+}
+
+// support functions
+
+bool PlanetTracker::isOurTarget() {
+  Coordinate target = goTo.getGotoTarget();
+  return fabs(target.r - _r) < PLANET_TRACK_SAME_RAD && fabs(target.d - _d) < PLANET_TRACK_SAME_RAD;
+}
+
+// rates from the cached segment, and the goto target moved to where the planet is now
+void PlanetTracker::update() {
+  _updated = millis();
+  double jd = planetCache.now();
+  double raRate, decRate;
+  planetCache.rates(_planet, jd, raRate, decRate);
+
+  // RA hours/hour is 15"/s per 15"/s, i.e. already in sidereal units; Dec degrees/hour is 1"/s
+  mount.trackingRateOffsetRA = raRate*SIDEREAL_SECOND;
+  mount.trackingRateOffsetDec = decRate/15.0*SIDEREAL_SECOND;
+
+  if (isOurTarget()) {
+    double ra, dec;
+    planetCache.position(_planet, jd, ra, dec);
+    Coordinate target = goTo.getGotoTarget();
+    target.r = hrsToRad(ra);
+    target.d = degToRad(dec);
+    goTo.setGotoTarget(&target);
+    _r = target.r;
+    _d = target.d;
+  }
+}
+
+PlanetTracker planetTracker;
@@ -0,0 +1,49 @@
+// =====================================================
+// PlanetTracker.h
+//
+// Non-sidereal tracking of a planet or the Moon. Once a goto to the planet
+// selected on the Planets page starts, the mount's RA/Dec tracking rate offsets
+// are set from the PlanetCache every few seconds and the goto target is kept on
+// the planet's current place, so a later goto or sync still lands on it. Gotos
+// from the screens start it through MountApi::startGoto(), one started over
+// LX200 (:MS#) is noticed by the task. It stops when a goto to some other
+// target starts or the mount is homed.
+
+#pragma once
+
+#include <Arduino.h>
+
+#define PLANET_TRACK_POLL_MS   100  // a goto to the selected planet is looked for this often
+#define PLANET_TRACK_PERIOD_MS 5000 // rates and target update
+#define PLANET_TRACK_SAME_RAD  1.0e-4 // goto target within this (about 20") is still the planet's
+
+class PlanetTracker {
+  public:
+    // start the update task
+    void init();
+
+    // the planet just written as the goto target
+    void select(uint8_t planet, double raHours, double decDegs);
+    // a goto was requested, track the selected planet if it's still the target
+    void gotoStarted();
+    // back to sidereal
+    void stop();
+
+    bool isActive() { return _active; }
+    uint8_t planet() { return _planet; }
+
+    void poll();
+
+  private:
+    bool   isOurTarget();
+    void   update();
+
+    bool    _active = false;
+    uint8_t _planet = 0;
+    bool    _selected = false;
+    double  _r = 0;   // goto target we last wrote, radians
+    unsigned long _updated = 0;
+    double  _d = 0;
+};
+
+extern PlanetTracker planetTracker;
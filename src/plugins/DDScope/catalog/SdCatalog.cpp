@@ -0,0 +1,194 @@
+// =====================================================
+// SdCatalog.cpp
+//
+// The container is opened once at startup and kept open. Records, names and
+// index entries are all read through the same least recently used page cache,
+// a catalog page of 16 or more records costs one SD block read.
+
+#include "SdCatalog.h"
+#include "src/Common.h"
+
+#define NO_PAGE 0xFFFFFFFF
+
+uint8_t SdCatalog::recordSize(CAT_TYPES type) {
+  switch (type) {
+    case CAT_GEN_STAR:       return sizeof(gen_star_t);
+    case CAT_GEN_STAR_VCOMP: return sizeof(gen_star_vcomp_t);
+    case CAT_DBL_STAR:       return sizeof(dbl_star_t);
+    case CAT_DBL_STAR_COMP:  return sizeof(dbl_star_comp_t);
+    case CAT_VAR_STAR:       return sizeof(var_star_t);
+    case CAT_VAR_STAR_COMP:  return sizeof(var_star_comp_t);
+    case CAT_DSO:            return sizeof(dso_t);
+    case CAT_DSO_COMP:       return sizeof(dso_comp_t);
+    case CAT_DSO_VCOMP:      return sizeof(dso_vcomp_t);
+    default:                 return 0;
+  }
+}
+
+// open the container and read its directory, false if missing or not usable
+bool SdCatalog::open() {
+  cat_bin_header_t header;
+
+  for (int i = 0; i < SD_CAT_PAGES; i++) { _cachePage[i] = NO_PAGE; _cacheUsed[i] = 0; }
+  _count = 0;
+  _isOpen = false;
+
+  _file = SD.open(SD_CAT_FILE, FILE_READ);
+  if (!_file) { VLF("MSG: SdCatalog, no " SD_CAT_FILE " found"); return false; }
+  _isOpen = true;
+
+  if (!read(0, &header, sizeof(header)) || strncmp(header.Magic, "DDCB", 4) != 0) {
+    VLF("MSG: SdCatalog, " SD_CAT_FILE " is not a catalog container");
+    _file.close(); _isOpen = false;
+    return false;
+  }
+  if (header.Version != SD_CAT_VERSION || header.DirSize < sizeof(cat_bin_dir_t)) {
+    VF("MSG: SdCatalog, unsupported container version "); VL(header.Version);
+    _file.close(); _isOpen = false;
+    return false;
+  }
+
+  // read the directory, keeping the catalogs whose record layout matches this firmware
+  uint32_t dirOffset = sizeof(cat_bin_header_t);
+  int prefixUsed = 0;
+  for (int i = 0; i < header.NumCatalogs && _count < SD_CAT_MAX; i++, dirOffset += header.DirSize) {
+    cat_bin_dir_t *d = &_dir[_count];
+    if (!read(dirOffset, d, sizeof(cat_bin_dir_t))) break;
+    d->Title[sizeof(d->Title) - 1] = 0;
+
+    if (d->RecordSize == 0 || d->RecordSize != recordSize((CAT_TYPES)d->CatalogType)) {
+      VF("MSG: SdCatalog, skipping "); V(d->Title); VLF(" (record layout mismatch)");
+      continue;
+    }
+    if (prefixUsed + d->PrefixLen + 1 > SD_CAT_PREFIX_BUF) {
+      VF("MSG: SdCatalog, skipping "); V(d->Title); VLF(" (prefix buffer full)");
+      continue;
+    }
+    if (!read(d->Prefix, &_prefixBuf[prefixUsed], d->PrefixLen)) break;
+    _prefixBuf[prefixUsed + d->PrefixLen] = 0;
+    _prefix[_count] = &_prefixBuf[prefixUsed];
+    prefixUsed += d->PrefixLen + 1;
+
+    VF("MSG: SdCatalog, found "); V(d->Title); VF(" with "); V(d->NumObjects); VLF(" records");
+    _count++;
+  }
+  return _count > 0;
+}
+
+// copy record index of catalog n
+bool SdCatalog::getRecord(int n, long index, void *rec) {
+  if (n < 0 || n >= _count) return false;
+  const cat_bin_dir_t *d = &_dir[n];
+  if (index < 0 || index >= (long)d->NumObjects) return false;
+
+  uint32_t perPage = SD_CAT_PAGE_SIZE/d->RecordSize;
+  const uint8_t *p = page(d->Records/SD_CAT_PAGE_SIZE + index/perPage);
+  if (p == NULL) return false;
+  memcpy(rec, p + (index % perPage)*d->RecordSize, d->RecordSize);
+  return true;
+}
+
+// name code of a record, the element number of its name in the names string (as for flash
+// catalogs) or -1 if none
+long SdCatalog::nameCode(int n, long index) {
+  if (n < 0 || n >= _count || index < 0 || index >= (long)_dir[n].NumObjects) return -1;
+  return readCode(_dir[n].NameIdx, index);
+}
+
+long SdCatalog::subIdCode(int n, long index) {
+  if (n < 0 || n >= _count || index < 0 || index >= (long)_dir[n].NumObjects) return -1;
+  return readCode(_dir[n].SubIdIdx, index);
+}
+
+const char* SdCatalog::nameStr(int n, long code) {
+  if (n < 0 || n >= _count || code < 0) return "";
+  long offset = readCode(_dir[n].NameOffsets, code);
+  if (offset < 0) return "";
+  return readStr(_dir[n].Names + offset);
+}
+
+const char* SdCatalog::subIdStr(int n, long code) {
+  if (n < 0 || n >= _count || code < 0) return "";
+  long offset = readCode(_dir[n].SubIdOffsets, code);
+  if (offset < 0) return "";
+  return readStr(_dir[n].SubIds + offset);
+}
+
+// nearest record after index (step 1) or before it (step -1) in RA hour zone of catalog n, -1 if none;
+// the zone's records are in record order so this is a binary search through the page cache
+long SdCatalog::zoneNext(int n, int zone, long index, int step) {
+  if (n < 0 || n >= _count || zone < 0 || zone >= SD_CAT_ZONES) return -1;
+  const cat_bin_dir_t *d = &_dir[n];
+  long lo = readCode(d->Zones, zone);
+  long hi = readCode(d->Zones, zone + 1);
+  if (lo < 0 || hi < lo) return -1;
+
+  // first entry past index for step 1, first entry at or past index for step -1
+  long first = lo, last = hi;
+  while (first < last) {
+    long mid = (first + last)/2;
+    long record = readCode(d->ZoneRecords, mid);
+    if (record < 0) return -1;
+    if (record < index || (step > 0 && record == index)) first = mid + 1; else last = mid;
+  }
+  if (step > 0) return first < hi ? readCode(d->ZoneRecords, first) : -1;
+  return first > lo ? readCode(d->ZoneRecords, first - 1) : -1;
+}
+
+// support functions
+
+long SdCatalog::readCode(uint32_t table, long index) {
+  int32_t code;
+  if (!read(table + index*sizeof(code), &code, sizeof(code))) return -1;
+  return code;
+}
+
+// ';' terminated string at offset
+const char* SdCatalog::readStr(uint32_t offset) {
+  static char result[40] = "";
+  unsigned int i = 0;
+  while (i < sizeof(result) - 1) {
+    const uint8_t *p = page((offset + i)/SD_CAT_PAGE_SIZE);
+    if (p == NULL) break;
+    char c = p[(offset + i) % SD_CAT_PAGE_SIZE];
+    if (c == ';' || c == 0) break;
+    result[i++] = c;
+  }
+  result[i] = 0;
+  return result;
+}
+
+// copy len bytes at offset, across pages if needed
+bool SdCatalog::read(uint32_t offset, void *buf, uint32_t len) {
+  uint8_t *dest = (uint8_t*)buf;
+  while (len > 0) {
+    const uint8_t *p = page(offset/SD_CAT_PAGE_SIZE);
+    if (p == NULL) return false;
+    uint32_t start = offset % SD_CAT_PAGE_SIZE;
+    uint32_t n = SD_CAT_PAGE_SIZE - start;
+    if (n > len) n = len;
+    memcpy(dest, p + start, n);
+    dest += n; offset += n; len -= n;
+  }
+  return true;
+}
+
+// cached page, the least recently used page is replaced on a miss
+const uint8_t* SdCatalog::page(uint32_t pageNum) {
+  if (!_isOpen) return NULL;
+  int lru = 0;
+  for (int i = 0; i < SD_CAT_PAGES; i++) {
+    if (_cachePage[i] == pageNum) { _cacheUsed[i] = ++_useCount; return _cache[i]; }
+    if (_cacheUsed[i] < _cacheUsed[lru]) lru = i;
+  }
+
+  if (!_file.seek(pageNum*SD_CAT_PAGE_SIZE)) return NULL;
+  int n = _file.read(_cache[lru], SD_CAT_PAGE_SIZE);
+  if (n <= 0) { _cachePage[lru] = NO_PAGE; _cacheUsed[lru] = 0; return NULL; }
+  if (n < SD_CAT_PAGE_SIZE) memset(&_cache[lru][n], 0, SD_CAT_PAGE_SIZE - n);
+  _cachePage[lru] = pageNum;
+  _cacheUsed[lru] = ++_useCount;
+  return _cache[lru];
+}
+
+SdCatalog sdCatalog;
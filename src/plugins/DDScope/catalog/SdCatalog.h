@@ -0,0 +1,59 @@
+// =====================================================
+// SdCatalog.h
+//
+// Reads catalogs from a binary container on the SD card (catalogs.bin, built
+// by tools/mkCatalogBin.py) so large catalogs don't have to be compiled into
+// flash. Records keep the CatalogTypes.h struct layouts and are read through a
+// small page cache, CatMgr presents them with the same API as flash catalogs.
+
+#pragma once
+
+#include <Arduino.h>
+#include <SD.h>
+#include "CatalogTypes.h"
+
+#define SD_CAT_FILE        "catalogs.bin"
+#define SD_CAT_VERSION     3
+#define SD_CAT_ZONES       24    // RA hours in the zone index
+#define SD_CAT_PAGE_SIZE   512
+#define SD_CAT_PAGES       8     // 4 KB of cache
+#define SD_CAT_MAX         16    // most catalogs read from one container
+#define SD_CAT_PREFIX_BUF  2048  // prefixes of all catalogs, the star catalogs' are long
+
+class SdCatalog {
+  public:
+    bool        open();
+    int         count() { return _count; }
+    const cat_bin_dir_t* dir(int n) { return &_dir[n]; }
+    const char* prefix(int n) { return _prefix[n]; }
+
+    bool        getRecord(int n, long index, void *rec);
+    long        nameCode(int n, long index);
+    long        subIdCode(int n, long index);
+    const char* nameStr(int n, long code);
+    const char* subIdStr(int n, long code);
+    long        zoneNext(int n, int zone, long index, int step);
+
+    static uint8_t recordSize(CAT_TYPES type);
+
+  private:
+    const uint8_t* page(uint32_t pageNum);
+    bool        read(uint32_t offset, void *buf, uint32_t len);
+    long        readCode(uint32_t table, long index);
+    const char* readStr(uint32_t offset);
+
+    File     _file;
+    bool     _isOpen = false;
+    int      _count = 0;
+    cat_bin_dir_t _dir[SD_CAT_MAX];
+
+    char     _prefixBuf[SD_CAT_PREFIX_BUF];
+    const char* _prefix[SD_CAT_MAX];
+
+    uint8_t  _cache[SD_CAT_PAGES][SD_CAT_PAGE_SIZE];
+    uint32_t _cachePage[SD_CAT_PAGES];
+    uint32_t _cacheUsed[SD_CAT_PAGES];
+    uint32_t _useCount = 0;
+};
+
+extern SdCatalog sdCatalog;
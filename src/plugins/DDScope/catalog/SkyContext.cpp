@@ -0,0 +1,99 @@
+// =====================================================
+// SkyContext.cpp
+
+#include "SkyContext.h"
+#include "src/Common.h"
+
+#ifdef MOUNT_PRESENT
+  #include "src/telescope/mount/coordinates/Transform.h"
+#endif
+
+static const double Rad=57.29577951;
+
+void SkyContext::setLat(double lat) {
+  _lat=lat;
+  if (lat<9999) {
+    _cosLat=cos(lat/Rad);
+    _sinLat=sin(lat/Rad);
+  }
+}
+
+// Set Local Sidereal Time, and number of milliseconds
+void SkyContext::setLstT0(double lstT0) {
+  _lstT0=lstT0;
+  _lstMillisT0=millis();
+  _valid=false;
+}
+
+void SkyContext::update() {
+  _updated=millis();
+  _valid=true;
+
+  // Local Sidereal Time, in hours, adjusted for time inside the menus
+  double msSinceT0=(unsigned long)(_updated-_lstMillisT0);
+  // Convert from Solar to Sidereal
+  double siderealSecondsSinceT0=(msSinceT0/1000.0)*1.00277778;
+  _lstHours=_lstT0+siderealSecondsSinceT0/3600.0;
+
+  // the refraction table follows the same weather readings as the mount's refraction model
+  float tpc=1.0;
+  #ifdef MOUNT_PRESENT
+    tpc=transform.refractionTPC();
+  #endif
+  if (tpc!=_tpc) {
+    _tpc=tpc;
+    for (int i=0; i<=SKY_REFRAC_MAX_ALT-SKY_REFRAC_MIN_ALT; i++) _refrac[i]=refraction(i+SKY_REFRAC_MIN_ALT,tpc);
+  }
+}
+
+// interpolated from the table, in arc-minutes
+double SkyContext::trueRefrac(double alt) {
+  refresh();
+  if (alt<=SKY_REFRAC_MIN_ALT) return _refrac[0];
+  if (alt>=SKY_REFRAC_MAX_ALT) return _refrac[SKY_REFRAC_MAX_ALT-SKY_REFRAC_MIN_ALT];
+  double f=alt-SKY_REFRAC_MIN_ALT;
+  int i=(int)f;
+  f-=i;
+  return _refrac[i]+(_refrac[i+1]-_refrac[i])*f;
+}
+
+// returns the amount of refraction (in arcminutes) at the given true altitude (degrees) scaled for pressure and temperature
+double SkyContext::refraction(double alt, double tpc) {
+  double r=(1.02/tan((alt+(10.3/(alt+5.11)))/Rad))*tpc;
+  if (r<0.0) r=0.0;
+  return r;
+}
+
+// IAU 1976 precession from the catalog epoch to J2000, nutation is below the catalogs' accuracy and left out
+void SkyContext::setEpoch(int epoch) {
+  if (epoch==_epoch) return;
+  _epoch=epoch;
+  if (epoch==2000) return;
+
+  double T=(epoch-2000)/100.0; // start epoch in centuries from J2000
+  double t=(2000-epoch)/100.0; // interval in centuries
+  double zeta =((2306.2181+1.39656*T-0.000139*T*T)*t+(0.30188-0.000344*T)*t*t+0.017998*t*t*t)/3600.0/Rad;
+  double z    =((2306.2181+1.39656*T-0.000139*T*T)*t+(1.09468+0.000066*T)*t*t+0.018203*t*t*t)/3600.0/Rad;
+  double theta=((2004.3109-0.85330*T-0.000217*T*T)*t-(0.42665+0.000217*T)*t*t-0.041833*t*t*t)/3600.0/Rad;
+
+  double cze=cos(zeta), sze=sin(zeta);
+  double cz=cos(z), sz=sin(z);
+  double cth=cos(theta), sth=sin(theta);
+  _p[0][0]= cz*cth*cze-sz*sze; _p[0][1]=-cz*cth*sze-sz*cze; _p[0][2]=-cz*sth;
+  _p[1][0]= sz*cth*cze+cz*sze; _p[1][1]=-sz*cth*sze+cz*cze; _p[1][2]=-sz*sth;
+  _p[2][0]= sth*cze;           _p[2][1]=-sth*sze;           _p[2][2]= cth;
+}
+
+void SkyContext::toJ2000(double &raHours, double &decDegs) {
+  if (_epoch==2000) return;
+  double r=raHours*15.0/Rad, d=decDegs/Rad;
+  double v[3]={cos(d)*cos(r), cos(d)*sin(r), sin(d)};
+  double w[3];
+  for (int i=0; i<3; i++) w[i]=_p[i][0]*v[0]+_p[i][1]*v[1]+_p[i][2]*v[2];
+  r=atan2(w[1],w[0])*Rad/15.0;
+  if (r<0.0) r+=24.0;
+  raHours=r;
+  decDegs=asin(w[2])*Rad;
+}
+
+SkyContext skyContext;
@@ -0,0 +1,64 @@
+// =====================================================
+// SkyContext.h
+//
+// Values the catalog coordinate math needs for every record but that only
+// change with time, site or weather: local sidereal time, sin/cos of the
+// latitude, the refraction table for the current pressure and temperature
+// and the precession matrix from a catalog's epoch to J2000. They are worked
+// out once per tick and shared by all CatMgr calls, so the records on a page
+// are all reduced with the same LST.
+
+#pragma once
+
+#include <Arduino.h>
+
+#define SKY_CONTEXT_PERIOD_MS 1000 // LST and refraction are refreshed at most this often
+#define SKY_REFRAC_MIN_ALT      -1 // refraction table, true altitude in whole degrees
+#define SKY_REFRAC_MAX_ALT      90
+
+class SkyContext {
+  public:
+    void   setLat(double lat);
+    void   setLstT0(double lstT0);
+    bool   isInitialized() { return (_lat<9999) && (_lstT0!=0); }
+
+    // recompute the time and weather dependent values if they are older than a tick
+    void   refresh() { if (!_valid || (long)(millis()-_updated)>=SKY_CONTEXT_PERIOD_MS) update(); }
+    // recompute them now, e.g. before drawing a page of records
+    void   update();
+
+    double lstHours() { refresh(); return _lstHours; }
+    double lstDegs()  { refresh(); return _lstHours*15.0; }
+    double sinLat()   { return _sinLat; }
+    double cosLat()   { return _cosLat; }
+
+    // refraction in arc-minutes at the given true altitude (degrees)
+    double trueRefrac(double alt);
+
+    // catalog epoch of the coordinates passed to toJ2000()
+    void   setEpoch(int epoch);
+    bool   isJ2000() { return _epoch==2000; }
+    // precess from the catalog epoch to J2000, RA in hours and Dec in degrees
+    void   toJ2000(double &raHours, double &decDegs);
+
+  private:
+    static double refraction(double alt, double tpc);
+
+    double _lat=-10000;
+    double _sinLat=0;
+    double _cosLat=0;
+    double _lstT0=0;
+    unsigned long _lstMillisT0=0;
+
+    bool   _valid=false;
+    unsigned long _updated=0;
+    double _lstHours=0;
+
+    float  _tpc=0;
+    float  _refrac[SKY_REFRAC_MAX_ALT-SKY_REFRAC_MIN_ALT+1];
+
+    int    _epoch=2000;
+    double _p[3][3];
+};
+
+extern SkyContext skyContext;
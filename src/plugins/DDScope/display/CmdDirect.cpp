@@ -24,6 +24,9 @@
 
 #include "CmdDirect.h"
 #include "src/telescope/Telescope.h"
+#include "src/telescope/CommandRoute.h"
+#include "src/lib/commands/BatchCmds.h"
+#include "src/lib/commands/CmdLatency.h"
 
 namespace {
     enum CmdError {
@@ -47,6 +50,25 @@ namespace {
     };
 }
 
+// reply type of the commands whose reply depends on the characters after the command
+static uint8_t paramReply(const char *cmd) {
+  char c1 = cmd[1], c2 = cmd[2], c3 = cmd[3], c4 = cmd[4];
+
+  if (c1 == 'G' && c2 == 'X') {
+    if ((c3 == 'E' && c4 == 'E') || (c3 == '8' && c4 == '9')) return CR_SHORT;
+  } else if (c1 == 'F' || c1 == 'f') {
+    // :Fn...# addresses focuser n, the reply follows the character after it
+    char c = (c3 != '#') ? c3 : c2;
+    if (strchr("+-QZHhF1234", c)) return CR_NONE;
+    if (strchr("Aapc", c)) return CR_SHORT;
+  } else if (c1 == 'W' && c2 == 'R') {
+    return strchr("+-", c3) ? CR_SHORT : CR_NONE;
+  } else if (c1 == '$' && c2 == 'Q' && c3 == 'Z') {
+    if (strchr("+-Z/!", c4)) return CR_NONE;
+  }
+  return CR_FULL;
+}
+
 CmdError cmdError;
 CmdError lastCmdError;
 
@@ -64,6 +86,13 @@ int CmdDirect::getLastCmdError() const {
     return static_cast<int>(lastCmdError);
 }
 
+// text for a CommandError, CmdError has "Time Not Ready" ahead of CE_NULL
+const char *CmdDirect::errorString(int commandError) {
+    if (commandError < 0 || commandError > CE_1) return cmdErrorStr[CD_SLEW_ERR_UNSPECIFIED];
+    if (commandError >= CE_NULL) commandError++;
+    return cmdErrorStr[commandError];
+}
+
 bool CmdDirect::processCommand(const char* cmd, char* response) {
   response[0] = 0;  // init output
   bool noResponse = false;
@@ -75,66 +104,13 @@ bool CmdDirect::processCommand(const char* cmd, char* response) {
   }
 
   if (cmd[0] == ':' || cmd[0] == ';') {
-    char c1 = cmd[1], c2 = cmd[2], c3 = cmd[3], c4 = cmd[4];
-
-    if (c1 == 'G') {
-      if (c2 == 'X' && ((c3 == 'E' && c4 == 'E') || (c3 == '8' && c4 == '9')))
-        shortResponse = true;
-    } else if (c1 == 'M') {
-      if (strchr("ewnsg", c2)) noResponse = true;
-      if (strchr("ADNPS", c2)) shortResponse = true;
-    } else if (c1 == 'Q') {
-      if (strchr("#ewns", c2)) noResponse = true;
-    } else if (c1 == 'A') {
-      if (strchr("W123456789+", c2)) {
-        shortResponse = true;
-      }
-    } else if (c1 == 'F' || c1 == 'f') {
-      if (strchr("123456", c2) && c3 != '#') {
-        if (strchr("+-QZHhF1234", c3)) noResponse = true;
-        if (strchr("Aapc", c3)) shortResponse = true;
-      } else {
-        if (strchr("+-QZHhF1234", c2)) noResponse = true;
-        if (strchr("Aapc", c2)) shortResponse = true;
-      }
-    } else if (c1 == 'r') {
-      if (strchr("+-PRFC<>Q1234", c2)) noResponse = true;
-      if (strchr("~S", c2)) shortResponse = true;
-    } else if (c1 == 'R') {
-      if (strchr("AEGCMS0123456789", c2)) noResponse = true;
-    } else if (c1 == 'S') {
-      if (strchr("CLSGtgMNOPrdhoTBX", c2)) shortResponse = true;
-    } else if (c1 == 'L') {
-      if (strchr("BNCDL!", c2)) noResponse = true;
-      if (strchr("o$W", c2)) {
-        shortResponse = true;
-      }
-    } else if (c1 == 'B') {
-      if (strchr("+-", c2)) noResponse = true;
-    } else if (c1 == 'C') {
-      if (strchr("S", c2)) noResponse = true;
-    } else if (c1 == 'h') {
-      if (strchr("FC", c2)) {
-        noResponse = true;
-      }
-      if (strchr("QPR", c2)) {
-        shortResponse = true;
-      }
-    } else if (c1 == 'T') {
-      if (strchr("QR+-SLK", c2)) noResponse = true;
-      if (strchr("edrn", c2)) shortResponse = true;
-    } else if (c1 == 'U') {
-      noResponse = true;
-    } else if (c1 == 'W') {
-      if (c2 == 'R') {
-        if (strchr("+-", c3)) shortResponse = true;
-        else noResponse = true;
-      }
-      if (c2 == 'S') shortResponse = true;
-      if (strchr("0123", c2)) noResponse = true;
-    } else if (c1 == '$' && c2 == 'Q' && c3 == 'Z') {
-      if (strchr("+-Z/!", c4)) noResponse = true;
-    }
+    char c1 = cmd[1], c2 = cmd[2];
+
+    const CommandRoute *route = commandRoute(c1, c2 == '#' ? 0 : c2);
+    uint8_t reply = route ? route->reply : CR_FULL;
+    if (reply == CR_PARAM) reply = paramReply(cmd);
+    if (reply == CR_NONE) noResponse = true;
+    if (reply == CR_SHORT) shortResponse = true;
 
     // Checksum override
     if (cmd[0] == ';') {
@@ -146,12 +122,12 @@ bool CmdDirect::processCommand(const char* cmd, char* response) {
   bool supressFrame = false;
   bool numericReply = true;
 
-  char mutableCommand[64];
+  char mutableCommand[96];
   strncpy(mutableCommand, cmd, sizeof(mutableCommand) - 1);
   mutableCommand[sizeof(mutableCommand) - 1] = '\0';  // Null-terminate
 
   char extractedCmd[3] = {0};
-  char parameter[32] = {0};
+  char parameter[80] = {0};
 
   // Extract command
   extractedCmd[0] = mutableCommand[1];
@@ -176,6 +152,14 @@ bool CmdDirect::processCommand(const char* cmd, char* response) {
   }
 
   CommandError telescopeError = CommandError::CE_NONE;
+  if (isCommandBatch(extractedCmd)) {
+    telescopeError = commandBatch(response, parameter, [](char *r, char *c, char *p, bool *s, bool *n) {
+      CommandError e = CE_NONE;
+      if (!telescope.command(r, c, p, s, n, &e) && e == CE_NONE) e = CE_CMD_UNKNOWN;
+      return e;
+    });
+    numericReply = telescopeError != CE_NONE;
+  } else
   telescope.command(response, extractedCmd, parameter, &supressFrame, &numericReply, &telescopeError);
   cmdError = static_cast<CmdError>(telescopeError);
 
@@ -211,9 +195,21 @@ bool CmdDirect::processCommand(const char* cmd, char* response) {
   }
 }
 
+// processCommand() for the display's own commands, timed as channel X
+bool CmdDirect::timedCommand(const char *command, char *response) {
+  #if DEBUG_COMMAND_LATENCY == ON
+    unsigned long start = micros();
+    bool success = processCommand(command, response);
+    commandLatency.record('X', command[1], 0, micros() - start, 0);
+    return success;
+  #else
+    return processCommand(command, response);
+  #endif
+}
+
 bool CmdDirect::commandBool(const char *command) {
   char response[80] = "";
-  bool success = processCommand(command, response);
+  bool success = timedCommand(command, response);
   int l = strlen(response) - 1; if (l >= 0 && response[l] == '#') response[l] = 0;
   if (!success) return false;
   if (response[1] != 0) return false;
@@ -221,7 +217,7 @@ bool CmdDirect::commandBool(const char *command) {
 }
 
 bool CmdDirect::commandWithReply(const char *command, char *response) {
-  bool success = processCommand(command, response);
+  bool success = timedCommand(command, response);
   int l = strlen(response) - 1;
   if (l >= 0 && response[l] == '#') response[l] = 0;
   return success;
@@ -229,7 +225,7 @@ bool CmdDirect::commandWithReply(const char *command, char *response) {
 
 bool CmdDirect::commandBlind(const char *command) {
   char response[80] = "";
-  return processCommand(command, response);
+  return timedCommand(command, response);
 }
   
 CmdDirect cmdDirect;
\ No newline at end of file
@@ -8,13 +8,16 @@ class CmdDirect {
         bool commandBlind(const char *command);
         bool commandBool(const char *command);
         bool commandWithReply(const char *command, char *response);
+        // response must hold COMMAND_BATCH_REPLY_MAX characters for a :GB# batch
         bool processCommand(const char *cmd, char *response);
         char lastCmd[8];
         const char *getLastCommandErrorString();
         int getLastCmdError() const;
+        const char *errorString(int commandError);
 
     private:
-    
+        bool timedCommand(const char *command, char *response);
+
 };
 
 extern CmdDirect cmdDirect;
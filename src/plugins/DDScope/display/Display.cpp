@@ -22,6 +22,8 @@
 // DDScope specific
 #include "Display.h"
 #include "../catalog/Catalog.h"
+#include "../catalog/CustomStore.h"
+#include "../catalog/PlanetTracker.h"
 #include "../screens/AlignScreen.h"
 #include "../screens/TreasureCatScreen.h"
 #include "../screens/CustomCatScreen.h"
@@ -39,6 +41,8 @@
 #ifdef ODRIVE_MOTOR_PRESENT
   #include "../odriveExt/ODriveExt.h"
   #include "../screens/ODriveScreen.h"
+  #include "../odriveExt/ODriveRecorder.h"
+  #include "../odriveExt/ODriveFollow.h"
 #endif
 
 #define TITLE_BOXSIZE_X         313
@@ -120,9 +124,7 @@ void Display::init(const char *fwName, int fwMajor, int fwMinor) {
 
   // set some defaults
   VLF("MSG: Setting up Limits and Site Name");
-  commandBool(":Sh-02#"); //Set horizon limit -2 deg
-  Y;
-  commandBool(":So88#"); // Set overhead limit 88 deg
+  mountApi.setAltitudeLimits(-2, 88); // horizon limit -2 deg, overhead limit 88 deg
   Y;
   commandBool(":SMHome#"); // Set Site 0 name "Home"
   Y;
@@ -139,6 +141,8 @@ void Display::init(const char *fwName, int fwMajor, int fwMinor) {
   VF("MSG: Setup, start Screen status update task (rate 1000 ms priority 5)... ");
   uint8_t us_handle = tasks.add(1000, 0, true, 5, updateScreenWrapper, "UpdateSpecificScreen");
   if (us_handle)  { VLF("success"); } else { VLF("FAILED!"); }
+
+  planetTracker.init();
 }
 
 // initialize the SD card and boot screen
@@ -147,6 +151,12 @@ void Display::sdInit() {
     VLF("MSG: SD Card, initialize failed");
   } else {
     VLF("MSG: SD Card, initialized");
+    int n = cat_mgr.addSdCatalogs();
+    if (n > 0) { VF("MSG: SD Card, added "); V(n); VLF(" catalogs"); }
+    customStore.init();
+    #if defined(ODRIVE_MOTOR_PRESENT) && ODRIVE_COMM_MODE == OD_CAN
+      oDriveRecorder.init();
+    #endif
   }
 
   // draw bootup screen
@@ -520,12 +530,8 @@ void Display::showOnStepGenErr() {
   
   char temp[80] = "";
   char temp1[80] = "General Error: ";
-  char genError[80] = "";
   
-  commandWithReply(":GU#", genError);
-  int e = genError[strlen(genError) - 1] - '0';
-  getGeneralErrorMessage(temp, e);
-  //getGeneralErrorMessage(temp, limits.errorCode());
+  getGeneralErrorMessage(temp, mountApi.getStatus().errorCode);
   strcat(temp1, temp);
   canvDisplayInsPrint.printLJ(3, 470, 314, C_HEIGHT+2, temp1, false);
 }
@@ -829,10 +835,6 @@ void Display::updateCommonStatus() {
       tft.print("Tracking");
       trackLedOn = true;
     }
-  #ifdef ODRIVE_MOTOR_PRESENT
-  // frequency varying alarm if Motor and Encoders positions are too far apart indicating unbalanced loading or hitting obstruction
-    oDriveExt.MotorEncoderDelta();
-  #endif
   } else { // not tracking 
     digitalWrite(STATUS_TRACK_LED_PIN, HIGH); // LED OFF
     tft.setFont(&Inconsolata_Bold8pt7b);
@@ -842,6 +844,22 @@ void Display::updateCommonStatus() {
     trackLedOn = false;
   }
 
+  #ifdef ODRIVE_MOTOR_PRESENT
+    // following error warning, unbalanced loading or hitting an obstruction
+    int followAxis = 0;
+    ODriveFollowWarning follow = oDriveFollow.warning(&followAxis);
+    tft.setFont(&Inconsolata_Bold8pt7b);
+    tft.fillRect(124, 28, 74, 14, BLACK);
+    if (follow != OFW_NONE) {
+      char followStr[10];
+      sprintf(followStr, "%s %s", followAxis == AZM_MOTOR ? "AZ" : "AL", oDriveFollow.warningName(follow));
+      tft.setTextColor(RED);
+      tft.setCursor(124, 38);
+      tft.print(followStr);
+      tft.setTextColor(textColor);
+    }
+  #endif
+
   if (currentScreen == CUSTOM_SCREEN || 
       currentScreen == SHC_CAT_SCREEN ||
       currentScreen == PLANETS_SCREEN ||
@@ -953,8 +971,6 @@ void Display::updateCommonStatus() {
 //    the ALT and AZM target specifically if the Degree, Minute, Seconds
 //    format is being displayed.
 void Display::updateAltAzmTarget() {
-  char cRaHms[11] = ""; 
-  char cDecDms[11] = "";
   char cLstHms[11] = "";
   char cLatDm[11] = "";
 
@@ -963,20 +979,16 @@ void Display::updateAltAzmTarget() {
   double tLstDeg = 0.0;
   double tLatDeg = 0.0;
 
-  // Get values via LX200 commands
-  commandWithReply(":Gr#", cRaHms);    // Target RA HH:MM:SS
-  commandWithReply(":Gd#", cDecDms);   // Target Dec ±DD*MM:SS
+  // Target from the mount, LST and latitude via LX200 commands
+  mountApi.getTarget(tRaDeg, tDecDeg);
   commandWithReply(":GL#", cLstHms);   // Local Sidereal Time HH:MM:SS
   commandWithReply(":Gt#", cLatDm);    // Latitude ±DD*MM
 
-  tRaDeg *= 15.0;  // RA: hours to degrees
-  tLstDeg *= 15.0; // LST: hours to degrees
-
   // Convert to degrees, assumes PM_HIGH
-  convert.hmsToDouble(&tRaDeg,  cRaHms);         // RA  → degrees (×15)
-  convert.dmsToDouble(&tDecDeg, cDecDms, true);  // Dec → degrees
-  convert.hmsToDouble(&tLstDeg, cLstHms);        // LST → degrees
+  convert.hmsToDouble(&tLstDeg, cLstHms);
   convert.dmsToDouble(&tLatDeg, cLatDm, true);   // Lat → degrees  ← FIXED BUG!
+  tRaDeg *= 15.0;  // RA: hours to degrees
+  tLstDeg *= 15.0; // LST: hours to degrees
 
   // Compute Hour Angle
   double HA = tLstDeg - tRaDeg;
@@ -38,6 +38,7 @@
 
 #include "UIelements.h"
 #include "CmdDirect.h"
+#include "MountApi.h"
 
 class AlignScreen;
 class Catalog;
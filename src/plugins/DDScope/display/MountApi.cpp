@@ -0,0 +1,99 @@
+// =====================================================
+// MountApi.cpp
+
+#include "MountApi.h"
+#include "CmdDirect.h"
+#include "../catalog/PlanetTracker.h"
+#include "src/lib/commands/ReplyCache.h"
+#include "src/telescope/mount/Mount.h"
+#include "src/telescope/mount/goto/Goto.h"
+#include "src/telescope/mount/limits/Limits.h"
+#include "src/telescope/mount/park/Park.h"
+
+CommandError MountApi::setTarget(double raHours, double decDegs) {
+  if (raHours < 0.0 || raHours >= 24.0 || decDegs < -90.0 || decDegs > 90.0) return result(CE_PARAM_RANGE);
+  Coordinate target = goTo.getGotoTarget();
+  target.r = hrsToRad(raHours);
+  target.d = degToRad(decDegs);
+  goTo.setGotoTarget(&target);
+  return result(CE_NONE);
+}
+
+void MountApi::getTarget(double &raHours, double &decDegs) {
+  Coordinate target = goTo.getGotoTarget();
+  raHours = radToHrs(target.r);
+  if (raHours < 0.0) raHours += 24.0;
+  decDegs = radToDeg(target.d);
+}
+
+CommandError MountApi::startGoto() {
+  CommandError e = goTo.requestGotoTarget();
+  // non-sidereal rates if the target is the planet selected on the Planets page
+  if (e == CE_NONE) planetTracker.gotoStarted();
+  return result(e);
+}
+
+void MountApi::stop() {
+  #if GOTO_FEATURE == ON
+    goTo.abort();
+  #endif
+  ::guide.stop();
+  ReplyCache::invalidate();
+}
+
+CommandError MountApi::setTracking(bool on) {
+  return result(mount.setTracking(on));
+}
+
+CommandError MountApi::guide(MountDirection dir, GuideRateSelect rate, unsigned long ms) {
+  switch (dir) {
+    case MD_WEST:  return result(::guide.startAxis1(GA_FORWARD, rate, ms));
+    case MD_EAST:  return result(::guide.startAxis1(GA_REVERSE, rate, ms));
+    case MD_NORTH: return result(::guide.startAxis2(GA_FORWARD, rate, ms));
+    case MD_SOUTH: return result(::guide.startAxis2(GA_REVERSE, rate, ms));
+  }
+  return result(CE_PARAM_RANGE);
+}
+
+CommandError MountApi::move(MountDirection dir) {
+  GuideRateSelect rate = (dir == MD_EAST || dir == MD_WEST) ? ::guide.settings.axis1RateSelect : ::guide.settings.axis2RateSelect;
+  return guide(dir, rate, GUIDE_TIME_LIMIT*1000);
+}
+
+void MountApi::stopGuide(MountDirection dir) {
+  if (dir == MD_EAST || dir == MD_WEST) ::guide.stopAxis1(); else ::guide.stopAxis2();
+  ReplyCache::invalidate();
+}
+
+CommandError MountApi::setAltitudeLimits(int16_t horizonDegs, int16_t overheadDegs) {
+  CommandError e = limits.setAltitudeMin(horizonDegs);
+  if (e == CE_NONE) e = limits.setAltitudeMax(overheadDegs);
+  return result(e);
+}
+
+MountStatus MountApi::getStatus() {
+  MountStatus status;
+  status.tracking     = mount.isTracking();
+  status.slewing      = mount.isSlewing();
+  status.gotoActive   = goTo.state != GS_NONE;
+  status.guiding      = ::guide.active();
+  status.pulseGuiding = ::guide.activePulseGuide();
+  status.atHome       = mount.isHome();
+  status.parked       = park.state == PS_PARKED;
+  status.errorCode    = limits.errorCode();
+  return status;
+}
+
+const char *MountApi::errorString(CommandError e) {
+  return cmdDirect.errorString(e);
+}
+
+// support functions
+
+CommandError MountApi::result(CommandError e) {
+  ReplyCache::invalidate();
+  if (e != CE_NONE && e != CE_1) { lastError = e; VF("MSG: MountApi, "); VL(errorString(e)); }
+  return e;
+}
+
+MountApi mountApi;
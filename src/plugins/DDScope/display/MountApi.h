@@ -0,0 +1,65 @@
+// =====================================================
+// MountApi.h
+//
+// Typed calls into the mount for the display screens. These go straight to
+// the same Goto, Guide and Limits methods the LX200 command handlers use, so
+// the screens don't format a command string only to have it parsed again,
+// and failures come back as a CommandError rather than a "0" reply.
+// CmdDirect stays for everything else and for the external LX200 clients.
+
+#pragma once
+
+#include <Arduino.h>
+#include "src/Common.h"
+#include "src/telescope/mount/guide/Guide.h"
+
+enum MountDirection: uint8_t {MD_NORTH, MD_SOUTH, MD_EAST, MD_WEST};
+
+typedef struct MountStatus {
+  bool    tracking;
+  bool    slewing;
+  bool    gotoActive;
+  bool    guiding;
+  bool    pulseGuiding;
+  bool    atHome;
+  bool    parked;
+  uint8_t errorCode;   // general error code, as the last character of :GU#
+} MountStatus;
+
+class MountApi {
+  public:
+    // set the goto target, RA in hours and Dec in degrees (Native coordinate system)
+    CommandError setTarget(double raHours, double decDegs);
+    // get the goto target, RA in hours (0 to 24) and Dec in degrees
+    void getTarget(double &raHours, double &decDegs);
+
+    // start a goto to the target, as :MS#
+    CommandError startGoto();
+    // stop any goto and guide, as :Q#
+    void stop();
+
+    // turn sidereal tracking on or off, as :Te# and :Td#
+    CommandError setTracking(bool on);
+
+    // guide in a direction at a rate for ms milliseconds
+    CommandError guide(MountDirection dir, GuideRateSelect rate, unsigned long ms);
+    // guide in a direction at the current guide rate until stopped, as :Mn# etc.
+    CommandError move(MountDirection dir);
+    // stop guiding on the axis of this direction, as :Qn# etc.
+    void stopGuide(MountDirection dir);
+
+    // horizon (-30 to 30) and overhead (60 to 90) limits in degrees, saved in NV
+    CommandError setAltitudeLimits(int16_t horizonDegs, int16_t overheadDegs);
+
+    MountStatus getStatus();
+
+    // short text for an error, as shown in the status line
+    const char *errorString(CommandError e);
+
+    CommandError lastError = CE_NONE;
+
+  private:
+    CommandError result(CommandError e);
+};
+
+extern MountApi mountApi;
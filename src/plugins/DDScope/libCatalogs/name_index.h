@@ -0,0 +1,1320 @@
+// This data is machine generated by tools/mkNameIndex.py from the catalog headers and mod1_treasure.csv.
+// Do NOT edit this data manually. Rather, fix the generator and rerun.
+//
+// Entries are sorted by the keypad digit sequence of each name, see catalog/NameIndex.cpp
+
+// caldwell.h
+#if defined(NUM_CALDWELL) && NUM_CALDWELL == 109
+const name_idx_t NameIdx_Caldwell_109_caldwell[46] = {
+  {   368,    56 }, // Barnard's Galaxy
+  {    27,     5 }, // Cat's Eye Nebula
+  {    44,     8 }, // Cave Nebula
+  {   496,    76 }, // Centaurus A
+  {   117,    14 }, // BlinkingPlanetary
+  {   167,    21 }, // Blue Snowball
+  {   617,    98 }, // Coalsack Nebula
+  {   135,    18 }, // Cocoon Nebula
+  {   402,    59 }, // Antennae Galaxies
+  {   420,    60 }, // Antennae Galaxies
+  {     0,     1 }, // Bow-Tie Nebula
+  {   191,    26 }, // Crescent Nebula
+  {    56,    10 }, // Bubble Nebula
+  {   467,    68 }, // Bug Nebula
+  {    99,    13 }, // Dble Clstr h&XPer
+  {   237,    32 }, // East Veil Nebula
+  {   478,    73 }, // EightBurst Nebula
+  {    70,    11 }, // Fireworks Galaxy
+  {   207,    30 }, // Flaming Star Neb
+  {   285,    38 }, // Eskimo Nebula
+  {   575,    91 }, // EtaCarinae Nebula
+  {   438,    62 }, // Helix Nebula
+  {   385,    58 }, // Ghost of Jupiter
+  {   686,   105 }, // 47 Tucanae
+  {    15,     3 }, // Iris Nebula
+  {   306,    45 }, // Hubble's Var. Neb
+  {   299,    40 }, // Hyades
+  {   593,    93 }, // Jewel Box
+  {   633,    99 }, // LmbdaCentauri Neb
+  {   271,    37 }, // Needle Galaxy
+  {   508,    79 }, // Omega Centauri
+  {   523,    84 }, // Omicron Vel Clstr
+  {   149,    19 }, // North America Neb
+  {    87,    12 }, // Owl Cluster
+  {   541,    88 }, // S Norma Cluster
+  {   451,    64 }, // Sculptor Galaxy
+  {   354,    54 }, // Saturn Nebula
+  {   603,    96 }, // Pearl Cluster
+  {   181,    23 }, // Perseus A
+  {   324,    48 }, // Rosette Nebula
+  {   339,    52 }, // Spindle Galaxy
+  {   669,   102 }, // Tarantula Nebula
+  {   651,   101 }, // Theta Car Cluster
+  {   254,    33 }, // West Veil Nebula
+  {   224,    31 }, // Whale Galaxy
+  {   557,    90 }, // WishingWell Clstr
+};
+#endif
+
+// caldwell_c.h
+#if defined(NUM_CALDWELL) && NUM_CALDWELL == 109
+const name_idx_t NameIdx_Caldwell_109_caldwell_c[46] = {
+  {   371,    56 }, // Barnard's Galaxy
+  {    27,     5 }, // Cat's Eye Nebula
+  {    44,     8 }, // Cave Nebula
+  {   500,    76 }, // Centaurus A
+  {   119,    14 }, // Blinking Planetary
+  {   170,    21 }, // Blue Snowball
+  {   623,    98 }, // Coalsack Nebula
+  {   138,    18 }, // Cocoon Nebula
+  {   405,    59 }, // Antennae Galaxies
+  {   423,    60 }, // Antennae Galaxies
+  {     0,     1 }, // Bow-Tie Nebula
+  {   194,    26 }, // Crescent Nebula
+  {    56,    10 }, // Bubble Nebula
+  {   470,    68 }, // Bug Nebula
+  {    99,    13 }, // Dble Clstr, h&X Per
+  {   240,    32 }, // East Veil Nebula
+  {   481,    73 }, // Eight Burst Nebula
+  {    70,    11 }, // Fireworks Galaxy
+  {   210,    30 }, // Flaming Star Neb
+  {   288,    38 }, // Eskimo Nebula
+  {   580,    91 }, // Eta Carinae Nebula
+  {   441,    62 }, // Helix Nebula
+  {   388,    58 }, // Ghost of Jupiter
+  {   693,   105 }, // 47 Tucanae
+  {    15,     3 }, // Iris Nebula
+  {   309,    45 }, // Hubble's Var. Neb
+  {   302,    40 }, // Hyades
+  {   599,    93 }, // Jewel Box
+  {   639,    99 }, // Lmbda Centauri Neb
+  {   274,    37 }, // Needle Galaxy
+  {   512,    79 }, // Omega Centauri
+  {   527,    84 }, // Omicron Vel Clstr
+  {   152,    19 }, // North America Neb
+  {    87,    12 }, // Owl Cluster
+  {   545,    88 }, // S Norma Cluster
+  {   454,    64 }, // Sculptor Galaxy
+  {   357,    54 }, // Saturn Nebula
+  {   609,    96 }, // Pearl Cluster
+  {   184,    23 }, // Perseus A
+  {   327,    48 }, // Rosette Nebula
+  {   342,    52 }, // Spindle Galaxy
+  {   676,   102 }, // Tarantula Nebula
+  {   658,   101 }, // Theta Car Cluster
+  {   257,    33 }, // West Veil Nebula
+  {   227,    31 }, // Whale Galaxy
+  {   561,    90 }, // Wishing Well Clstr
+};
+#endif
+
+// collinder.h, collinder_vc.h
+#if defined(NUM_COLLINDER) && NUM_COLLINDER == 471
+const name_idx_t NameIdx_Collinder_471[471] = {
+  {  3852,   284 }, //  ?* Ursa Major
+  {  3892,   287 }, //  12* 3'
+  {  1017,    73 }, // 12Â±* 5'
+  {  3065,   224 }, // (Neb) 44* 5'
+  {  1423,   103 }, // Chain 15* 21'
+  {  5279,   390 }, // Glob 100Â±* 13' M11
+  {  5339,   394 }, // Glob ?* 3.9'
+  {  4446,   329 }, // Glob ?* 5'
+  {  5137,   380 }, // Glob ?* 5.8'
+  {  4419,   327 }, // Glob ?* 7.1'
+  {  4929,   365 }, // Glob ?* 8.9'
+  {  5529,   408 }, // Glob 150Â±* 7.2'
+  {  2266,   164 }, // Glob 300* 27'
+  {  3015,   220 }, // Glob 30* 2'
+  {  5755,   425 }, // Glob 4* 2.8' M73
+  {  5598,   413 }, // Glob 60* 9'
+  {  2644,   192 }, // Glob 70* 4'
+  {   562,    41 }, // Neb 100* 110' M45
+  {  1308,    94 }, // Neb 10* 27'
+  {  4942,   366 }, // Neb 10* 40'
+  {   551,    40 }, // Neb 10* 7'
+  {  6329,   469 }, // Neb 110* 9' I5146
+  {  5795,   428 }, // Neb ?* 18'
+  {    92,     7 }, // Neb ?* 25'x30'
+  {   988,    71 }, // Neb 12* 14'x14'
+  {  4996,   370 }, // Neb 12* 4'x3'
+  {  3140,   230 }, // Neb 15* 15'
+  {  4870,   361 }, // Neb 20* 14'
+  {  2254,   163 }, // Neb 20* 15'
+  {   917,    67 }, // Neb 20* 4'x4'
+  {  5744,   424 }, // Neb 20* 5'
+  {  3116,   228 }, // Neb 24* 100'
+  {  3385,   248 }, // Neb 25* 65'
+  {   931,    68 }, // Neb 25* 70' Ori Cl.
+  {  5085,   376 }, // Neb 27* 27'
+  {  1271,    91 }, // Neb 30* 11'
+  {  5052,   374 }, // Neb 30* 21' M16
+  {  5783,   427 }, // Neb 40* 13'
+  {   401,    29 }, // Neb 40* 20'
+  {  4846,   359 }, // Neb 40* 30'
+  {  3164,   232 }, // Neb 40*10'n-Car Cl
+  {  3129,   229 }, // Neb 44* 5'
+  {  3104,   227 }, // Neb 50* 14'
+  {  5466,   403 }, // Neb 6* 0.8'
+  {  1847,   134 }, // Neb?ÃÂ   16* 50'
+  {   951,    69 }, // Neb125*140' Or Blt
+  {  4072,   301 }, // Neb20Â±*505'Antr Cl
+  {  2941,   214 }, // Plei 100* 35'
+  {   444,    32 }, // Plei 100* 39'
+  {  3900,   288 }, // Plei 100* 39'
+  {  4493,   333 }, // Plei 10* 2.5' N6383
+  {  6080,   450 }, // Plei 10* 3'
+  {  5939,   439 }, // Plei 10* 3.1'
+  {  2230,   161 }, // Plei 10* 5'
+  {   592,    43 }, // Plei 10* 6'
+  {  3273,   240 }, // Plei 10* 6'
+  {  5097,   377 }, // Plei 10* 6'
+  {  1371,    99 }, // Plei 10* 7'
+  {  4312,   319 }, // Plei 10* 7'
+  {  5871,   434 }, // Plei 10* 7'
+  {  5831,   431 }, // Plei 10* 8'
+  {  1396,   101 }, // Plei 10Â±* 20'
+  {  6177,   457 }, // Plei 10Â±* 6'
+  {  6118,   453 }, // Plei 10Â±* 7'
+  {  6242,   462 }, // Plei ?* 
+  {  2108,   153 }, // Plei (100+)* 10'
+  {  6251,   463 }, // Plei ?* 120'
+  {  6347,   470 }, // Plei ?* 130'
+  {  3648,   268 }, // Plei ?* 15'
+  {  3762,   277 }, // Plei ?* 4'
+  {  3252,   238 }, // Plei ?* 6'
+  {   222,    16 }, // Plei 11* 3.5'
+  {   288,    21 }, // Plei 12* 11'
+  {   858,    63 }, // Plei 12* 2.5'
+  {  2967,   216 }, // Plei 12* 4'
+  {  6030,   446 }, // Plei 12* 4'
+  {  5964,   441 }, // Plei 12* 4.3'
+  {  4644,   344 }, // Plei 12* 4.8'
+  {  3494,   256 }, // Plei 12* 5'
+  {  3570,   262 }, // Plei 12* 5'
+  {  4578,   339 }, // Plei 12* 5'
+  {  5649,   417 }, // Plei 12* 5'
+  {   711,    52 }, // Plei 12* 5'x5'
+  {  1753,   127 }, // Plei 12* 6'
+  {  1320,    95 }, // Plei 12* 7'
+  {  4004,   296 }, // Plei 121* 2'
+  {  4390,   325 }, // Plei 12Â±* 10'
+  {  1996,   145 }, // Plei 12Â±* 5'
+  {  5478,   404 }, // Plei 13* 12'
+  {  1004,    72 }, // Plei 13* 25'
+  {  2498,   181 }, // Plei 14* 10'
+  {  4672,   346 }, // Plei 14* 10'
+  {  5068,   375 }, // Plei 14* 10' M18
+  {   740,    54 }, // Plei 14* 20'
+  {  2698,   196 }, // Plei 14* 40'
+  {  2306,   167 }, // Plei 14* 5'
+  {  1671,   121 }, // Plei 14Â±* 3'
+  {  3684,   271 }, // Plei 15* 10'
+  {  3826,   282 }, // Plei 15* 10'
+  {  5491,   405 }, // Plei 15* 12'
+  {   498,    36 }, // Plei 15* 2'
+  {  4832,   358 }, // Plei 15* 240'
+  {   832,    61 }, // Plei 15* 28'
+  {  3800,   280 }, // Plei 15* 3'
+  {  3152,   231 }, // Plei 15* 4'
+  {  3285,   241 }, // Plei 15* 4'
+  {  6191,   458 }, // Plei 15* 4'
+  {  1918,   139 }, // Plei 15* 42'
+  {  2865,   208 }, // Plei 15* 5'
+  {  2955,   215 }, // Plei 15* 5'
+  {  5806,   429 }, // Plei 15* 5'
+  {  2619,   190 }, // Plei 15* 60'
+  {  4287,   317 }, // Plei 15* 60'
+  {  5391,   398 }, // Plei 15* 60' 4-5 Vul
+  {   781,    57 }, // Plei 15* 6'
+  {  1098,    79 }, // Plei 15* 6'
+  {  4528,   335 }, // Plei 15* 6'
+  {  5313,   392 }, // Plei 15* 6'
+  {  5701,   421 }, // Plei 15* 6' M29
+  {   276,    20 }, // Plei 15* 7'
+  {  3660,   269 }, // Plei 15* 7'
+  {  3437,   252 }, // Plei 15* 7'x5'
+  {  2536,   184 }, // Plei 15* 8'
+  {  3672,   270 }, // Plei 16* 5'
+  {  4820,   357 }, // Plei 16* 6'
+  {  3880,   286 }, // Plei 16* 7'
+  {  5676,   419 }, // Plei 16* 7'
+  {  5978,   442 }, // Plei 16* 7'
+  {  6055,   448 }, // Plei 169* 5'
+  {   375,    27 }, // Plei 18* 11'
+  {    79,     6 }, // Plei 18* 12'
+  {   793,    58 }, // Plei 18* 17'
+  {   657,    48 }, // Plei 18* 18'
+  {   388,    28 }, // Plei 18* 20'
+  {  1358,    98 }, // Plei 18* 24'
+  {  1283,    92 }, // Plei 18* 29'
+  {  2775,   202 }, // Plei 18* 29'
+  {  3183,   233 }, // Plei 18* 3'
+  {  5610,   414 }, // Plei 18* 35'
+  {  6068,   449 }, // Plei 18* 5'
+  {  6218,   460 }, // Plei 18* 5'
+  {  1071,    77 }, // Plei 18* 6'
+  {  1296,    93 }, // Plei 18* 6'
+  {  3003,   219 }, // Plei 18* 6'
+  {  4300,   318 }, // Plei 18* 6'
+  {  2524,   183 }, // Plei 18* 9'
+  {  1807,   131 }, // Plei 18* 95'
+  {  4432,   328 }, // Plei 18Â±* 4'
+  {  3530,   259 }, // Plei 18Â±* 5'
+  {  2632,   191 }, // Plei 19* 7'
+  {  3263,   239 }, // Plei 20* 
+  {  1383,   100 }, // Plei 20* 10'
+  {  3610,   265 }, // Plei 20* 11'
+  {  3723,   274 }, // Plei 20* 11'
+  {   431,    31 }, // Plei 20* 12'
+  {  6092,   451 }, // Plei 20* 12'
+  {  2485,   180 }, // Plei 20* 13'
+  {  6150,   455 }, // Plei 20* 14'
+  {  5352,   395 }, // Plei 20* 15'
+  {  1258,    90 }, // Plei 20* 17'
+  {  4457,   330 }, // Plei 20* 17'
+  {  1727,   125 }, // Plei 20* 18'
+  {  4556,   337 }, // Plei 20* 20'
+  {  5623,   415 }, // Plei 20* 20'
+  {    12,     1 }, // Plei 20* 21'
+  {  3452,   253 }, // Plei 20* 3.5'
+  {  1411,   102 }, // Plei 20* 4'
+  {  3518,   258 }, // Plei 20* 4'
+  {  1658,   120 }, // Plei 20* 50'
+  {    52,     4 }, // Plei 20* 6'
+  {  1059,    76 }, // Plei 20* 6'
+  {  1685,   122 }, // Plei 20* 6'
+  {  1984,   144 }, // Plei 20* 6'
+  {  3078,   225 }, // Plei 20* 6'
+  {  4858,   360 }, // Plei 20* 6'
+  {  5267,   389 }, // Plei 20* 6'
+  {  5573,   411 }, // Plei 20* 6'
+  {  5560,   410 }, // Plei 20* 70'
+  {    25,     2 }, // Plei 20* 7'
+  {   363,    26 }, // Plei 20* 7'
+  {  2242,   162 }, // Plei 20* 7'
+  {  2562,   186 }, // Plei 20* 7'
+  {  5225,   386 }, // Plei 20* 7'
+  {  1437,   104 }, // Plei 20* 8'
+  {  5517,   407 }, // Plei 20* 9'
+  {  5412,   399 }, // Plei 201* 5'
+  {  3423,   251 }, // Plei 20Â±* 6'
+  {  2915,   212 }, // Plei 21* 17'
+  {  3582,   263 }, // Plei 218* 10'
+  {  1245,    89 }, // Plei 22* 11'
+  {  1971,   143 }, // Plei 22* 12'
+  {  2762,   201 }, // Plei 22* 12'
+  {  3773,   278 }, // Plei 22* 13'
+  {  5909,   437 }, // Plei 22* 31' M39
+  {  2979,   217 }, // Plei 22* 5'
+  {  4145,   306 }, // Plei 22* 5'
+  {  4351,   322 }, // Plei 22* 6'
+  {  4724,   350 }, // Plei 22* 8'
+  {  4619,   342 }, // Plei 22* 9'
+  {  1585,   115 }, // Plei 23* 14'
+  {  1449,   105 }, // Plei 23* 45'
+  {  4032,   298 }, // Plei 24* 25'
+  {  3991,   295 }, // Plei 25* 12'
+  {  4606,   341 }, // Plei 25* 12'
+  {  4181,   309 }, // Plei 25* 14'
+  {  5365,   396 }, // Plei 25* 14'
+  {  4685,   347 }, // Plei 25* 15'
+  {  4470,   331 }, // Plei 25* 2'
+  {   344,    25 }, // Plei 25* 22' Mel15
+  {  4711,   349 }, // Plei 25* 40'
+  {  1475,   107 }, // Plei 25* 4.5'
+  {  3195,   234 }, // Plei 25* 5'
+  {  3506,   257 }, // Plei 25* 5'
+  {  1573,   114 }, // Plei 25* 7'
+  {  4363,   323 }, // Plei 25* 8'
+  {  2737,   199 }, // Plei 25* 9'
+  {  3979,   294 }, // Plei 25* 9'
+  {  5237,   387 }, // Plei 25* 9'
+  {  4882,   362 }, // Plei 25Â±* 13' M21
+  {  2167,   157 }, // Plei 26* 10'
+  {  2280,   165 }, // Plei 28* 12'
+  {  4698,   348 }, // Plei 28* 40'
+  {  4968,   368 }, // Plei 29* 12'
+  {  3207,   235 }, // Plei 30* 10'
+  {   845,    62 }, // Plei 30* 11'
+  {  2877,   209 }, // Plei 30* 12'
+  {  3914,   289 }, // Plei 30* 12'
+  {  4045,   299 }, // Plei 30* 12'
+  {   538,    39 }, // Plei 30* 14'
+  {  5124,   379 }, // Plei 30* 20'
+  {   872,    64 }, // Plei 30* 220'
+  {   485,    35 }, // Plei 30* 23'
+  {  3480,   255 }, // Plei 30* 275'
+  {   107,     8 }, // Plei 30* 3'
+  {  1878,   136 }, // Plei 30* 3.5'
+  {  1462,   106 }, // Plei 30* 35'
+  {     0,     0 }, // Plei 30* 5'
+  {  3636,   267 }, // Plei 30* 5'
+  {  2344,   170 }, // Plei 30* 8'
+  {  3040,   222 }, // Plei 30* 9'
+  {  5818,   430 }, // Plei 35* 25'
+  {  3839,   283 }, // Plei 35* 30'
+  {  4631,   343 }, // Plei 35* 30'
+  {  1489,   108 }, // Plei 35* 3.5'
+  {  2051,   149 }, // Plei 35* 4'
+  {  2217,   160 }, // Plei 35* 45'
+  {  5926,   438 }, // Plei 35* 50'
+  {  4749,   352 }, // Plei 35* 8'
+  {   670,    49 }, // Plei 36* 330'
+  {  5546,   409 }, // Plei 40* 0.5'
+  {  2025,   147 }, // Plei 40* 10'
+  {  2472,   179 }, // Plei 40* 10'
+  {   471,    34 }, // Plei 40* 1.5'
+  {  1740,   126 }, // Plei 40* 12'
+  {  4194,   310 }, // Plei 40* 12'
+  {  1905,   138 }, // Plei 40* 19'
+  {  2428,   176 }, // Plei 40* 20'
+  {  5636,   416 }, // Plei 40* 20'
+  {  6042,   447 }, // Plei 40* 21'
+  {  2384,   173 }, // Plei 40* 22'
+  {  2441,   177 }, // Plei 40* 40'
+  {   820,    60 }, // Plei 40* 5'
+  {  2991,   218 }, // Plei 40* 5'
+  {  4119,   304 }, // Plei 40* 7'
+  {  3736,   275 }, // Plei 40* 8'
+  {  4808,   356 }, // Plei 42* 5'
+  {  1697,   123 }, // Plei 45* 16' M50
+  {  3927,   290 }, // Plei 45* 20'
+  {  5585,   412 }, // Plei 45* 30'
+  {  1186,    85 }, // Plei 45* 5'
+  {  4777,   354 }, // Plei 50* 10'
+  {  1598,   116 }, // Plei 50* 14'
+  {  3940,   291 }, // Plei 50* 15'
+  {  2077,   151 }, // Plei 50* 29' M47
+  {   301,    22 }, // Plei 50* 50'
+  {  2903,   211 }, // Plei 50* 5'
+  {  6315,   468 }, // Plei 51* 2.6'
+  {  4590,   340 }, // Plei 55* 33' M6
+  {  3410,   250 }, // Plei 60* 10'
+  {  4260,   315 }, // Plei 60* 105'
+  {  1630,   118 }, // Plei 60* 12'
+  {   524,    38 }, // Plei 60* 185'
+  {   458,    33 }, // Plei 60* 25'
+  {   684,    50 }, // Plei 60* 37'
+  {  4761,   353 }, // Plei 60* 80' M7
+  {  5772,   426 }, // Plei 6* 4'
+  {  1560,   113 }, // Plei 6Â±* 4'
+  {  2852,   207 }, // Plei 70* 18'
+  {  2370,   172 }, // Plei 70* 370'
+  {  4157,   307 }, // Plei 7* 4'
+  {  5953,   440 }, // Plei 7* 7'
+  {  4569,   338 }, // Plei 8* 
+  {  6302,   467 }, // Plei 8* 0.9'
+  {  4482,   332 }, // Plei 8* 5'
+  {  1144,    82 }, // Plei 8* 6'
+  {  6230,   461 }, // Plei 90* 5'
+  {  1332,    96 }, // Plei 9* 21'
+  {  5453,   402 }, // Plei 929* 5'
+  {  4247,   314 }, // Plei 93* 14'
+  {  1226,    88 }, // Plei20*60' 9-12Gem
+  {  1083,    78 }, // Praes 100* 10'
+  {  5168,   382 }, // Praes 100* 15'
+  {  6203,   459 }, // Praes 100* 25'
+  {  3596,   264 }, // Praes 100* 3'
+  {  1344,    97 }, // Praes 100* 5'
+  {  5038,   373 }, // Praes 100* 5'
+  {  3544,   260 }, // Praes 100* 9'
+  {   207,    15 }, // Praes 100+* 3'
+  {  1110,    80 }, // Praes 100+* 5'
+  {  1173,    84 }, // Praes 10* 4'
+  {  5858,   433 }, // Praes 10* 6'
+  {  3623,   266 }, // Praes ?* 11'
+  {  4901,   363 }, // Praes ?* 1.5'
+  {  4954,   367 }, // Praes ?* 3.7'
+  {  4658,   345 }, // Praes ?* 4.2'
+  {  2711,   197 }, // Praes ?* 5'
+  {  3558,   261 }, // Praes ?* 7'
+  {  6264,   464 }, // Praes ?* 9'
+  {  4017,   297 }, // Praes 115* 12'
+  {    64,     5 }, // Praes 120* 13'
+  {  3326,   244 }, // Praes 120* 15'
+  {   898,    66 }, // Praes 120* 21' M38
+  {  5210,   385 }, // Praes 120* 52'
+  {  2685,   195 }, // Praes 12* 5'
+  {  2180,   158 }, // Praes 125* 27' M46
+  {  3233,   237 }, // Praes 135* 55'x50'
+  {  3370,   247 }, // Praes 137* 12'
+  {  3966,   293 }, // Praes 14* 3'
+  {  2151,   156 }, // Praes (50+)* 7'
+  {  2606,   189 }, // Praes 15* 3'
+  {   249,    18 }, // Praes 15* 5'
+  {  1892,   137 }, // Praes 15* 5'
+  {  5183,   383 }, // Praes 15* 5'
+  {  1611,   117 }, // Praes 160* 38' M41
+  {  1125,    81 }, // Praes 175* 28' M35
+  {  5249,   388 }, // Praes 18* 14' M26
+  {  2010,   146 }, // Praes 200* 10'
+  {   329,    24 }, // Praes 200* 29'
+  {    37,     3 }, // Praes 20* 1.2'
+  {  4915,   364 }, // Praes 20* 15'
+  {  2038,   148 }, // Praes 20* 2'
+  {  2928,   213 }, // Praes 20* 2'
+  {  3710,   273 }, // Praes 20* 5'
+  {  3867,   285 }, // Praes 20* 5'
+  {  4207,   311 }, // Praes 20* 5'
+  {  5688,   420 }, // Praes 20* 5'
+  {  5010,   371 }, // Praes 20* 6'
+  {   192,    14 }, // Praes 20* 7.4'
+  {  5896,   436 }, // Praes 20* 9'
+  {  2548,   185 }, // Praes 20+* 2'
+  {  4375,   324 }, // Praes 20Â±* 5'
+  {  5109,   378 }, // Praes 20Â±* 7'
+  {  4540,   336 }, // Praes 22* 12.5'
+  {  5325,   393 }, // Praes 22* 22'
+  {  4234,   313 }, // Praes 22* 4'
+  {  2138,   155 }, // Praes 24* 9'
+  {  1026,    74 }, // Praes 250* 23' M37
+  {   314,    23 }, // Praes 250* 29'
+  {  2723,   198 }, // Praes 25* 12'
+  {  3356,   246 }, // Praes 25* 12'
+  {  2890,   210 }, // Praes 25* 4'
+  {  6276,   465 }, // Praes 25* 4'
+  {   132,    10 }, // Praes 25* 5'
+  {  4324,   320 }, // Praes 25* 5'
+  {   174,    13 }, // Praes 25* 6' M103
+  {  2511,   182 }, // Praes 25* 7'
+  {  4168,   308 }, // Praes 25* 7'
+  {  2824,   205 }, // Praes 25* 9'
+  {  1931,   140 }, // Praes 25Â±* 5'
+  {  2063,   150 }, // Praes 28* 10'
+  {  5196,   384 }, // Praes 28* 16'
+  {  2574,   187 }, // Praes 30* 11'
+  {  3748,   276 }, // Praes 30* 15'
+  {   753,    55 }, // Praes 30* 18'
+  {  1793,   130 }, // Praes 30* 20'
+  {  5990,   443 }, // Praes 30* 25'
+  {   236,    17 }, // Praes 30* 5'
+  {  2293,   166 }, // Praes 30* 7'
+  {  6004,   444 }, // Praes 30* 7'
+  {  1820,   132 }, // Praes 30* 9'
+  {  2397,   174 }, // Praes 30Â±* 3.5'
+  {  1643,   119 }, // Praes 30Â±* 5'
+  {  4981,   369 }, // Praes 30Â±* 5'
+  {  1198,    86 }, // Praes 35* 10'
+  {  6132,   454 }, // Praes 35* 16' M52
+  {  2656,   193 }, // Praes 35* 2.7'
+  {  4105,   303 }, // Praes 35* 29'
+  {   159,    12 }, // Praes 35* 4.4'
+  {   119,     9 }, // Praes 38* 6'
+  {  3297,   242 }, // Praes 40* 10'
+  {  2671,   194 }, // Praes 40* 12'
+  {  5439,   401 }, // Praes 40* 12'
+  {   145,    11 }, // Praes 40* 13'
+  {  5299,   391 }, // Praes 40* 13'
+  {  4220,   312 }, // Praes 40* 15'
+  {  6163,   456 }, // Praes 40* 15'
+  {  2094,   152 }, // Praes 40* 19'
+  {  2837,   206 }, // Praes 40* 2.3'
+  {  3953,   292 }, // Praes 40* 3'
+  {  5843,   432 }, // Praes 40* 3.5'
+  {  2749,   200 }, // Praes 40* 4'
+  {  5378,   397 }, // Praes 40* 4'
+  {  5504,   406 }, // Praes 40* 5'
+  {  6289,   466 }, // Praes 40* 5'
+  {  6105,   452 }, // Praes 40* 6'
+  {  4736,   351 }, // Praes 40* 7'
+  {  5717,   422 }, // Praes 40* 7'
+  {   617,    45 }, // Praes 40* 9'
+  {   697,    51 }, // Praes 40+* 5'
+  {  3341,   245 }, // Praes 40Â±* 5'
+  {  3311,   243 }, // Praes 44* 2.5'
+  {  1045,    75 }, // Praes 45* 11'
+  {  1765,   128 }, // Praes 45* 12'
+  {  4092,   302 }, // Praes 45* 6'
+  {  3220,   236 }, // Praes 45* 9'
+  {  5883,   435 }, // Praes 47* 3'
+  {  1833,   133 }, // Praes 50* 12'
+  {   630,    46 }, // Praes 50* 23'
+  {  3786,   279 }, // Praes 50* 35'
+  {  3697,   272 }, // Praes 50* 4'
+  {  1714,   124 }, // Praes 50* 7'
+  {  4274,   316 }, // Praes 50* 9'
+  {  1545,   112 }, // Praes 50Â±* 6'
+  {  3812,   281 }, // Praes 60* 10'
+  {  4337,   321 }, // Praes 60* 10'
+  {  1503,   109 }, // Praes 60* 12'
+  {   970,    70 }, // Praes 60* 12' M36
+  {   262,    19 }, // Praes 60* 16'
+  {  5150,   381 }, // Praes 60* 32' M25
+  {   413,    30 }, // Praes 60* 35' M34
+  {  4058,   300 }, // Praes 60* 40'
+  {   726,    53 }, // Praes 60* 45'
+  {   644,    47 }, // Praes 60* 6'
+  {  3397,   249 }, // Praes 60* 6'
+  {  2318,   168 }, // Praes 60* 8'
+  {  2125,   154 }, // Praes 60* 9'
+  {  2588,   188 }, // Praes 60* 95' M44
+  {   510,    37 }, // Praes 65* 10'
+  {  4405,   326 }, // Praes 65* 10'
+  {  1212,    87 }, // Praes 65* 12'
+  {  2414,   175 }, // Praes 65* 21'
+  {  3466,   254 }, // Praes 70* 15'
+  {  3090,   226 }, // Praes 70* 16'
+  {  2356,   171 }, // Praes 70* 29'
+  {   767,    56 }, // Praes 70* 42'
+  {  2199,   159 }, // Praes 80* 22' M93
+  {  2331,   169 }, // Praes 80* 8'
+  {   886,    65 }, // Praes 8* 6'
+  {  6017,   445 }, // Praes 83* 2'
+  {   806,    59 }, // Praes 85* 16'
+  {  4790,   355 }, // Praes 85* 30' M23
+  {  2788,   203 }, // Praes 90* 29' M67
+  {  5730,   423 }, // Praes 90* 31'
+  {  2454,   178 }, // Praes 90* 54' M48
+  {  3052,   223 }, // Praes 93* 5'
+  {  4513,   334 }, // uNorm 10* 2.5'
+  {  5023,   372 }, // uNorm 10Â±* 4'
+  {  1961,   142 }, // uNorm ?* 
+  {  3027,   221 }, // uNorm 14* 7'
+  {  1946,   141 }, // uNorm 15* 2.5'
+  {   604,    44 }, // uNorm 15* 7'
+  {  1155,    83 }, // uNorm 16* 40'x30'
+  {  5661,   418 }, // uNorm 16* 4.5'
+  {  1865,   135 }, // uNorm 20* 8'
+  {  4131,   305 }, // uNorm 40* 12'
+  {  1531,   111 }, // uNorm 45* 20'
+  {  1779,   129 }, // uNorm 60* 20'
+  {   580,    42 }, // uNorm 7* 4'
+  {  1517,   110 }, // uNorm 8* 3.2'
+  {  2806,   204 }, // uNorm 8* 5' Mkn18
+  {  5425,   400 }, // uNorm 8Â±* 1'
+};
+#endif
+
+// messier.h, messier_c.h
+#if defined(NUM_MESSIER) && NUM_MESSIER == 109
+const name_idx_t NameIdx_Messier_109[37] = {
+  {   302,    43 }, // Beehive Clstr
+  {   430,    76 }, // Cetus A
+  {   449,    81 }, // Cigar Gxy
+  {   365,    63 }, // Black Eye Gxy
+  {   438,    80 }, // Bode's Gxy
+  {   200,    30 }, // Andromeda Gxy
+  {     0,     0 }, // Crab Nebula
+  {    12,     5 }, // Butterfly Clstr
+  {   111,    15 }, // Eagle Nebula
+  {   283,    42 }, // De Mairan's Nebula
+  {   184,    26 }, // Dumbbell Nebula
+  {   395,    65 }, // Hamburger Gxy
+  {    72,    12 }, // Herc. Globlr Clstr
+  {    91,    14 }, // Great Pegasus Clstr
+  {    42,     7 }, // Lagoon Nebula
+  {   379,    64 }, // Leo Triplet Gxy
+  {   409,    75 }, // Little Dumbbell Nbla
+  {   124,    16 }, // Omega Nebula
+  {   270,    41 }, // Orion Nebula
+  {   487,    96 }, // Owl Nebula
+  {   151,    21 }, // Sagitt. Clstr
+  {   165,    23 }, // Sagitt. Star Cloud
+  {   339,    56 }, // Ring Nebula
+  {   229,    35 }, // Pinwheel Clstr
+  {   498,   100 }, // Pinwheel Gxy
+  {   316,    44 }, // Pleiades
+  {   511,   102 }, // Sombrero Gxy
+  {   459,    82 }, // South. Pinwheel Gxy
+  {   244,    37 }, // Starfish Clstr
+  {   351,    62 }, // Sunflower Gxy
+  {    28,     6 }, // Ptolemy Clstr
+  {   479,    86 }, // Virgo A
+  {   214,    32 }, // Triangulum Gxy
+  {   137,    19 }, // Trifid Nebula
+  {   325,    50 }, // Whirlpool Gxy
+  {    56,    10 }, // Wild Duck Clstr
+  {   259,    39 }, // Winnecke 4
+};
+#endif
+
+// stars.h, stars_vc.h
+#if defined(NUM_STARS) && NUM_STARS == 408
+const name_idx_t NameIdx_Stars_408[188] = {
+  {   680,   154 }, // Acamar
+  {  1084,   282 }, // Baham
+  {   653,   149 }, // Achernar
+  {   316,    62 }, // Canopus
+  {   113,    29 }, // Capella
+  {   360,    71 }, // Caph
+  {   687,   161 }, // Castor
+  {   501,   114 }, // Acrux
+  {   453,   101 }, // Baten
+  {   832,   208 }, // Adhafera
+  {   232,    48 }, // Adhara
+  {   983,   259 }, // Bellatrix
+  {   966,   257 }, // Betelgeuse
+  {   841,   210 }, // Chertan
+  {  1305,   357 }, // Ain
+  {  1215,   332 }, // Chow
+  {   737,   175 }, // Al Dhanab
+  {   817,   205 }, // Al Gieba
+  {   279,    57 }, // Al Giedi
+  {   728,   173 }, // Al Na'ir
+  {   792,   200 }, // Al Nair
+  {  1220,   340 }, // Al Nasl
+  {  1189,   328 }, // Al Niyat
+  {    47,    13 }, // Al Thalimain
+  {    85,    17 }, // Albali
+  {   560,   124 }, // Albireo
+  {  1309,   359 }, // Alcyone
+  {  1274,   353 }, // Aldebaran
+  {   414,    92 }, // Alderamin
+  {   701,   163 }, // Alhena
+  {  1059,   278 }, // Algenib
+  {  1107,   286 }, // Algol
+  {   539,   121 }, // Algorab
+  {  1353,   376 }, // Alioth
+  {  1366,   378 }, // Alkaid
+  {    17,     2 }, // Almach
+  {  1284,   354 }, // Alnath
+  {  1001,   261 }, // Alnilam
+  {  1009,   262 }, // Alnitak
+  {    31,     8 }, // Alshain
+  {   784,   188 }, // Alphard
+  {   484,   110 }, // Alphecca
+  {     0,     0 }, // Alpheratz
+  {   424,    93 }, // Alphirk
+  {    24,     7 }, // Altair
+  {   621,   141 }, // Altais
+  {   245,    50 }, // Aludra
+  {  1436,   384 }, // Alula Borealis
+  {  1118,   296 }, // Ankaa
+  {   268,    56 }, // Cor Caroli
+  {  1149,   314 }, // Antares
+  {   168,    37 }, // Arcturus
+  {   849,   213 }, // Arneb
+  {  1139,   306 }, // Asmidiske
+  {   342,    66 }, // Aspidiske
+  {  1113,   290 }, // Atik
+  {   336,    64 }, // Avior
+  {   662,   150 }, // Cursa
+  {  1524,   403 }, // Auva
+  {   288,    58 }, // Dabih
+  {   637,   145 }, // Edasich
+  {   554,   123 }, // Deneb
+  {   302,    60 }, // Deneb Algiedi
+  {   808,   204 }, // Denebola
+  {   446,    99 }, // Diphda
+  {   613,   140 }, // Eltanin
+  {  1067,   279 }, // Enif
+  {  1124,   300 }, // Fomalhaut
+  {   432,    94 }, // Er Rai
+  {  1166,   317 }, // Dschubba
+  {  1327,   372 }, // Dubhe
+  {   239,    49 }, // Furud
+  {   514,   116 }, // Gacrux
+  {   400,    79 }, // Hadar
+  {    98,    27 }, // Hamal
+  {  1542,   405 }, // Heze
+  {   573,   127 }, // Gienah
+  {   526,   120 }, // Gienah Corvi
+  {  1072,   280 }, // Homan
+  {   260,    55 }, // Gomeisa
+  {  1157,   315 }, // Graffias
+  {   645,   147 }, // Grumium
+  {   156,    36 }, // Kabdhilinan
+  {   628,   143 }, // Kaou Pih
+  {  1254,   345 }, // Kaus Borealis
+  {  1239,   342 }, // Kaus Australis
+  {  1228,   341 }, // Kaus Media
+  {   930,   247 }, // Kelb al Rai
+  {  1198,   330 }, // Lesath
+  {  1467,   391 }, // Kocab
+  {   759,   178 }, // Kornephoros
+  {   521,   119 }, // Kraz
+  {  1017,   264 }, // Na'ir al Saif
+  {   142,    32 }, // Maaz
+  {  1134,   304 }, // Naos
+  {   777,   185 }, // Marfik
+  {   294,    59 }, // Nashira
+  {  1045,   276 }, // Markab
+  {  1078,   281 }, // Matar
+  {   365,    72 }, // Navi
+  {   714,   165 }, // Mebsuta
+  {  1346,   375 }, // Megrez
+  {   177,    38 }, // Nekkar
+  {   893,   226 }, // Men
+  {   439,    98 }, // Menkab
+  {   121,    30 }, // Menkalinan
+  {   406,    85 }, // Menkent
+  {  1333,   373 }, // Merak
+  {  1487,   395 }, // Merkab
+  {   324,    63 }, // Miaplacidus
+  {   855,   214 }, // Nihal
+  {   547,   122 }, // Minkar
+  {   507,   115 }, // Mimosa
+  {   993,   260 }, // Mintaka
+  {    10,     1 }, // Mirach
+  {  1100,   285 }, // Mirfak
+  {   219,    46 }, // Mirzam
+  {  1360,   377 }, // Mizar
+  {  1317,   369 }, // Mothallah
+  {  1268,   350 }, // Nunki
+  {  1451,   386 }, // Muscida
+  {   493,   111 }, // Nusakan
+  {   204,    43 }, // Muphrid
+  {  1090,   284 }, // Sadalbari
+  {    60,    14 }, // Sadalmelik
+  {    71,    15 }, // Sadalsud
+  {   147,    33 }, // Sadatoni
+  {   568,   125 }, // Sadr
+  {  1052,   277 }, // Scheat
+  {   352,    70 }, // Schedar
+  {   459,   104 }, // Schemali
+  {  1031,   265 }, // Saiph
+  {   675,   152 }, // Rana
+  {   747,   177 }, // Ras Algethi
+  {   919,   246 }, // Rasalhague
+  {  1175,   321 }, // Sargas
+  {   771,   180 }, // Sarin
+  {   604,   139 }, // Rastaban
+  {  1037,   272 }, // Peacock
+  {   378,    74 }, // Segin
+  {   184,    39 }, // Seginus
+  {  1481,   393 }, // Regor
+  {   800,   203 }, // Regulus
+  {   473,   108 }, // Phakt
+  {  1182,   324 }, // Shaula
+  {  1339,   374 }, // Phecda
+  {   902,   237 }, // Sheliak
+  {   104,    28 }, // Sheratan
+  {  1473,   392 }, // Pherkab
+  {   977,   258 }, // Rigel
+  {   384,    77 }, // Rigel Kentaurus
+  {   212,    45 }, // Sirius
+  {    80,    16 }, // Skat
+  {  1459,   390 }, // Polaris
+  {   694,   162 }, // Pollux
+  {   589,   135 }, // Rotanev
+  {  1510,   400 }, // Spica
+  {   132,    31 }, // Prijipati
+  {  1291,   355 }, // Primus Hyadum
+  {   252,    54 }, // Procyon
+  {   370,    73 }, // Ruchbah
+  {   580,   134 }, // Svalocin
+  {  1494,   396 }, // Suhail
+  {   192,    41 }, // Pulcherrima
+  {   910,   238 }, // Sulaphat
+  {    92,    20 }, // Tchou
+  {  1373,   380 }, // Talitha Boreali
+  {  1389,   381 }, // Talitha Austral
+  {  1405,   382 }, // Tania Borealis
+  {  1420,   383 }, // Tania Australis
+  {    39,     9 }, // Tarazed
+  {   468,   107 }, // Tarf
+  {   897,   236 }, // Vega
+  {   722,   171 }, // Tejat
+  {  1529,   404 }, // Vindemiatrix
+  {   597,   138 }, // Thuban
+  {  1205,   331 }, // Unukalhai
+  {  1501,   398 }, // Tseen Ke
+  {   708,   164 }, // Wasat
+  {   668,   151 }, // Zaurak
+  {  1516,   401 }, // Zawijah
+  {   479,   109 }, // Wazn
+  {   952,   250 }, // Yed Posterior
+  {   942,   249 }, // Yed Prior
+  {   226,    47 }, // Wezen
+  {   826,   206 }, // Zozma
+  {   877,   222 }, // Zuben el Chamal
+  {   861,   221 }, // Zuben El Genubi
+};
+#endif
+
+// mod1_treasure.csv, names and object ids with the row in the file and J2000 RA (hours) and Dec (degrees)
+const char *NameIdx_Treasure_Names=
+"Caroline Herschel;NGC189;Caroline Herschel;NGC225;Pacman;NGC281;NGC288;Mirachms Ghost;NGC404;Little "
+"Spindle;NGC584;Caroline Herschel;NGC659;Fiddlehead;NGC772;NGC908;PerseusLenticular;NGC1023;Eye of Go"
+"d;NGC1232;Snow Collar;NGC1291;Fornax A;NGC1316;Alpha Per. Moving;Mel20;Embryo;NGC1333;Comet;NGC1360;"
+"NGC1365;NGC1399;NGC1398;NGC1404;Kembles Cascade;Kem1;Oyster;NGC1501;Jolly Roger;NGC1502;Cleopatrams "
+"Eye;NGC1535;m&m Double;NGC1528;m&m Double;NGC1545;Pirate Moon;NGC1647;Spirograph Nebula;IC418;Lambda"
+" Orionis;Cr69;Coal Car Cluster;NGC1981;Lost Jewel Orion;Cr72;Mermaidms Purse;NGC1977;13th Pearl;NGC1"
+"999;Lips;NGC2024;Cederblad 62;NGC2163;Shopping Cart;NGC2169;NGC2175;Christmas Tree;NGC2264;Hagridms "
+"Dragon;NGC2301;Averyms Island;NGC2353;Albino Butterfly;NGC2440;S. Scorpion;NGC2451;NGC2467;Golden Ea"
+"rring;NGC2547;The Dish;NGC2539;Heart&Dagger;NGC2546;UFO;NGC2683;NGC2655;Cats Eye;NGC2841;Lacaille;IC"
+"2488;NGC2903;Little Pinwheel;NGC3184;Lacaille;NGC3228;Lacaille;NGC3293;Sliced Onion;NGC3344;NGC3521;"
+"Frame;NGC3621;Kg Hamletms Ghost;NGC3628;NGC4214;Silver Streak;NGC4216;NGC4361;Coma Berenices;Mel111;"
+"Cocoon;NGC4490;Theoreticianms;IC3568;Hairy Eyebrow;NGC4526;Fabergem Egg;NGC4605;MessiermsHockStic;NG"
+"C4656;Vinyl LP;NGC4699;NGC4725;Iotams Ghost;NGC5102;Lacaille;NGC5281;NGC5363;Lacaille;NGC5662;Blade&"
+"Pearl;NGC5746;Foolms Gold;NGC5866;Ghost;NGC5897;NGC5986;Turtle;NGC6210;Lacaille;NGC6242;Moth Wing;NG"
+"C6281;Little Ghost;NGC6369;Phantom;NGC6400;Caroline Herschel;IC4665;Box;NGC6445;Lost-In-Space;NGC650"
+"3;Silver Nugget;NGC6441;Barnardms;Dead Man Chest;NGC6520;Starfish;NGC6544;Emerald Eye;NGC6572;NGC662"
+"4;Caroline Herschel;NGC6633;Tweedledee;IC4756;Flying Unicorn;NGC6709;NGC6712;NGC6723;Coathanger;Cr39"
+"9;Caroline Herschel;NGC6819;Little Gem;NGC6818;Caroline Herschel;NGC6866;Mothra;NGC6940;N. Coalsack;"
+"Coat Button Neb;NGC7008;Pink Pillow;NGC7027;IC1396 Neb;Tr37;Caroline Herschel;NGC7380;Alessi;OMe1;Ca"
+"roline Herschel;NGC7789;Bondms;NGC7793;Giant Squid;NGC134;NGC1245;NGC1300;NGC1491;NGC1514;NGC2022;NG"
+"C3114;NGC3918;Retina;IC4406;NGC5617;NGC5846;Splinter;NGC5907;NGC5927;IC4603;NGC6356;NGC6388;NGC6664;"
+"Ghost Moon;NGC6781;Blue Flash;NGC6905;Ghost Bush;NGC6939;";
+
+const name_idx_t NameIdx_Treasure[223] = {
+  {   585,    32 }, // 13th Pearl
+  {  1524,    86 }, // Barnardms
+  {     0,     0 }, // Caroline Herschel
+  {    25,     1 }, // Caroline Herschel
+  {   115,     6 }, // Caroline Herschel
+  {  1443,    82 }, // Caroline Herschel
+  {  1602,    91 }, // Caroline Herschel
+  {  1702,    97 }, // Caroline Herschel
+  {  1747,    99 }, // Caroline Herschel
+  {  1860,   105 }, // Caroline Herschel
+  {  1898,   107 }, // Caroline Herschel
+  {   872,    48 }, // Cats Eye
+  {   617,    34 }, // Cederblad 62
+  {   668,    37 }, // Christmas Tree
+  {  1294,    73 }, // Blade&Pearl
+  {   738,    40 }, // Albino Butterfly
+  {   388,    23 }, // Cleopatrams Eye
+  {  1886,   106 }, // Alessi
+  {   247,    13 }, // Alpha Per. Moving
+  {  2119,   127 }, // Blue Flash
+  {   514,    29 }, // Coal Car Cluster
+  {  1100,    62 }, // Cocoon
+  {  1800,   102 }, // Coat Button Neb
+  {  1685,    96 }, // Coathanger
+  {  1078,    61 }, // Coma Berenices
+  {  1924,   108 }, // Bondms
+  {   286,    15 }, // Comet
+  {  1468,    83 }, // Box
+  {  1696,    96 }, // Cr399
+  {   509,    28 }, // Cr69
+  {   556,    30 }, // Cr72
+  {   715,    39 }, // Averyms Island
+  {  1159,    65 }, // Fabergem Egg
+  {  1534,    87 }, // Dead Man Chest
+  {   140,     7 }, // Fiddlehead
+  {  1646,    93 }, // Flying Unicorn
+  {   271,    14 }, // Embryo
+  {  1574,    89 }, // Emerald Eye
+  {  1314,    74 }, // Foolms Gold
+  {   230,    12 }, // Fornax A
+  {  1000,    56 }, // Frame
+  {   191,    10 }, // Eye of God
+  {  1844,   104 }, // IC1396 Neb
+  {   898,    49 }, // IC2488
+  {  1130,    63 }, // IC3568
+  {   488,    27 }, // IC418
+  {  2021,   117 }, // IC4406
+  {  2069,   122 }, // IC4603
+  {  1461,    82 }, // IC4665
+  {   691,    38 }, // Hagridms Dragon
+  {  1639,    92 }, // IC4756
+  {  1137,    64 }, // Hairy Eyebrow
+  {   831,    45 }, // Heart&Dagger
+  {  1939,   109 }, // Giant Squid
+  {  1334,    75 }, // Ghost
+  {  2138,   128 }, // Ghost Bush
+  {  2100,   126 }, // Ghost Moon
+  {   791,    43 }, // Golden Earring
+  {  1231,    69 }, // Iotams Ghost
+  {   889,    49 }, // Lacaille
+  {   937,    52 }, // Lacaille
+  {   954,    53 }, // Lacaille
+  {  1252,    70 }, // Lacaille
+  {  1277,    72 }, // Lacaille
+  {  1371,    78 }, // Lacaille
+  {   494,    28 }, // Lambda Orionis
+  {   348,    20 }, // Kem1
+  {   332,    20 }, // Kembles Cascade
+  {  1014,    57 }, // Kg Hamletms Ghost
+  {   604,    33 }, // Lips
+  {  1728,    98 }, // Little Gem
+  {  1406,    80 }, // Little Ghost
+  {   913,    51 }, // Little Pinwheel
+  {    93,     5 }, // Little Spindle
+  {   368,    22 }, // Jolly Roger
+  {   539,    30 }, // Lost Jewel Orion
+  {  1480,    84 }, // Lost-In-Space
+  {  1788,   101 }, // N. Coalsack
+  {   412,    24 }, // m&m Double
+  {   431,    25 }, // m&m Double
+  {  1093,    61 }, // Mel111
+  {   265,    13 }, // Mel20
+  {   561,    31 }, // Mermaidms Purse
+  {  1180,    66 }, // MessiermsHockStic
+  {   183,     9 }, // NGC1023
+  {   202,    10 }, // NGC1232
+  {  1958,   110 }, // NGC1245
+  {   222,    11 }, // NGC1291
+  {  1966,   111 }, // NGC1300
+  {   239,    12 }, // NGC1316
+  {   278,    14 }, // NGC1333
+  {  1951,   109 }, // NGC134
+  {   292,    15 }, // NGC1360
+  {   300,    16 }, // NGC1365
+  {   316,    18 }, // NGC1398
+  {   308,    17 }, // NGC1399
+  {   324,    19 }, // NGC1404
+  {  1974,   112 }, // NGC1491
+  {   360,    21 }, // NGC1501
+  {   380,    22 }, // NGC1502
+  {  1982,   113 }, // NGC1514
+  {   423,    24 }, // NGC1528
+  {   404,    23 }, // NGC1535
+  {   442,    25 }, // NGC1545
+  {   462,    26 }, // NGC1647
+  {    18,     0 }, // NGC189
+  {   577,    31 }, // NGC1977
+  {   531,    29 }, // NGC1981
+  {   596,    32 }, // NGC1999
+  {  1990,   114 }, // NGC2022
+  {   609,    33 }, // NGC2024
+  {   630,    34 }, // NGC2163
+  {   652,    35 }, // NGC2169
+  {   660,    36 }, // NGC2175
+  {    43,     1 }, // NGC225
+  {   683,    37 }, // NGC2264
+  {   707,    38 }, // NGC2301
+  {   730,    39 }, // NGC2353
+  {   755,    40 }, // NGC2440
+  {   775,    41 }, // NGC2451
+  {   783,    42 }, // NGC2467
+  {   823,    44 }, // NGC2539
+  {   844,    45 }, // NGC2546
+  {   806,    43 }, // NGC2547
+  {   864,    47 }, // NGC2655
+  {   856,    46 }, // NGC2683
+  {    57,     2 }, // NGC281
+  {   881,    48 }, // NGC2841
+  {    64,     3 }, // NGC288
+  {   905,    50 }, // NGC2903
+  {  1998,   115 }, // NGC3114
+  {   929,    51 }, // NGC3184
+  {   946,    52 }, // NGC3228
+  {   963,    53 }, // NGC3293
+  {   984,    54 }, // NGC3344
+  {   992,    55 }, // NGC3521
+  {  1006,    56 }, // NGC3621
+  {  1032,    57 }, // NGC3628
+  {  2006,   116 }, // NGC3918
+  {    86,     4 }, // NGC404
+  {  1040,    58 }, // NGC4214
+  {  1062,    59 }, // NGC4216
+  {  1070,    60 }, // NGC4361
+  {  1107,    62 }, // NGC4490
+  {  1151,    64 }, // NGC4526
+  {  1172,    65 }, // NGC4605
+  {  1198,    66 }, // NGC4656
+  {  1215,    67 }, // NGC4699
+  {  1223,    68 }, // NGC4725
+  {  1244,    69 }, // NGC5102
+  {  1261,    70 }, // NGC5281
+  {  1269,    71 }, // NGC5363
+  {  2028,   118 }, // NGC5617
+  {  1286,    72 }, // NGC5662
+  {  1306,    73 }, // NGC5746
+  {   108,     5 }, // NGC584
+  {  2036,   119 }, // NGC5846
+  {  1326,    74 }, // NGC5866
+  {  1340,    75 }, // NGC5897
+  {  2053,   120 }, // NGC5907
+  {  2061,   121 }, // NGC5927
+  {  1348,    76 }, // NGC5986
+  {  1363,    77 }, // NGC6210
+  {  1380,    78 }, // NGC6242
+  {  1398,    79 }, // NGC6281
+  {  2076,   123 }, // NGC6356
+  {  1419,    80 }, // NGC6369
+  {  2084,   124 }, // NGC6388
+  {  1435,    81 }, // NGC6400
+  {  1516,    85 }, // NGC6441
+  {  1472,    83 }, // NGC6445
+  {  1494,    84 }, // NGC6503
+  {  1549,    87 }, // NGC6520
+  {  1566,    88 }, // NGC6544
+  {  1586,    89 }, // NGC6572
+  {   133,     6 }, // NGC659
+  {  1594,    90 }, // NGC6624
+  {  1620,    91 }, // NGC6633
+  {  2092,   125 }, // NGC6664
+  {  1661,    93 }, // NGC6709
+  {  1669,    94 }, // NGC6712
+  {  1677,    95 }, // NGC6723
+  {  2111,   126 }, // NGC6781
+  {  1739,    98 }, // NGC6818
+  {  1720,    97 }, // NGC6819
+  {  1765,    99 }, // NGC6866
+  {  2130,   127 }, // NGC6905
+  {  2149,   128 }, // NGC6939
+  {  1780,   100 }, // NGC6940
+  {  1816,   102 }, // NGC7008
+  {  1836,   103 }, // NGC7027
+  {  1878,   105 }, // NGC7380
+  {   151,     7 }, // NGC772
+  {  1916,   107 }, // NGC7789
+  {  1931,   108 }, // NGC7793
+  {   158,     8 }, // NGC908
+  {    71,     4 }, // Mirachms Ghost
+  {  1893,   106 }, // OMe1
+  {  1388,    79 }, // Moth Wing
+  {  1773,   100 }, // Mothra
+  {   353,    21 }, // Oyster
+  {   763,    41 }, // S. Scorpion
+  {    50,     2 }, // Pacman
+  {   165,     9 }, // PerseusLenticular
+  {  2014,   117 }, // Retina
+  {  1427,    81 }, // Phantom
+  {  1502,    85 }, // Silver Nugget
+  {  1048,    59 }, // Silver Streak
+  {  1824,   103 }, // Pink Pillow
+  {   638,    35 }, // Shopping Cart
+  {   450,    26 }, // Pirate Moon
+  {   971,    54 }, // Sliced Onion
+  {   210,    11 }, // Snow Collar
+  {   470,    27 }, // Spirograph Nebula
+  {  2044,   120 }, // Splinter
+  {  1557,    88 }, // Starfish
+  {   852,    46 }, // UFO
+  {   814,    44 }, // The Dish
+  {  1115,    63 }, // Theoreticianms
+  {  1206,    67 }, // Vinyl LP
+  {  1855,   104 }, // Tr37
+  {  1356,    77 }, // Turtle
+  {  1628,    92 }, // Tweedledee
+};
+
+const name_idx_coord_t NameIdx_Treasure_Coords[223] = {
+  {   5.6083,  -6.7000 },
+  {  17.9633,   4.6667 },
+  {   0.6600,  61.1000 },
+  {   0.7267,  61.7667 },
+  {   1.7400,  60.6667 },
+  {  17.7700,   5.7167 },
+  {  18.4533,   6.5000 },
+  {  19.6883,  40.1833 },
+  {  20.0650,  44.1500 },
+  {  22.7883,  58.1333 },
+  {  23.9583,  56.7167 },
+  {   9.3667,  50.9833 },
+  {   6.1300,  18.6500 },
+  {   6.6833,   9.9000 },
+  {  14.7483,   1.9500 },
+  {   7.6983, -18.2000 },
+  {   4.2383, -12.7333 },
+  {  23.6783,   7.9500 },
+  {   3.4050,  49.8667 },
+  {  20.3733,  20.1000 },
+  {   5.5867,  -4.4333 },
+  {  12.5100,  41.6500 },
+  {  21.0083,  54.5500 },
+  {  19.4367,  20.1000 },
+  {  12.4183,  26.1167 },
+  {  23.9633, -32.5833 },
+  {   3.5533, -25.8667 },
+  {  17.8200, -20.0167 },
+  {  19.4367,  20.1000 },
+  {   5.5833,   9.9333 },
+  {   5.5900,  -5.9167 },
+  {   7.2417, -10.2667 },
+  {  12.6667,  61.6000 },
+  {  18.0567, -27.9000 },
+  {   1.9883,  19.0000 },
+  {  18.8583,  10.3333 },
+  {   3.4883,  31.4167 },
+  {  18.2017,   6.8500 },
+  {  15.1083,  55.7667 },
+  {   3.3783, -37.2000 },
+  {  11.3050, -32.8167 },
+  {   3.1633, -20.5833 },
+  {  21.6500,  57.5000 },
+  {   9.4567, -56.9500 },
+  {  12.5517,  82.5667 },
+  {   5.4583, -12.7000 },
+  {  14.3733, -44.1500 },
+  {  16.4267, -24.4667 },
+  {  17.7700,   5.7167 },
+  {   6.8633,   0.4667 },
+  {  18.6483,   5.4333 },
+  {  12.5667,   7.7000 },
+  {   8.2067, -37.6167 },
+  {   0.5067, -33.2500 },
+  {  15.2900, -21.0167 },
+  {  20.5250,  60.6667 },
+  {  19.3083,   6.5333 },
+  {   8.1700, -49.2167 },
+  {  13.3667, -36.6333 },
+  {   9.4567, -56.9500 },
+  {  10.3567, -51.7167 },
+  {  10.5967, -58.2167 },
+  {  13.7767, -62.9167 },
+  {  14.5917, -56.6667 },
+  {  16.9250, -39.4667 },
+  {   5.5833,   9.9333 },
+  {   3.9567,  63.0667 },
+  {   3.9567,  63.0667 },
+  {  11.3383,  13.5833 },
+  {   5.6983,  -1.8500 },
+  {  19.7333, -14.1500 },
+  {  17.4883, -23.7667 },
+  {  10.3050,  41.4167 },
+  {   1.5217,  -6.8667 },
+  {   4.1300,  62.3333 },
+  {   5.5900,  -5.9167 },
+  {  17.8233,  70.1500 },
+  {  20.6667,  41.0000 },
+  {   4.2550,  51.2167 },
+  {   4.3483,  50.2500 },
+  {  12.4183,  26.1167 },
+  {   3.4050,  49.8667 },
+  {   5.5917,  -4.8667 },
+  {  12.7333,  32.1667 },
+  {   2.6733,  39.0667 },
+  {   3.1633, -20.5833 },
+  {   3.2450,  47.2333 },
+  {   3.2883, -41.1000 },
+  {   3.3283, -19.4167 },
+  {   3.3783, -37.2000 },
+  {   3.4883,  31.4167 },
+  {   0.5067, -33.2500 },
+  {   3.5533, -25.8667 },
+  {   3.5600, -36.1333 },
+  {   3.6483, -26.3333 },
+  {   3.6417, -35.4500 },
+  {   3.6483, -35.6000 },
+  {   4.0567,  51.3167 },
+  {   4.1167,  60.9167 },
+  {   4.1300,  62.3333 },
+  {   4.1500,  30.7833 },
+  {   4.2550,  51.2167 },
+  {   4.2383, -12.7333 },
+  {   4.3483,  50.2500 },
+  {   4.7617,  19.1167 },
+  {   0.6600,  61.1000 },
+  {   5.5917,  -4.8667 },
+  {   5.5867,  -4.4333 },
+  {   5.6083,  -6.7000 },
+  {   5.7017,   9.0833 },
+  {   5.6983,  -1.8500 },
+  {   6.1300,  18.6500 },
+  {   6.1400,  13.9667 },
+  {   6.1617,  20.5000 },
+  {   0.7267,  61.7667 },
+  {   6.6833,   9.9000 },
+  {   6.8633,   0.4667 },
+  {   7.2417, -10.2667 },
+  {   7.6983, -18.2000 },
+  {   7.7567, -37.9500 },
+  {   7.8750, -26.4000 },
+  {   8.1767, -12.8167 },
+  {   8.2067, -37.6167 },
+  {   8.1700, -49.2167 },
+  {   8.9267,  78.2167 },
+  {   8.8783,  33.4167 },
+  {   0.8800,  56.6167 },
+  {   9.3667,  50.9833 },
+  {   0.8800, -26.5833 },
+  {   9.5367,  21.5000 },
+  {  10.0450, -60.1000 },
+  {  10.3050,  41.4167 },
+  {  10.3567, -51.7167 },
+  {  10.5967, -58.2167 },
+  {  10.7250,  24.9167 },
+  {  11.0967,  -0.0333 },
+  {  11.3050, -32.8167 },
+  {  11.3383,  13.5833 },
+  {  11.8383, -57.1833 },
+  {   1.1567,  35.7167 },
+  {  12.2600,  36.3333 },
+  {  12.2650,  13.1500 },
+  {  12.4083, -18.7833 },
+  {  12.5100,  41.6500 },
+  {  12.5667,   7.7000 },
+  {  12.6667,  61.6000 },
+  {  12.7333,  32.1667 },
+  {  12.8167,  -8.6667 },
+  {  12.8400,  25.5000 },
+  {  13.3667, -36.6333 },
+  {  13.7767, -62.9167 },
+  {  13.9350,   5.2500 },
+  {  14.4950, -60.7000 },
+  {  14.5917, -56.6667 },
+  {  14.7483,   1.9500 },
+  {   1.5217,  -6.8667 },
+  {  15.1083,   1.6000 },
+  {  15.1083,  55.7667 },
+  {  15.2900, -21.0167 },
+  {  15.2650,  56.3333 },
+  {  15.4667, -50.6667 },
+  {  15.7683, -37.7833 },
+  {  16.7417,  23.8000 },
+  {  16.9250, -39.4667 },
+  {  17.0800, -37.8833 },
+  {  17.3933, -17.8167 },
+  {  17.4883, -23.7667 },
+  {  17.6050, -44.7333 },
+  {  17.6700, -36.9667 },
+  {  17.8367, -37.0500 },
+  {  17.8200, -20.0167 },
+  {  17.8233,  70.1500 },
+  {  18.0567, -27.9000 },
+  {  18.1217, -25.0000 },
+  {  18.2017,   6.8500 },
+  {   1.7400,  60.6667 },
+  {  18.3950, -30.3667 },
+  {  18.4533,   6.5000 },
+  {  18.6083,  -8.1833 },
+  {  18.8583,  10.3333 },
+  {  18.8850,  -8.7000 },
+  {  18.9917, -36.6333 },
+  {  19.3083,   6.5333 },
+  {  19.7333, -14.1500 },
+  {  19.6883,  40.1833 },
+  {  20.0650,  44.1500 },
+  {  20.3733,  20.1000 },
+  {  20.5250,  60.6667 },
+  {  20.5750,  28.2833 },
+  {  21.0083,  54.5500 },
+  {  21.1167,  42.2333 },
+  {  22.7883,  58.1333 },
+  {   1.9883,  19.0000 },
+  {  23.9583,  56.7167 },
+  {  23.9633, -32.5833 },
+  {   2.3850, -21.2333 },
+  {   1.1567,  35.7167 },
+  {  23.6783,   7.9500 },
+  {  17.0800, -37.8833 },
+  {  20.5750,  28.2833 },
+  {   4.1167,  60.9167 },
+  {   7.7567, -37.9500 },
+  {   0.8800,  56.6167 },
+  {   2.6733,  39.0667 },
+  {  14.3733, -44.1500 },
+  {  17.6700, -36.9667 },
+  {  17.8367, -37.0500 },
+  {  12.2650,  13.1500 },
+  {  21.1167,  42.2333 },
+  {   6.1400,  13.9667 },
+  {   4.7617,  19.1167 },
+  {  10.7250,  24.9167 },
+  {   3.2883, -41.1000 },
+  {   5.4583, -12.7000 },
+  {  15.2650,  56.3333 },
+  {  18.1217, -25.0000 },
+  {   8.8783,  33.4167 },
+  {   8.1767, -12.8167 },
+  {  12.5517,  82.5667 },
+  {  12.8167,  -8.6667 },
+  {  21.6500,  57.5000 },
+  {  16.7417,  23.8000 },
+  {  18.6483,   5.4333 },
+};
+
+// sections for the catalogs compiled in, the runtime skips any not listed in catalog[]
+const name_idx_section_t NameIdx_Sections[] = {
+#if defined(NUM_CALDWELL) && NUM_CALDWELL == 109
+  { Cat_Caldwell, CAT_DSO, Cat_Caldwell_Names, NameIdx_Caldwell_109_caldwell, NULL, 46 },
+#endif
+#if defined(NUM_CALDWELL) && NUM_CALDWELL == 109
+  { Cat_Caldwell, CAT_DSO_COMP, Cat_Caldwell_Names, NameIdx_Caldwell_109_caldwell_c, NULL, 46 },
+#endif
+#if defined(NUM_COLLINDER) && NUM_COLLINDER == 471
+  { Cat_Collinder, CAT_NONE, Cat_Collinder_Names, NameIdx_Collinder_471, NULL, 471 },
+#endif
+#if defined(NUM_MESSIER) && NUM_MESSIER == 109
+  { Cat_Messier, CAT_NONE, Cat_Messier_Names, NameIdx_Messier_109, NULL, 37 },
+#endif
+#if defined(NUM_STARS) && NUM_STARS == 408
+  { Cat_Stars, CAT_NONE, Cat_Stars_Names, NameIdx_Stars_408, NULL, 188 },
+#endif
+  { NULL, CAT_NONE, NameIdx_Treasure_Names, NameIdx_Treasure, NameIdx_Treasure_Coords, 223 },
+  { NULL, CAT_NONE, NULL, NULL, NULL, 0 }
+};
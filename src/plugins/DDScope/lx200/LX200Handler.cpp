@@ -7,6 +7,15 @@
 // and the OnStep command channels. Not tested on any other
 // planetarium programs.
 //
+// Commands are read as they arrive, a whole burst of polls in one tick, and
+// each one is answered with a '#' terminated reply (a lone '#' for commands
+// that have none) in the order received. The replies go into the serial TX
+// buffer and are sent by interrupt, nothing waits on a flush. An 'L' between
+// commands is the C3's old per-command handshake and still gets its 'K', but
+// a command no longer needs one. A command longer than LX200_CMD_MAX is
+// answered with "0#" and skipped up to its '#'. After :Ss[n]# status records
+// are pushed between replies, see StatusStream.h.
+//
 // **** by Richard Benear 5/21/2025 ****
 //
 // See rights and use declaration in License.h
@@ -14,6 +23,8 @@
 #include "LX200Handler.h"
 #include "../display/Display.h"
 #include "src/lib/serial/Serial_Local.h"
+#include "src/lib/commands/CmdLatency.h"
+#include "src/telescope/Telescope.h"
 
 void lxWrapper() { lx200Handler.lxPoll(); }
 
@@ -27,10 +38,15 @@ void lxWrapper() { lx200Handler.lxPoll(); }
 //#define SERIAL_ESP32  SERIAL_B
 //#define SERIAL_ESP_BAUD SERIAL_B_BAUD_DEFAULT
 
+static uint8_t rxMemory[LX200_RX_BUFFER];
+static uint8_t txMemory[LX200_TX_BUFFER];
+
 void LX200Handler::init() {
   pinMode(34, INPUT_PULLUP);  // Serial8 RX pin
    
   SERIAL_ESP32.begin(SERIAL_ESP_BAUD);
+  SERIAL_ESP32.addMemoryForRead(rxMemory, sizeof(rxMemory));
+  SERIAL_ESP32.addMemoryForWrite(txMemory, sizeof(txMemory));
   SERIAL_DEBUG.println("MSG: LX200, Starting ESP32C3 Serial");
   delay(10);
   
@@ -38,8 +54,8 @@ void LX200Handler::init() {
   while (SERIAL_ESP32.available()) SERIAL_ESP32.read(); 
 
   // start LX200 poll task
-  VF("MSG: Setup, start LX200 polling task (rate 10 ms priority 2)... ");
-  uint8_t lx_handle = tasks.add(20, 0, true, 3, lxWrapper, "LX200 task");
+  VF("MSG: Setup, start LX200 polling task (rate " STR(LX200_POLL_MS) " ms priority 3)... ");
+  uint8_t lx_handle = tasks.add(LX200_POLL_MS, 0, true, 3, lxWrapper, "LX200 task");
   if (lx_handle) {
     VLF("success");
   } else {
@@ -49,62 +65,96 @@ void LX200Handler::init() {
 
 // =====================================================
 void LX200Handler::lxPoll() {
+  int commands = 0;
 
-  if (SERIAL_ESP32.available()) {
-    char peekChar = SERIAL_ESP32.peek();
-
-    //SERIAL_DEBUG.print("0x"); SERIAL_DEBUG.println(peekChar, HEX);
-    if (peekChar == 'L') {
-      //unsigned long tStart = micros();  // Start timing
-      SERIAL_ESP32.read();
-      SERIAL_ESP32.write('K'); // ACK
-      SERIAL_ESP32.flush();
-
-      String lxCmd = "";
-
-      // Read command from Teensy until '#' or timeout
-      unsigned long start = micros();
-      const unsigned long timeoutMicros = 10000;
-      while ((micros() - start) < timeoutMicros) {
-        if (SERIAL_ESP32.available()) {
-          char c = SERIAL_ESP32.read();
-          lxCmd += c;
-          if (c == '#') break;
-        }
-      }
-
-      //SERIAL_DEBUG.print("LX200 Cmd = "); SERIAL_DEBUG.println(lxCmd);
-
-      if (lxCmd.length() == 0 || lxCmd.charAt(0) != ':' || lxCmd.charAt(lxCmd.length() - 1) != '#') {
-        SERIAL_DEBUG.printf("MSG: LX200, Timeout or missing '#' terminator. Received so far: \"%s\"\n", lxCmd.c_str());
-        return;
-      }
-
-      const char* cmd = lxCmd.c_str();
-      char lxResp[32] = "";
-      if (!cmdDirect.processCommand(cmd, lxResp)) {
-        SERIAL_DEBUG.printf("Error processing Command: %s\n", lxCmd.c_str());
-      }
-  
-      // Make sure '#' is appended
-      size_t len = strlen(lxResp);
-      if (len == 0 || lxResp[len - 1] != '#') {
-        if (len < sizeof(lxResp) - 1) {
-          lxResp[len] = '#';
-          lxResp[len + 1] = '\0';
-        }
-      }
-
-      // Send response back over serial
-      SERIAL_ESP32.print(lxResp);
-      SERIAL_ESP32.flush();
-
-      //SERIAL_DEBUG.printf("MSG: LX200, Cmd: %-14s  Resp: %s\n", lxCmd.c_str(), lxResp);
-
-      //unsigned long tEnd = micros();  // End timing
-      ///SERIAL_DEBUG.printf("MSG: LX200, lxPoll() duration: %lu µs\n", tEnd - tStart);
+  #if DEBUG_COMMAND_LATENCY == ON
+    if (!SERIAL_ESP32.available() && !_inCmd) commandLatency.idle('E');
+  #endif
+
+  // stop once a reply might not fit in the TX buffer, the rest waits in RX for the next tick
+  while (commands < LX200_CMDS_PER_POLL && SERIAL_ESP32.available() && SERIAL_ESP32.availableForWrite() >= LX200_REPLY_MAX) {
+    char c = SERIAL_ESP32.read();
+
+    // the rest of a command that was too long, up to its '#'
+    if (_discard) {
+      if (c == '#') _discard = false;
+      continue;
+    }
+
+    if (!_inCmd) {
+      if (c == ':') { _inCmd = true; _cmd[0] = c; _len = 1; } else
+      if (c == 'L') SERIAL_ESP32.write('K'); // ACK
+      continue;
+    }
+
+    // a command too long is still answered, so the replies that follow stay with their commands
+    if (_len >= LX200_CMD_MAX) {
+      _cmd[_len] = 0;
+      VF("MSG: LX200, command too long, dropped "); VL(_cmd);
+      SERIAL_ESP32.write("0#", 2);
+      _inCmd = false;
+      _discard = c != '#';
+      commands++;
+      continue;
+    }
+
+    _cmd[_len++] = c;
+    if (c == '#') {
+      _cmd[_len] = 0;
+      _inCmd = false;
+      process();
+      commands++;
     }
   }
+
+  if (_statusStream.active() && SERIAL_ESP32.availableForWrite() >= STATUS_STREAM_RECORD_MAX) {
+    char record[STATUS_STREAM_RECORD_MAX];
+    if (_statusStream.poll(record, [](char *r, char *c, char *p, bool *s, bool *n) {
+      CommandError e = CE_NONE;
+      if (!telescope.command(r, c, p, s, n, &e) && e == CE_NONE) e = CE_CMD_UNKNOWN;
+      return e;
+    })) SERIAL_ESP32.write(record, strlen(record));
+  }
+}
+
+// run the command in _cmd and queue its reply
+void LX200Handler::process() {
+  #if DEBUG_COMMAND_LATENCY == ON
+    unsigned long waitUs = commandLatency.waitTime('E');
+    unsigned long executeStart = micros();
+  #endif
+
+  char lxResp[LX200_REPLY_MAX] = "";
+  if (isStatusStream(&_cmd[1])) {
+    _cmd[_len - 1] = 0;
+    strcpy(lxResp, _statusStream.subscribe(&_cmd[3]) ? "1" : "0");
+    _cmd[_len - 1] = '#';
+  } else
+  if (!cmdDirect.processCommand(_cmd, lxResp)) {
+    SERIAL_DEBUG.printf("Error processing Command: %s\n", _cmd);
+  }
+
+  #if DEBUG_COMMAND_LATENCY == ON
+    unsigned long executeUs = micros() - executeStart;
+    unsigned long writeStart = micros();
+  #endif
+
+  // Make sure '#' is appended
+  size_t len = strlen(lxResp);
+  if (len == 0 || lxResp[len - 1] != '#') {
+    if (len < sizeof(lxResp) - 1) {
+      lxResp[len++] = '#';
+      lxResp[len] = '\0';
+    }
+  }
+
+  SERIAL_ESP32.write(lxResp, len);
+
+  #if DEBUG_COMMAND_LATENCY == ON
+    commandLatency.record('E', _cmd[1], waitUs, executeUs, micros() - writeStart);
+  #endif
+
+  //SERIAL_DEBUG.printf("MSG: LX200, Cmd: %-14s  Resp: %s\n", _cmd, lxResp);
 }
 
-LX200Handler lx200Handler;
\ No newline at end of file
+LX200Handler lx200Handler;
@@ -1,12 +1,21 @@
 //==================================================
-// WifiDisplay.h
+// LX200Handler.h
 //
 #include <Arduino.h>
+#include "src/lib/commands/BatchCmds.h"
+#include "src/lib/commands/StatusStream.h"
 #ifndef _LX200_HANDLER
 #define _LX200_HANDLER
 
 #define SERIAL_ESP32C3 Serial8
 
+#define LX200_POLL_MS       1    // task period
+#define LX200_CMD_MAX       95   // longest command, ':' through '#', a :GB# batch included
+#define LX200_REPLY_MAX     COMMAND_BATCH_REPLY_MAX // longest reply, with its '#'
+#define LX200_RX_BUFFER     512  // added to the serial port's RX buffer, a burst of polls between ticks
+#define LX200_TX_BUFFER     1024 // added to the serial port's TX buffer, replies go out by interrupt
+#define LX200_CMDS_PER_POLL 8    // most commands handled in one tick
+
 //======================================================================
 class LX200Handler  {
   public:
@@ -14,11 +23,18 @@ class LX200Handler  {
     void lxPoll();
     //void take_esp_lock();
     //void give_esp_lock();
-   
+
     //volatile bool espIsLocked = false;  // Simple lock for thread safety
 
   private:
-  
+    void process();
+
+    char    _cmd[LX200_CMD_MAX + 1];
+    uint8_t _len = 0;
+    bool    _inCmd = false;
+    bool    _discard = false;  // skipping to the '#' of a command that was too long
+
+    StatusStream _statusStream;
 };
 
 extern LX200Handler lx200Handler;
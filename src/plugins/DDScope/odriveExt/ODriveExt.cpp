@@ -12,13 +12,7 @@
 #include "src/lib/axis/motor/oDrive/ODrive.h"
 #include "../../../telescope/mount/Mount.h"
 #include "../../../lib/tasks/OnTask.h"
-
-const char* ODriveComponentsStr[4] = {
-            "None",   
-            "Controller",
-            "Motor",
-            "Encoder"        
-};
+#include "ODriveUart.h"
 
 // Printing with stream operator helper functions
 template<class T> inline Print& operator <<(Print& obj,     T arg) { obj.print(arg   ); return obj; }
@@ -65,8 +59,8 @@ void ODriveExt::setODrivePosGain(int axis, float level) {
   #endif
 }
 
-// NOTE: Since the ODriveArduino library has up to 1000ms timeout waiting for a RX character,
-// a tasks.yield() is added after every read command.
+// NOTE: over UART the reads go through odriveUart, they ask for a fresh value and return the
+// latest reply right away rather than waiting up to 1000ms in the ODriveArduino library's readers.
 // NOTE: if the RX data from ODrive drops out or the ODrive is off during debug, then just return
 // from any of the follow "read" routines with -9.
 
@@ -74,8 +68,7 @@ void ODriveExt::setODrivePosGain(int axis, float level) {
 // Battery Low LED is only on when battery is below low threashold
 float ODriveExt::getODriveBusVoltage(int axis) {
   #if ODRIVE_COMM_MODE == OD_UART
-    ODRIVE_SERIAL << "r vbus_voltage\n";
-    float battery_voltage = _oDriveDriver->readFloat();
+    float battery_voltage = odriveUart.get(axis, OUV_VBUS);
   #elif ODRIVE_COMM_MODE == OD_CAN
     float battery_voltage = _oDriveDriver->GetVbusVoltage(axis);  //Can be sent to either axis
   #endif
@@ -106,8 +99,7 @@ float ODriveExt::getODriveBusVoltage(int axis) {
 float ODriveExt::getEncoderPositionDeg(int axis) {
   if (oDriveRXoff) return -9.9; // arbitrary number
   #if ODRIVE_COMM_MODE == OD_UART
-    ODRIVE_SERIAL << "r axis" << axis << ".encoder.pos_estimate\n"; Y;
-    float turns = _oDriveDriver->readFloat();
+    float turns = odriveUart.get(axis, OUV_POS_ESTIMATE);
   #elif ODRIVE_COMM_MODE == OD_CAN
     float turns = _oDriveDriver->GetPosition(axis);
   #endif
@@ -118,8 +110,7 @@ float ODriveExt::getEncoderPositionDeg(int axis) {
 float ODriveExt::getMotorPositionTurns(int axis) {
   if (oDriveRXoff) return -9.9;
   #if ODRIVE_COMM_MODE == OD_UART
-    ODRIVE_SERIAL << "r axis" << axis << ".encoder.pos_estimate\n"; Y;
-    float turns = _oDriveDriver->readFloat();
+    float turns = odriveUart.get(axis, OUV_POS_ESTIMATE);
   #elif ODRIVE_COMM_MODE == OD_CAN
     float turns = _oDriveDriver->GetPosition(axis);
   #endif
@@ -130,8 +121,7 @@ float ODriveExt::getMotorPositionTurns(int axis) {
 int ODriveExt::getMotorPositionCounts(int axis) {
   if (oDriveRXoff) return -9.9;
   #if ODRIVE_COMM_MODE == OD_UART
-    ODRIVE_SERIAL << "r axis" << axis << ".encoder.pos_estimate_counts\n"; Y;
-    int counts = _oDriveDriver->readInt();
+    int counts = (int)odriveUart.get(axis, OUV_POS_COUNTS);
   #elif ODRIVE_COMM_MODE == OD_CAN
     int counts = (int)_oDriveDriver->GetEncoderCountInCPR(axis);
   #endif
@@ -142,8 +132,7 @@ int ODriveExt::getMotorPositionCounts(int axis) {
 float ODriveExt::getMotorCurrent(int axis) {
   if (oDriveRXoff) return -9.9;
   #if ODRIVE_COMM_MODE == OD_UART
-    ODRIVE_SERIAL << "r axis" << axis << ".motor.I_bus\n"; Y;
-    float Iq = _oDriveDriver->readFloat();
+    float Iq = odriveUart.get(axis, OUV_I_BUS);
   #elif ODRIVE_COMM_MODE == OD_CAN
     float Iq = _oDriveDriver->GetIqMeasured(axis);
   #endif
@@ -153,81 +142,18 @@ float ODriveExt::getMotorCurrent(int axis) {
 // read current state
 uint8_t ODriveExt::getODriveCurrentState(int axis) {
   #if ODRIVE_COMM_MODE == OD_UART
-  ODRIVE_SERIAL << "r axis" << axis << ".current_state\n";
-    uint8_t cState = _oDriveDriver->readInt();
+    uint8_t cState = (uint8_t)odriveUart.get(axis, OUV_STATE);
   #elif ODRIVE_COMM_MODE == OD_CAN
     uint8_t cState = _oDriveDriver->GetCurrentState(axis);
   #endif
   return cState;
 }
 
-// Get the difference between ODrive setpoint and the encoder
-float ODriveExt::getMotorPositionDelta(int axis) {
-  
-  #if ODRIVE_COMM_MODE == OD_UART
-    ODRIVE_SERIAL << "r axis" << axis << ".controller.pos_setpoint\n";
-    float reqPos = _oDriveDriver->readFloat();   
-    ODRIVE_SERIAL << "r axis" << axis << ".encoder.pos_estimate\n";
-    float posEst = _oDriveDriver->readFloat(); 
-    float deltaPos = fabs(reqPos - posEst);
-  #elif ODRIVE_COMM_MODE == OD_CAN
-    double currentTarget = 0.0000;
-    float target = 0.0000;
-    float actual = 0.0000;
-    float deltaPos = 0.0000;
-    if (ODRIVE_SWAP_AXES == ON) {
-      if (axis == ALT_MOTOR) currentTarget = axis2.getTargetCoordinate();
-      if (axis == AZM_MOTOR) currentTarget = axis1.getTargetCoordinate();
-    } else {
-      if (axis == ALT_MOTOR) currentTarget = axis1.getTargetCoordinate();
-      if (axis == AZM_MOTOR) currentTarget = axis2.getTargetCoordinate();
-    }
-    // the following variables are in fractional "turns"
-    target = ((float)currentTarget*RAD_DEG_RATIO)/360;
-    //int32_t enc_actual = _oDriveDriver->GetEncoderShadowCount(axis); // 2^14 = 16384 counts per revolution
-    //actual = (float)enc_actual/16384;
-    actual = _oDriveDriver->GetPosition(axis);
-    deltaPos = (target - actual); 
-    //char deltaPosS[9]="";
-    //char actualS[9]="";
-    //char targetS[9]="";
-    //if (axis == 1) {
-    //  sprintf(actualS, "%0.5f", actual);
-    //  sprintf(targetS, "%0.5f", target);
-    //  sprintf(deltaPosS, "%0.5f", deltaPos);
-    //  VF("act="); VL(actualS);
-    //  VF("targ="); VL(targetS);
-    //  VF("delta="); VL(deltaPosS);
-    //} 
-  #endif  
-  return fabs(deltaPos);
-}
-
-// Check encoders to see if positions are too far outside range of requested position inferring that there are interfering forces
-// This will warn that the motors may be getting too hot since more current is required trying to move them to the requested position
-void ODriveExt::MotorEncoderDelta() {
-  if (oDriveRXoff) return;
-  if (axis1.isEnabled()) {
-    float AZposDelta = getMotorPositionDelta(AZM_MOTOR);
-    if (AZposDelta > 0.0020 && AZposDelta < 0.03) 
-      display.soundFreq(1700, 65);
-    else if (AZposDelta > 0.03) display.soundFreq(1800, 65); // saturated
-  }
-  
-  if (axis2.isEnabled()) {
-    float ALTposDelta = getMotorPositionDelta(ALT_MOTOR);
-    if (ALTposDelta > .0050 && ALTposDelta < 0.03) {
-      display.soundFreq(1500, 35);
-    } else if (ALTposDelta > 0.03) display.soundFreq(1600, 35); 
-  }
-}
-
 // Get ODrive gains
 float ODriveExt::getODriveVelGain(int axis) {
   if (oDriveRXoff) return -9.9;
   #if ODRIVE_COMM_MODE == OD_UART
-    ODRIVE_SERIAL << "r axis"<<axis<<".controller.config.vel_gain\n"; Y;
-    return _oDriveDriver->readFloat();
+    return odriveUart.get(axis, OUV_VEL_GAIN);
   #elif ODRIVE_COMM_MODE == OD_CAN
     // not a commmand that is implemented with "CAN Simple" on ODrive so just return built-in constants
     if (axis == 1) { // 1=AZM motor, 0=ALT Motor
@@ -241,8 +167,7 @@ float ODriveExt::getODriveVelGain(int axis) {
 float ODriveExt::getODriveVelIntGain(int axis) {
   if (oDriveRXoff) return -9.9;
   #if ODRIVE_COMM_MODE == OD_UART
-    ODRIVE_SERIAL << "r axis"<<axis<<".controller.config.vel_integrator_gain\n"; Y;
-    return _oDriveDriver->readFloat();
+    return odriveUart.get(axis, OUV_VEL_INT_GAIN);
   #elif ODRIVE_COMM_MODE == OD_CAN
     // not a commmand that is implemented with "CAN Simple" on ODrive so just return built-in constants
     if (axis == 1) { //1=AZM Motor, 0=ALT Motor
@@ -256,8 +181,7 @@ float ODriveExt::getODriveVelIntGain(int axis) {
 float ODriveExt::getODrivePosGain(int axis) {
   if (oDriveRXoff) return -9.9;
   #if ODRIVE_COMM_MODE == OD_UART
-    ODRIVE_SERIAL << "r axis"<<axis<<".controller.config.pos_gain\n"; Y;
-    return _oDriveDriver->readFloat();
+    return odriveUart.get(axis, OUV_POS_GAIN);
   #elif ODRIVE_COMM_MODE == OD_CAN
     return 99; // not implemented
   #endif
@@ -271,20 +195,23 @@ uint32_t ODriveExt::getODriveErrors(int axis, Component component) {
   // ODrive Top Level Error
   if (axis == -1) {
     #if ODRIVE_COMM_MODE == OD_UART
-      ODRIVE_SERIAL << "r odrive.error\n"; Y;
-      return axisErr = (uint32_t)_oDriveDriver->readInt();
+      return axisErr = (uint32_t)odriveUart.get(0, OUV_TOP_ERROR);
     #elif ODRIVE_COMM_MODE == OD_CAN
       return axisErr = 88; // No implementation for this in CAN bus
     #endif
   } else {
     // ODrive Errors (Axis, Controller, Motor, or Encoder)
     #if ODRIVE_COMM_MODE == OD_UART
-      if (component == NO_COMP) { // axis error
-        ODRIVE_SERIAL << "r odrive.axis"<<axis<<".error\n"; Y;
-        return axisErr = (uint32_t)_oDriveDriver->readInt();
-      } else { // component of the Axis error
-        ODRIVE_SERIAL << "r odrive.axis"<<axis<<"."<<ODriveComponentsStr[component]<<".error\n"; Y;
-        return axisErr = (uint32_t)_oDriveDriver->readInt();
+      if (component == NO_COMP || component == AXIS) {
+        return axisErr = (uint32_t)odriveUart.get(axis, OUV_AXIS_ERROR);
+      } else if (component == MOTOR) {
+        return axisErr = (uint32_t)odriveUart.get(axis, OUV_MOTOR_ERROR);
+      } else if (component == ENCODER) {
+        return axisErr = (uint32_t)odriveUart.get(axis, OUV_ENCODER_ERROR);
+      } else if (component == CONTROLLER) {
+        return axisErr = (uint32_t)odriveUart.get(axis, OUV_CONTROLLER_ERROR);
+      } else {
+        return axisErr = 99;
       }
     #elif ODRIVE_COMM_MODE == OD_CAN
       if (component == AXIS) {
@@ -302,6 +229,62 @@ uint32_t ODriveExt::getODriveErrors(int axis, Component component) {
   }
 }
 
+// ========  Get all the ODRIVE errors at once ========
+// over CAN the words come from the latest-value store, the heartbeat and the subscribed error replies
+// over UART the nine requests don't fit the ODrive's RX buffer together, so a get refreshes only a few
+// words at a time; fetch waits until all of them are answered (for when the screen is drawn) and
+// words that never had a reply are marked unread either way
+ODriveErrorSnapshot ODriveExt::getODriveErrorSnapshot(bool fetch) {
+  ODriveErrorSnapshot snapshot;
+  snapshot.unread = 0;
+
+  const int motors[2] = {AZM_MOTOR, ALT_MOTOR};
+  const Component components[4] = {AXIS, CONTROLLER, MOTOR, ENCODER};
+
+  #if ODRIVE_COMM_MODE == OD_UART
+    const int axes[OD_ERR_WORDS] = {0, motors[0], motors[0], motors[0], motors[0], motors[1], motors[1], motors[1], motors[1]};
+    const ODriveUartValue values[OD_ERR_WORDS] = {OUV_TOP_ERROR,
+      OUV_AXIS_ERROR, OUV_CONTROLLER_ERROR, OUV_MOTOR_ERROR, OUV_ENCODER_ERROR,
+      OUV_AXIS_ERROR, OUV_CONTROLLER_ERROR, OUV_MOTOR_ERROR, OUV_ENCODER_ERROR};
+
+    if (fetch && !oDriveRXoff) {
+      unsigned long start = millis();
+      while ((long)(millis() - start) < ODRIVE_UART_FETCH_MS) {
+        bool waiting = false;
+        for (int w = 0; w < OD_ERR_WORDS; w++) {
+          unsigned long time;
+          odriveUart.latest(axes[w], values[w], &time);
+          if (time == 0 || (long)(time - start) < 0) { odriveUart.request(axes[w], values[w]); waiting = true; }
+        }
+        if (!waiting) break;
+        odriveUart.poll();
+      }
+    }
+  #endif
+
+  snapshot.time = millis();
+  #if ODRIVE_COMM_MODE == OD_CAN
+    snapshot.word[0] = 0; // no top level error in CAN Simple
+  #else
+    snapshot.word[0] = getODriveErrors(-1, Component::NO_COMP);
+  #endif
+
+  for (int m = 0; m < 2; m++) {
+    for (int c = 0; c < 4; c++) snapshot.word[1 + m*4 + c] = getODriveErrors(motors[m], components[c]);
+  }
+
+  #if ODRIVE_COMM_MODE == OD_UART
+    if (!oDriveRXoff) {
+      for (int w = 0; w < OD_ERR_WORDS; w++) {
+        unsigned long time;
+        odriveUart.latest(axes[w], values[w], &time);
+        if (time == 0) snapshot.unread |= 1 << w;
+      }
+    }
+  #endif
+  return snapshot;
+}
+
 // =========== Motor Thermistor Support =============
 float ODriveExt::getMotorTemp(int axis) {
   int Ro = 9, B =  3950; //Nominal resistance 10K, Beta constant, 9k at 68 deg
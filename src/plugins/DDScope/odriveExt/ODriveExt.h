@@ -32,6 +32,16 @@ enum Component
   COMP_LAST
 };
 
+// every ODrive error word, read together: top level, then for AZM and ALT the axis,
+// controller, motor and encoder errors
+#define OD_ERR_WORDS 9
+
+typedef struct ODriveErrorSnapshot {
+  unsigned long time;             // millis() when taken
+  uint32_t word[OD_ERR_WORDS];
+  uint16_t unread;                // bit per word that has had no reply yet, its 0 isn't "no errors"
+} ODriveErrorSnapshot;
+
 class ODriveExt {
   public:
     
@@ -41,7 +51,6 @@ class ODriveExt {
 
     float getEncoderPositionDeg(int axis);
     float getMotorPositionTurns(int axis);
-    float getMotorPositionDelta(int axis);
     float getMotorCurrent(int axis);
     float getMotorTemp(int axis);
     float getODriveVelGain(int axis);
@@ -50,13 +59,13 @@ class ODriveExt {
     float getODriveBusVoltage(int axis);
 
     uint32_t getODriveErrors(int axis, Component component);
+    ODriveErrorSnapshot getODriveErrorSnapshot(bool fetch = false);
     void demoMode();
     
     // other actions
     void setODriveVelGains(int axis, float level, float intLevel);
     void setODrivePosGain(int axis, float level);
     //void updateODriveMotorPositions();
-    void MotorEncoderDelta();
     //void clearODriveErrors(int axis, int comp);
     //void setHigherBaud();
     void clearAllODriveErrors();
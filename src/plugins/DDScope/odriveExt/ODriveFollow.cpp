@@ -0,0 +1,200 @@
+// =====================================================
+// ODriveFollow.cpp
+//
+// Estimates are read from the CAN driver's latest-value store (or the UART client's latest
+// replies), nothing is requested over CAN and the receive interrupt isn't involved.
+
+#include "ODriveFollow.h"
+
+#ifdef ODRIVE_MOTOR_PRESENT
+
+#include "../display/Display.h"
+#include "src/lib/axis/motor/oDrive/ODrive.h"
+#include "ODriveUart.h"
+#include "../../../telescope/mount/Mount.h"
+#include "src/lib/tasks/OnTask.h"
+
+#define ARCSEC_PER_TURN 1296000.0F
+
+void odriveFollowWrapper() { oDriveFollow.poll(); }
+
+void ODriveFollow::init() {
+  reset(AZM_MOTOR);
+  reset(ALT_MOTOR);
+  VF("MSG: ODriveFollow, start following error monitor task (rate " STR(ODRIVE_FOLLOW_MS) " ms priority 6)... ");
+  if (tasks.add(ODRIVE_FOLLOW_MS, 0, true, 6, odriveFollowWrapper, "ODrvFol")) { VLF("success"); } else { VLF("FAILED!"); }
+}
+
+ODriveFollowWarning ODriveFollow::warning(int *axis) {
+  int worst = _stats[ALT_MOTOR].warning > _stats[AZM_MOTOR].warning ? ALT_MOTOR : AZM_MOTOR;
+  if (axis != NULL) *axis = worst;
+  return _stats[worst].warning;
+}
+
+const char *ODriveFollow::warningName(ODriveFollowWarning warning) {
+  switch (warning) {
+    case OFW_OVERLOAD: return "LOAD";
+    case OFW_STALL:    return "STALL";
+    case OFW_RUNAWAY:  return "RUN";
+    default:           return "";
+  }
+}
+
+void ODriveFollow::report(char *reply, int axis) {
+  ODriveFollowStats *s = &_stats[axis & 1];
+  sprintf(reply, "%.1f,%.1f,%.1f,%.1f,%.1f,%u,%u", s->error, s->rmsShort, s->peakShort, s->rmsLong, s->peakLong,
+          s->warning, s->raised);
+}
+
+void ODriveFollow::poll() {
+  for (int axis = 0; axis < 2; axis++) {
+    // the OnStep axis driving this motor
+    bool enabled;
+    if (ODRIVE_SWAP_AXES == ON) {
+      enabled = axis == AZM_MOTOR ? axis1.isEnabled() : axis2.isEnabled();
+    } else {
+      enabled = axis == AZM_MOTOR ? axis2.isEnabled() : axis1.isEnabled();
+    }
+    #if ODRIVE_COMM_MODE == OD_CAN
+      // the tuner steps the setpoint on purpose
+      if (odriveHeld & (1 << axis)) enabled = false;
+    #endif
+    if (!enabled) {
+      if (_enabled[axis]) reset(axis);
+      continue;
+    }
+    _enabled[axis] = true;
+
+    float setpoint, position, velocity;
+    if (sample(axis, &setpoint, &position, &velocity)) {
+      _stats[axis].error = (setpoint - position)*ARCSEC_PER_TURN;
+      _velocity[axis] = velocity;
+      add(axis, _stats[axis].error);
+    }
+
+    if (millis() - _bucketStart[axis] >= ODRIVE_FOLLOW_BUCKET_MS) {
+      close(axis);
+      judge(axis, _velocity[axis]);
+    }
+  }
+}
+
+// support functions
+
+// the latest estimate and the setpoint it's compared with, false if there's no new estimate
+bool ODriveFollow::sample(int axis, float *setpoint, float *position, float *velocity) {
+  #if ODRIVE_COMM_MODE == OD_CAN
+    uint16_t count = _oDriveDriver->replyCount(axis, ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES);
+    if (count == _count[axis]) return false;
+    _count[axis] = count;
+
+    byte data[8];
+    if (!_oDriveDriver->latest(axis, ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, data)) return false;
+    memcpy(position, &data[0], sizeof(float));
+    memcpy(velocity, &data[4], sizeof(float));
+    *setpoint = _oDriveDriver->GetInputPosition(axis);
+  #elif ODRIVE_COMM_MODE == OD_UART
+    odriveUart.request(axis, OUV_POS_ESTIMATE);
+    odriveUart.request(axis, OUV_POS_SETPOINT);
+    unsigned long time;
+    *position = odriveUart.latest(axis, OUV_POS_ESTIMATE, &time);
+    if (time == 0 || time == _time[axis]) return false;
+    _time[axis] = time;
+    *velocity = odriveUart.latest(axis, OUV_VEL_ESTIMATE);
+    *setpoint = odriveUart.latest(axis, OUV_POS_SETPOINT);
+  #endif
+  return true;
+}
+
+void ODriveFollow::add(int axis, float error) {
+  ODriveFollowBucket *b = &_open[axis];
+  b->sumSquares += error*error;
+  if (fabs(error) > b->peak) b->peak = fabs(error);
+  b->count++;
+}
+
+// stores the open bucket and works out both windows
+void ODriveFollow::close(int axis) {
+  _buckets[axis][_bucket[axis]] = _open[axis];
+  _bucket[axis] = (_bucket[axis] + 1) % ODRIVE_FOLLOW_BUCKETS;
+  if (_filled[axis] < ODRIVE_FOLLOW_BUCKETS) _filled[axis]++;
+  memset(&_open[axis], 0, sizeof(ODriveFollowBucket));
+  _bucketStart[axis] = millis();
+
+  float sumShort = 0, peakShort = 0, sumLong = 0, peakLong = 0;
+  uint32_t countShort = 0, countLong = 0;
+  for (int i = 0; i < _filled[axis]; i++) {
+    ODriveFollowBucket *b = &_buckets[axis][(_bucket[axis] + ODRIVE_FOLLOW_BUCKETS - 1 - i) % ODRIVE_FOLLOW_BUCKETS];
+    if (i < ODRIVE_FOLLOW_SHORT) {
+      sumShort += b->sumSquares;
+      countShort += b->count;
+      if (b->peak > peakShort) peakShort = b->peak;
+    }
+    sumLong += b->sumSquares;
+    countLong += b->count;
+    if (b->peak > peakLong) peakLong = b->peak;
+  }
+
+  ODriveFollowStats *s = &_stats[axis];
+  s->rmsShort = countShort ? sqrtf(sumShort/countShort) : 0;
+  s->peakShort = peakShort;
+  s->rmsLong = countLong ? sqrtf(sumLong/countLong) : 0;
+  s->peakLong = peakLong;
+}
+
+// raises or clears a warning once its condition has held for ODRIVE_FOLLOW_HOLD_MS
+void ODriveFollow::judge(int axis, float velocity) {
+  ODriveFollowStats *s = &_stats[axis];
+  float overload = axis == AZM_MOTOR ? ODRIVE_FOLLOW_AZM_OVERLOAD : ODRIVE_FOLLOW_ALT_OVERLOAD;
+
+  // once raised a warning holds until below half its threshold
+  bool far = fabs(s->error) > ODRIVE_FOLLOW_STALL*(s->warning >= OFW_STALL ? 0.5F : 1.0F);
+  bool loaded = s->rmsShort > overload*(s->warning != OFW_NONE ? 0.5F : 1.0F);
+  bool moving = fabs(velocity) >= ODRIVE_FOLLOW_STALL_VEL;
+
+  // the error is setpoint - position, moving away means the velocity has the other sign
+  ODriveFollowWarning now = OFW_NONE;
+  if (far && moving && velocity*s->error < 0) now = OFW_RUNAWAY; else
+  if (far && !moving) now = OFW_STALL; else
+  if (loaded && !mount.isSlewing()) now = OFW_OVERLOAD;
+
+  if (now == s->warning || now != _pending[axis]) {
+    _pending[axis] = now;
+    _pendingSince[axis] = millis();
+    return;
+  }
+  if (millis() - _pendingSince[axis] < ODRIVE_FOLLOW_HOLD_MS) return;
+
+  if (now > s->warning) {
+    s->raised++;
+    VF("MSG: ODriveFollow, "); V(axis == AZM_MOTOR ? "AZM " : "ALT "); V(warningName(now));
+    VF(" warning, error "); V(s->error); VF("\" RMS "); V(s->rmsShort); VLF("\"");
+    if (axis == AZM_MOTOR) display.soundFreq(now == OFW_OVERLOAD ? 1700 : 1800, 65);
+    else display.soundFreq(now == OFW_OVERLOAD ? 1500 : 1600, 35);
+  } else {
+    VF("MSG: ODriveFollow, "); V(axis == AZM_MOTOR ? "AZM " : "ALT "); V(warningName(s->warning)); VF(" warning cleared");
+    if (now != OFW_NONE) { VF(", now "); VL(warningName(now)); } else { VLF(""); }
+  }
+  s->warning = now;
+}
+
+// a disabled motor starts again with empty windows and no warning
+void ODriveFollow::reset(int axis) {
+  memset(_buckets[axis], 0, sizeof(_buckets[axis]));
+  memset(&_open[axis], 0, sizeof(ODriveFollowBucket));
+  _bucket[axis] = 0;
+  _filled[axis] = 0;
+  _bucketStart[axis] = millis();
+  _enabled[axis] = false;
+
+  ODriveFollowStats *s = &_stats[axis];
+  uint16_t raised = s->raised;
+  memset(s, 0, sizeof(ODriveFollowStats));
+  s->raised = raised;
+  _pending[axis] = OFW_NONE;
+  _pendingSince[axis] = millis();
+}
+
+ODriveFollow oDriveFollow;
+
+#endif
@@ -0,0 +1,97 @@
+// =====================================================
+// ODriveFollow.h
+//
+// ODrive following error monitor
+// Each encoder estimate that arrives for an enabled motor (the cyclic CAN frames, or the "f n"
+// replies over UART) is compared with the position setpoint that ODrive axis was given. The
+// errors are kept in ODRIVE_FOLLOW_BUCKET_MS buckets, the RMS and peak over the last second
+// and over all the buckets are worked out as each bucket closes. A warning is raised when
+// its condition has held for ODRIVE_FOLLOW_HOLD_MS and cleared when it has been below half
+// the threshold that long:
+//   Overload  the RMS over the last second is above ODRIVE_FOLLOW_AZM/ALT_OVERLOAD, the motor is
+//             working against something (balance, cable drag, wind)
+//   Stall     the error is above ODRIVE_FOLLOW_STALL and the motor isn't moving
+//   Runaway   the error is above ODRIVE_FOLLOW_STALL and the motor is moving away from the setpoint
+// Errors are in arc-seconds, the motors are direct drive so one turn is 360 degrees.
+//
+// :GQFn#     following error for ODrive axis n (0 or 1)
+//            Returns: error,RMS 1s,peak 1s,RMS long,peak long,warning (0 none, 1 overload,
+//                     2 stall, 3 runaway),warnings raised#
+
+#pragma once
+
+#include <Arduino.h>
+#include "src/Common.h"
+
+#ifdef ODRIVE_MOTOR_PRESENT
+
+#define ODRIVE_FOLLOW_MS        10     // monitor task period, a new estimate is looked for this often
+#define ODRIVE_FOLLOW_BUCKET_MS 100    // errors are summed this long
+#define ODRIVE_FOLLOW_SHORT     10     // buckets in the short window, 1 s
+#define ODRIVE_FOLLOW_BUCKETS   100    // buckets in the long window, 10 s
+#define ODRIVE_FOLLOW_HOLD_MS   1000   // a warning's condition holds this long before it's raised or cleared
+#define ODRIVE_FOLLOW_STALL_VEL 0.001  // turns/s, slower than this is not moving
+
+enum ODriveFollowWarning: uint8_t {OFW_NONE, OFW_OVERLOAD, OFW_STALL, OFW_RUNAWAY};
+
+typedef struct ODriveFollowBucket {
+  float    sumSquares;
+  float    peak;
+  uint16_t count;
+} ODriveFollowBucket;
+
+typedef struct ODriveFollowStats {
+  float error;                  // latest, setpoint - estimate
+  float rmsShort;               // over the last second
+  float peakShort;
+  float rmsLong;                // over the last ODRIVE_FOLLOW_BUCKETS buckets
+  float peakLong;
+  ODriveFollowWarning warning;
+  uint16_t raised;              // warnings raised since boot
+} ODriveFollowStats;
+
+class ODriveFollow {
+  public:
+    // start the monitor task
+    void init();
+
+    inline ODriveFollowStats stats(int axis) { return _stats[axis & 1]; }
+
+    // the worst warning of the two axes, and in axis the one it's on
+    ODriveFollowWarning warning(int *axis = NULL);
+
+    // a short name for the status bar, "" if there's no warning
+    const char *warningName(ODriveFollowWarning warning);
+
+    // :GQFn# reply
+    void report(char *reply, int axis);
+
+    // the monitor task
+    void poll();
+
+  private:
+    bool sample(int axis, float *setpoint, float *position, float *velocity);
+    void add(int axis, float error);
+    void close(int axis);
+    void judge(int axis, float velocity);
+    void reset(int axis);
+
+    ODriveFollowStats _stats[2];
+    ODriveFollowBucket _buckets[2][ODRIVE_FOLLOW_BUCKETS];
+    ODriveFollowBucket _open[2];
+    uint8_t _bucket[2] = {0, 0};
+    uint8_t _filled[2] = {0, 0};
+    unsigned long _bucketStart[2] = {0, 0};
+
+    ODriveFollowWarning _pending[2] = {OFW_NONE, OFW_NONE};
+    unsigned long _pendingSince[2] = {0, 0};
+    float _velocity[2] = {0, 0};       // latest estimate, turns/s
+
+    uint16_t _count[2] = {0, 0};       // CAN frames seen
+    unsigned long _time[2] = {0, 0};   // UART replies seen
+    bool _enabled[2] = {false, false};
+};
+
+extern ODriveFollow oDriveFollow;
+
+#endif
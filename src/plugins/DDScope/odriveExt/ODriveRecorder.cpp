@@ -0,0 +1,147 @@
+// =====================================================
+// ODriveRecorder.cpp
+//
+// The receive interrupt only ever advances _head and poll() only ever advances _tail, so
+// neither needs a lock. A full ring drops the new record and counts it.
+
+#include "ODriveRecorder.h"
+
+#if defined(ODRIVE_MOTOR_PRESENT) && ODRIVE_COMM_MODE == OD_CAN
+
+#include "../display/Display.h"
+#include "src/lib/axis/motor/oDrive/ODrive.h"
+#include "src/lib/tasks/OnTask.h"
+#include "ODriveTuner.h"
+
+#if (ODRIVE_RECORD_RING & (ODRIVE_RECORD_RING - 1)) != 0 || ODRIVE_RECORD_RING > 32768
+  #error "ODRIVE_RECORD_RING must be a power of two no larger than 32768"
+#endif
+
+EXTMEM odrive_rec_t odriveRecRing[ODRIVE_RECORD_RING];
+
+static void odriveRecorderFrame(int axis_id, int cmd_id, const uint8_t *data) { oDriveRecorder.frame(axis_id, cmd_id, data); }
+
+void odriveRecorderWrapper() { oDriveRecorder.poll(); }
+
+void ODriveRecorder::init() {
+  for (int i = 0; i < ODRIVE_CAN_NODES; i++) _iq[i] = 0;
+  VF("MSG: ODriveRecorder, start write task (rate " STR(ODRIVE_RECORD_FLUSH_MS) " ms priority 7)... ");
+  if (tasks.add(ODRIVE_RECORD_FLUSH_MS, 0, true, 7, odriveRecorderWrapper, "ODrvRec")) { VLF("success"); } else { VLF("FAILED!"); }
+}
+
+bool ODriveRecorder::start() {
+  if (_enabled) return true;
+  if (oDriveTuner.busy()) { VLF("MSG: ODriveRecorder, not while tuning"); return false; }
+
+  for (int n = 0; n < 1000; n++) {
+    sprintf(_fileName, "odrec%03d.bin", n);
+    if (!SD.exists(_fileName)) break;
+    if (n == 999) { _fileName[0] = 0; VLF("MSG: ODriveRecorder, no free file name"); return false; }
+  }
+  _file = SD.open(_fileName, FILE_WRITE);
+  if (!_file) { VF("MSG: ODriveRecorder, can't create "); VL(_fileName); return false; }
+
+  odrive_rec_hdr_t header;
+  memcpy(header.Magic, ODRIVE_RECORD_MAGIC, 4);
+  header.Version = ODRIVE_RECORD_VERSION;
+  header.RecordSize = sizeof(odrive_rec_t);
+  header.StartMillis = millis();
+  header.AzmAxis = AZM_MOTOR;
+  header.AltAxis = ALT_MOTOR;
+  _file.write((const uint8_t*)&header, sizeof(header));
+
+  _tail = _head;
+  _dropped = 0;
+  _written = 0;
+  _lastSync = millis();
+
+  // encoder estimates as fast as the bus allows while recording, Iq a quarter as often
+  #if ODRIVE_RECORD_MS > 0
+    _oDriveDriver->subscribe(ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, ODRIVE_RECORD_MS);
+    _oDriveDriver->subscribe(ODriveTeensyCAN::CMD_ID_GET_IQ, ODRIVE_RECORD_MS*4);
+  #endif
+  _enabled = true;
+  _oDriveDriver->monitor(odriveRecorderFrame);
+
+  VF("MSG: ODriveRecorder, recording to "); VL(_fileName);
+  return true;
+}
+
+void ODriveRecorder::stop() {
+  if (!_enabled) return;
+  _oDriveDriver->monitor(NULL);
+  _enabled = false;
+  #if ODRIVE_RECORD_MS > 0
+    _oDriveDriver->subscribe(ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, ODRIVE_CAN_ENCODER_MS);
+    _oDriveDriver->subscribe(ODriveTeensyCAN::CMD_ID_GET_IQ, ODRIVE_CAN_IQ_MS);
+  #endif
+
+  poll();
+  _file.close();
+  VF("MSG: ODriveRecorder, stopped with "); V(_written); VF(" records, "); V(_dropped); VLF(" dropped");
+}
+
+void ODriveRecorder::status(char *reply) {
+  sprintf(reply, "%d,%lu,%lu,%s", _enabled ? 1 : 0, (unsigned long)_written, (unsigned long)_dropped, _fileName);
+}
+
+void ODriveRecorder::frame(int axis, int cmd, const uint8_t *data) {
+  if (!_enabled || axis < 0 || axis >= ODRIVE_CAN_NODES) return;
+
+  if (cmd == ODriveTeensyCAN::CMD_ID_GET_IQ) {
+    float iq;
+    memcpy(&iq, &data[4], sizeof(iq));
+    _iq[axis] = iq;
+    return;
+  }
+  if (cmd != ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES) return;
+
+  uint16_t head = _head;
+  if ((uint16_t)(head - _tail) >= ODRIVE_RECORD_RING) { _dropped++; return; }
+
+  odrive_rec_t *r = &odriveRecRing[head & (ODRIVE_RECORD_RING - 1)];
+  r->Micros = micros();
+  r->Axis = axis;
+  r->Setpoint = _oDriveDriver->GetInputPosition(axis);
+  memcpy(&r->Position, &data[0], sizeof(float));
+  memcpy(&r->Velocity, &data[4], sizeof(float));
+  r->Iq = _iq[axis];
+
+  // the record is complete before poll() can see it
+  __asm__ volatile("" ::: "memory");
+  _head = head + 1;
+}
+
+void ODriveRecorder::poll() {
+  if (!_file) return;
+
+  uint16_t head = _head;
+  __asm__ volatile("" ::: "memory");
+  uint16_t tail = _tail;
+
+  // in at most two pieces, up to the end of the ring and then from its start
+  while (tail != head) {
+    uint16_t index = tail & (ODRIVE_RECORD_RING - 1);
+    uint16_t count = (uint16_t)(head - tail);
+    if (count > ODRIVE_RECORD_RING - index) count = ODRIVE_RECORD_RING - index;
+    size_t bytes = count*sizeof(odrive_rec_t);
+    if (_file.write((const uint8_t*)&odriveRecRing[index], bytes) != bytes) {
+      VLF("MSG: ODriveRecorder, SD write failed");
+      _file.close();
+      stop();
+      return;
+    }
+    tail += count;
+    _tail = tail;
+    _written += count;
+  }
+
+  if ((long)(millis() - _lastSync) >= ODRIVE_RECORD_SYNC_MS) {
+    _lastSync = millis();
+    _file.flush();
+  }
+}
+
+ODriveRecorder oDriveRecorder;
+
+#endif
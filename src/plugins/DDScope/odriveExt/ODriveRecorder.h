@@ -0,0 +1,87 @@
+// =====================================================
+// ODriveRecorder.h
+//
+// ODrive telemetry recorder for tuning, ODRIVE_COMM_MODE == OD_CAN only
+// Each encoder estimates frame an ODrive sends is recorded by the CAN receive interrupt,
+// with the position last sent to that axis and its latest Iq, into a single producer single
+// consumer ring. A background task writes the ring to odrecNNN.bin on the SD card. The rate
+// is whatever the frames arrive at, ODRIVE_RECORD_MS while recording or faster if the ODrive
+// sends them cyclically (its can.encoder_rate_ms). tools/odriveRec2csv.py converts a recording.
+//
+// :SQR1#     start recording to the next free odrecNNN.bin, :SQR0# stops
+// :GQR#      recorder status, Returns: recording (0 or 1),records written,records dropped,file#
+
+#pragma once
+
+#include <Arduino.h>
+#include "src/Common.h"
+
+#if defined(ODRIVE_MOTOR_PRESENT) && ODRIVE_COMM_MODE == OD_CAN
+
+#include <SD.h>
+#include "../ODriveTeensyCAN/ODriveTeensyCAN.h"
+
+#define ODRIVE_RECORD_RING     8192   // records buffered, a power of two, 4 s of 1 kHz from both axes
+#define ODRIVE_RECORD_FLUSH_MS 50     // background write task period
+#define ODRIVE_RECORD_SYNC_MS  1000   // file size is updated on the card this often
+#define ODRIVE_RECORD_MAGIC    "ODRC"
+#define ODRIVE_RECORD_VERSION  1
+
+#pragma pack(push, 1)
+
+// Struct for the file header, followed by records to the end of the file
+typedef struct {
+  char           Magic[4];      // ODRIVE_RECORD_MAGIC
+  uint16_t       Version;       // ODRIVE_RECORD_VERSION
+  uint16_t       RecordSize;    // sizeof(odrive_rec_t)
+  uint32_t       StartMillis;   // millis() when recording started
+  uint8_t        AzmAxis;       // ODrive axis of the AZM motor
+  uint8_t        AltAxis;       // ODrive axis of the ALT motor
+} odrive_rec_hdr_t; // 14 bytes
+
+// Struct for one record, floats are in turns, turns/s and A
+typedef struct {
+  uint32_t       Micros;        // micros() when the frame arrived
+  uint8_t        Axis;          // ODrive axis
+  float          Setpoint;      // position last sent to this axis
+  float          Position;      // encoder estimate
+  float          Velocity;      // encoder estimate
+  float          Iq;            // latest Iq measured
+} odrive_rec_t; // 21 bytes
+
+#pragma pack(pop)
+
+class ODriveRecorder {
+  public:
+    // start the background write task, call after the SD card is started
+    void init();
+
+    // open the next odrecNNN.bin and start recording, false if the file can't be created
+    bool start();
+    void stop();
+    inline bool recording() { return _enabled; }
+
+    // :GQR# reply
+    void status(char *reply);
+
+    // called by the CAN receive interrupt for every frame
+    void frame(int axis, int cmd, const uint8_t *data);
+
+    // writes what the ring holds to the file
+    void poll();
+
+  private:
+    File              _file;
+    char              _fileName[13] = "";
+    volatile uint16_t _head = 0;      // written by the interrupt only
+    volatile uint16_t _tail = 0;      // written by poll() only
+    volatile bool     _enabled = false;
+    volatile float    _iq[ODRIVE_CAN_NODES];
+    volatile uint32_t _dropped = 0;
+    uint32_t          _written = 0;
+    unsigned long     _lastSync = 0;
+};
+
+extern ODriveRecorder oDriveRecorder;
+
+#endif
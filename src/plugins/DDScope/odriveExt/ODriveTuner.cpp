@@ -0,0 +1,274 @@
+// =====================================================
+// ODriveTuner.cpp
+//
+// Samples are stored by the CAN receive interrupt as each encoder estimate arrives, with
+// the Iq that came in just before it; the task asks for Iq first for that reason.
+
+#include "ODriveTuner.h"
+
+#if defined(ODRIVE_MOTOR_PRESENT) && ODRIVE_COMM_MODE == OD_CAN
+
+#include "../display/Display.h"
+#include "ODriveExt.h"
+#include "ODriveRecorder.h"
+#include "src/lib/axis/motor/oDrive/ODrive.h"
+#include "src/lib/tasks/OnTask.h"
+#include "ODriveEnums.h"
+
+EXTMEM ODriveTuneSample odriveTuneBuf[ODRIVE_TUNE_SAMPLES];
+
+static void odriveTunerFrame(int axis_id, int cmd_id, const uint8_t *data) { oDriveTuner.frame(axis_id, cmd_id, data); }
+
+void odriveTunerWrapper() { oDriveTuner.poll(); }
+
+void ODriveTuner::init() {
+  memset(_result, 0, sizeof(_result));
+  VF("MSG: ODriveTuner, start tuning task (rate " STR(ODRIVE_TUNE_SAMPLE_MS) " ms priority 3)... ");
+  if (tasks.add(ODRIVE_TUNE_SAMPLE_MS, 0, true, 3, odriveTunerWrapper, "ODrvTun")) { VLF("success"); } else { VLF("FAILED!"); }
+}
+
+bool ODriveTuner::start(int axis) {
+  if (busy() || axis < 0 || axis > 1) return false;
+  if (oDriveRecorder.recording()) { _phase = OTP_FAILED; _failure = "Stop the recorder"; return false; }
+
+  ODriveCanHealth health = _oDriveDriver->getHealth();
+  if (!health.node[axis].alive || health.node[axis].state != AXIS_STATE_CLOSED_LOOP_CONTROL) {
+    _phase = OTP_FAILED;
+    _failure = "Enable the motor";
+    return false;
+  }
+
+  // the hold starts where the axis is, a stale or missing estimate would swing it elsewhere
+  byte data[8];
+  unsigned long time;
+  bool fresh = _oDriveDriver->latest(axis, ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, data, &time) &&
+               millis() - time <= ODRIVE_TUNE_FRESH_MS;
+  if (!fresh) fresh = _oDriveDriver->fetch(axis, ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, data, ODRIVE_TUNE_FRESH_MS);
+  if (!fresh) {
+    _phase = OTP_FAILED;
+    _failure = "No encoder data";
+    return false;
+  }
+
+  _axis = axis;
+  memcpy(&_start, &data[0], sizeof(float));
+  _setpoint = _start;
+  _step = ODRIVE_TUNE_STEP;
+  _failure = "";
+  _result[axis].valid = false;
+
+  noInterrupts();
+  odriveHeld |= 1 << axis;
+  interrupts();
+  _oDriveDriver->monitor(odriveTunerFrame);
+
+  VF("MSG: ODriveTuner, tuning ODrive axis "); VL(axis);
+  begin(OTP_SETTLE, ODRIVE_TUNE_SETTLE_MS);
+  return true;
+}
+
+void ODriveTuner::cancel() {
+  if (busy()) finish(OTP_FAILED, "Cancelled");
+}
+
+bool ODriveTuner::apply(int axis) {
+  ODriveTuneResult *r = &_result[axis & 1];
+  if (!r->valid) return false;
+  oDriveExt.setODriveVelGains(axis, r->velGain, r->velIntGain);
+  oDriveExt.setODrivePosGain(axis, r->posGain);
+  r->applied = true;
+  VF("MSG: ODriveTuner, applied the proposed gains to ODrive axis "); VL(axis);
+  return true;
+}
+
+bool ODriveTuner::report(char *reply, int axis) {
+  ODriveTuneResult *r = &_result[axis & 1];
+  if (!r->valid) return false;
+  sprintf(reply, "%.5f,%.5f,%.3f,%.1f,%.0f,%.3f,%.4f,%.4f,%.1f,%.0f", r->inertia, r->damping, r->fit,
+          r->measuredOvershoot, r->measuredSettling, r->posGain, r->velGain, r->velIntGain,
+          r->predictedOvershoot, r->predictedSettling);
+  return true;
+}
+
+void ODriveTuner::frame(int axis, int cmd, const uint8_t *data) {
+  if (axis != _axis) return;
+
+  if (cmd == ODriveTeensyCAN::CMD_ID_GET_IQ) {
+    float iq;
+    memcpy(&iq, &data[4], sizeof(iq));
+    _iq = iq;
+    return;
+  }
+  if (cmd != ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES || !_capture || _samples >= ODRIVE_TUNE_SAMPLES) return;
+
+  ODriveTuneSample *s = &odriveTuneBuf[_samples];
+  s->micros = micros();
+  memcpy(&s->position, &data[0], sizeof(float));
+  memcpy(&s->velocity, &data[4], sizeof(float));
+  s->iq = _iq;
+  _samples = _samples + 1;
+}
+
+void ODriveTuner::poll() {
+  if (!busy()) return;
+
+  ODriveCanHealth health = _oDriveDriver->getHealth();
+  ODriveCanNodeHealth *node = &health.node[_axis];
+  if (!node->alive || node->state != AXIS_STATE_CLOSED_LOOP_CONTROL || node->axisError) {
+    finish(OTP_FAILED, "Axis left closed loop");
+    return;
+  }
+
+  // stop if the axis runs away from the setpoint
+  if (fabs(_oDriveDriver->GetPosition(_axis) - _setpoint) > ODRIVE_TUNE_ABORT*_step) {
+    finish(OTP_FAILED, "Axis ran away");
+    return;
+  }
+
+  // Iq first so it's the one stored with the encoder estimate
+  _oDriveDriver->request(_axis, ODriveTeensyCAN::CMD_ID_GET_IQ, true, 8, NULL);
+  _oDriveDriver->request(_axis, ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, true, 8, NULL);
+
+  unsigned long elapsed = millis() - _phaseStart;
+  bool ended = elapsed >= _phaseLength;
+  switch (_phase) {
+    case OTP_SETTLE:
+      if (ended) { begin(OTP_STEP, ODRIVE_TUNE_STEP_MS); _setpoint = _start + _step; }
+    break;
+    case OTP_STEP:
+      if (ended) { _capture = false; analyzeStep(); begin(OTP_RETURN, ODRIVE_TUNE_SETTLE_MS); _setpoint = _start; }
+    break;
+    case OTP_RETURN:
+      if (ended) begin(OTP_CHIRP, ODRIVE_TUNE_CHIRP_MS);
+    break;
+    case OTP_CHIRP:
+      if (ended) {
+        _capture = false;
+        _setpoint = _start;
+        _oDriveDriver->SetPosition(_axis, _setpoint);
+        fitChirp();
+        return;
+      } else {
+        // linear sweep, the phase is the integral of the frequency
+        float t = elapsed/1000.0F;
+        float T = ODRIVE_TUNE_CHIRP_MS/1000.0F;
+        float phase = 2.0F*PI*(ODRIVE_TUNE_CHIRP_F0*t + (ODRIVE_TUNE_CHIRP_F1 - ODRIVE_TUNE_CHIRP_F0)*t*t/(2.0F*T));
+        _setpoint = _start + _step/4.0F*sinf(phase);
+      }
+    break;
+    default: break;
+  }
+  _oDriveDriver->SetPosition(_axis, _setpoint);
+}
+
+// support functions
+
+void ODriveTuner::begin(ODriveTunePhase phase, unsigned long length) {
+  _phaseStart = millis();
+  _phaseLength = length;
+  if (phase == OTP_STEP || phase == OTP_CHIRP) {
+    _samples = 0;
+    _capture = true;
+  }
+  _phase = phase;
+}
+
+void ODriveTuner::finish(ODriveTunePhase phase, const char *failure) {
+  _capture = false;
+  _oDriveDriver->monitor(NULL);
+  if (phase == OTP_FAILED) _oDriveDriver->SetPosition(_axis, _start);
+
+  noInterrupts();
+  odriveHeld &= ~(1 << _axis);
+  interrupts();
+
+  _failure = failure;
+  _phase = phase;
+  if (phase == OTP_FAILED) { VF("MSG: ODriveTuner, failed: "); VL(failure); } else { VLF("MSG: ODriveTuner, done"); }
+}
+
+// overshoot and 2% settling time of the step with the gains in use
+void ODriveTuner::analyzeStep() {
+  ODriveTuneResult *r = &_result[_axis];
+  int n = _samples;
+  r->measuredOvershoot = 0;
+  r->measuredSettling = 0;
+  if (n < 2) return;
+
+  float target = _start + _step;
+  float peak = 0;
+  int outside = -1;
+  for (int i = 0; i < n; i++) {
+    float error = odriveTuneBuf[i].position - target;
+    if (error > peak) peak = error;
+    if (fabs(error) > 0.02F*_step) outside = i;
+  }
+  r->measuredOvershoot = peak/_step*100.0F;
+  if (outside >= 0) r->measuredSettling = (odriveTuneBuf[outside < n - 1 ? outside + 1 : outside].micros - odriveTuneBuf[0].micros)/1000.0F;
+}
+
+// least squares fit of torque = J * acceleration + b * velocity to the chirp, then the gains
+void ODriveTuner::fitChirp() {
+  ODriveTuneResult *r = &_result[_axis];
+  int n = _samples;
+  if (n < 64) { finish(OTP_FAILED, "Too few samples"); return; }
+
+  double saa = 0, sav = 0, svv = 0, sat = 0, svt = 0, st = 0, stt = 0;
+  int count = 0;
+  for (int k = 1; k < n - 1; k++) {
+    double dt = (odriveTuneBuf[k + 1].micros - odriveTuneBuf[k - 1].micros)*1.0E-6;
+    if (dt <= 0) continue;
+    double a = (odriveTuneBuf[k + 1].velocity - odriveTuneBuf[k - 1].velocity)/dt;
+    double v = odriveTuneBuf[k].velocity;
+    double t = odriveTuneBuf[k].iq*ODRIVE_TORQUE_CONSTANT;
+    saa += a*a; sav += a*v; svv += v*v; sat += a*t; svt += v*t; st += t; stt += t*t;
+    count++;
+  }
+
+  double det = saa*svv - sav*sav;
+  if (count < 32 || det <= 1.0E-12*saa*svv) { finish(OTP_FAILED, "Fit failed"); return; }
+  double J = (sat*svv - svt*sav)/det;
+  double b = (svt*saa - sat*sav)/det;
+  if (J <= 0) { finish(OTP_FAILED, "Fit failed"); return; }
+  if (b < 0) b = 0;
+
+  double residual = stt - 2.0*(J*sat + b*svt) + J*J*saa + 2.0*J*b*sav + b*b*svv;
+  double total = stt - st*st/count;
+  r->inertia = J;
+  r->damping = b;
+  r->fit = total > 0 ? 1.0 - residual/total : 0;
+
+  // velocity loop at the bandwidth, its integrator and the position loop a quarter of that
+  double wv = 2.0*PI*ODRIVE_TUNE_BW_HZ;
+  double velGain = J*wv - b;
+  if (velGain < 0.1*J*wv) velGain = 0.1*J*wv;
+  r->velGain = velGain;
+  r->velIntGain = velGain*wv/4.0;
+  r->posGain = wv/4.0;
+  predict(r);
+
+  r->applied = false;
+  r->valid = true;
+  finish(OTP_DONE, "");
+}
+
+// simulates a unit step with the fitted plant and the proposed gains, as the ODrive's cascade runs them
+void ODriveTuner::predict(ODriveTuneResult *r) {
+  const float dt = 0.0005F;
+  float position = 0, velocity = 0, integrator = 0, peak = 0, settled = 0;
+  for (int i = 1; i <= 4000; i++) {
+    float velError = r->posGain*(1.0F - position) - velocity;
+    integrator += r->velIntGain*velError*dt;
+    float torque = r->velGain*velError + integrator;
+    velocity += (torque - r->damping*velocity)/r->inertia*dt;
+    position += velocity*dt;
+    if (position - 1.0F > peak) peak = position - 1.0F;
+    if (fabs(position - 1.0F) > 0.02F) settled = i*dt;
+  }
+  r->predictedOvershoot = peak*100.0F;
+  r->predictedSettling = settled*1000.0F;
+}
+
+ODriveTuner oDriveTuner;
+
+#endif
@@ -0,0 +1,113 @@
+// =====================================================
+// ODriveTuner.h
+//
+// ODrive gain tuning assistant, ODRIVE_COMM_MODE == OD_CAN only
+// With the axis in closed loop control the tuner takes over its position setpoint, makes
+// a small step (measuring overshoot and settling with the present gains) and then a chirp
+// from ODRIVE_TUNE_CHIRP_F0 to F1 Hz. The chirp response is fit to a rigid body plant,
+// torque = J * acceleration + b * velocity, and pos_gain, vel_gain and vel_integrator_gain
+// are proposed for a velocity loop bandwidth of ODRIVE_TUNE_BW_HZ, with the overshoot and
+// settling a simulation of that plant and those gains predicts. Nothing is changed on the
+// ODrive until the proposal is applied.
+//
+// :GQTn#     tuning result for ODrive axis n (0 or 1)
+//            Returns: J,b,fit R2,measured overshoot %,measured settling ms,pos_gain,vel_gain,
+//                     vel_integrator_gain,predicted overshoot %,predicted settling ms#
+//            or 0 if there is no result
+
+#pragma once
+
+#include <Arduino.h>
+#include "src/Common.h"
+
+#if defined(ODRIVE_MOTOR_PRESENT) && ODRIVE_COMM_MODE == OD_CAN
+
+#include "../ODriveTeensyCAN/ODriveTeensyCAN.h"
+
+#define ODRIVE_TUNE_SAMPLE_MS  4      // task period, setpoints and requests for the axis being tuned
+#define ODRIVE_TUNE_SAMPLES    1280   // samples captured per phase
+#define ODRIVE_TUNE_SETTLE_MS  1000   // hold before and after the step
+#define ODRIVE_TUNE_STEP_MS    1500   // step response captured for this long
+#define ODRIVE_TUNE_CHIRP_MS   4000   // chirp length
+#define ODRIVE_TUNE_CHIRP_F0   0.5    // chirp start frequency in Hz
+#define ODRIVE_TUNE_CHIRP_F1   10.0   // chirp end frequency in Hz
+#define ODRIVE_TUNE_FRESH_MS   100    // the encoder estimate the hold starts from is no older than this
+#define ODRIVE_TUNE_ABORT      4      // gives up if the axis is this many steps from the setpoint
+
+enum ODriveTunePhase: uint8_t {OTP_IDLE, OTP_SETTLE, OTP_STEP, OTP_RETURN, OTP_CHIRP, OTP_DONE, OTP_FAILED};
+
+typedef struct ODriveTuneSample {
+  uint32_t micros;
+  float    position;    // turns
+  float    velocity;    // turns/s
+  float    iq;          // A
+} ODriveTuneSample;
+
+typedef struct ODriveTuneResult {
+  bool  valid;
+  float inertia;        // J in Nm per turn/s^2
+  float damping;        // b in Nm per turn/s
+  float fit;            // R^2 of the fit
+  float measuredOvershoot;     // % of the step, with the gains in use
+  float measuredSettling;      // ms to within 2% of the step
+  float posGain;        // proposed
+  float velGain;
+  float velIntGain;
+  float predictedOvershoot;
+  float predictedSettling;
+  bool  applied;        // the proposal was sent to the ODrive
+} ODriveTuneResult;
+
+class ODriveTuner {
+  public:
+    // start the tuner task
+    void init();
+
+    // tunes this ODrive axis, false if it isn't in closed loop control or something else is running
+    bool start(int axis);
+    void cancel();
+    inline bool busy() { return _phase != OTP_IDLE && _phase != OTP_DONE && _phase != OTP_FAILED; }
+    inline int axis() { return _axis; }
+    inline ODriveTunePhase phase() { return _phase; }
+
+    // why the last run failed, "" if it didn't
+    inline const char *failure() { return _failure; }
+
+    inline ODriveTuneResult result(int axis) { return _result[axis & 1]; }
+
+    // sends the proposed gains to the ODrive, false if there are none
+    bool apply(int axis);
+
+    // :GQTn# reply
+    bool report(char *reply, int axis);
+
+    // called by the CAN receive interrupt for every frame
+    void frame(int axis, int cmd, const uint8_t *data);
+
+    // the tuner task
+    void poll();
+
+  private:
+    void begin(ODriveTunePhase phase, unsigned long length);
+    void finish(ODriveTunePhase phase, const char *failure);
+    void analyzeStep();
+    void fitChirp();
+    void predict(ODriveTuneResult *r);
+
+    volatile ODriveTunePhase _phase = OTP_IDLE;
+    volatile uint16_t _samples = 0;
+    volatile bool _capture = false;
+    volatile float _iq = 0;
+    int _axis = 0;
+    float _start = 0;
+    float _setpoint = 0;
+    float _step = 0;
+    unsigned long _phaseStart = 0;
+    unsigned long _phaseLength = 0;
+    const char *_failure = "";
+    ODriveTuneResult _result[2];
+};
+
+extern ODriveTuner oDriveTuner;
+
+#endif
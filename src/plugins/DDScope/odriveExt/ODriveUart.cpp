@@ -0,0 +1,152 @@
+// =====================================================
+// ODriveUart.cpp
+//
+// Pipelined, non-blocking ODrive ASCII protocol client
+
+#include "ODriveUart.h"
+
+#if defined(ODRIVE_MOTOR_PRESENT) && ODRIVE_COMM_MODE == OD_UART
+
+#include "src/lib/axis/motor/oDrive/ODrive.h"
+#include "src/lib/tasks/OnTask.h"
+
+// the request for each value, %d is the axis, position and velocity share the feedback request
+static const char * const queries[OUV_COUNT] = {
+  "f %d\n",                                       // OUV_POS_ESTIMATE
+  "f %d\n",                                       // OUV_VEL_ESTIMATE
+  "r axis%d.encoder.pos_estimate_counts\n",       // OUV_POS_COUNTS
+  "r axis%d.controller.pos_setpoint\n",           // OUV_POS_SETPOINT
+  "r axis%d.motor.I_bus\n",                       // OUV_I_BUS
+  "r axis%d.current_state\n",                     // OUV_STATE
+  "r axis%d.error\n",                             // OUV_AXIS_ERROR
+  "r axis%d.controller.error\n",                  // OUV_CONTROLLER_ERROR
+  "r axis%d.motor.error\n",                       // OUV_MOTOR_ERROR
+  "r axis%d.encoder.error\n",                     // OUV_ENCODER_ERROR
+  "r axis%d.controller.config.vel_gain\n",        // OUV_VEL_GAIN
+  "r axis%d.controller.config.vel_integrator_gain\n", // OUV_VEL_INT_GAIN
+  "r axis%d.controller.config.pos_gain\n",        // OUV_POS_GAIN
+  "r vbus_voltage\n",                             // OUV_VBUS
+  "r error\n"                                     // OUV_TOP_ERROR
+};
+
+void odriveUartPoll() { odriveUart.poll(); }
+
+void ODriveUart::init() {
+  static uint8_t handle = 0;
+  if (handle) return;
+
+  memset(values, 0, sizeof(values));
+  memset(times, 0, sizeof(times));
+
+  VF("MSG: ODrive, start UART reader task (rate " STR(ODRIVE_UART_POLL_MS) " ms priority 3)... ");
+  handle = tasks.add(ODRIVE_UART_POLL_MS, 0, true, 3, odriveUartPoll, "ODrvUrt");
+  if (handle) { VLF("success"); } else { VLF("FAILED!"); }
+}
+
+bool ODriveUart::request(int axis, ODriveUartValue value) {
+  if (axis < 0 || axis > 1 || resync) return false;
+  if (value == OUV_VEL_ESTIMATE) value = OUV_POS_ESTIMATE;
+  if (value == OUV_VBUS || value == OUV_TOP_ERROR) axis = 0;
+
+  for (int i = 0; i < count; i++) {
+    ODriveUartRequest *r = &inFlight[(head + i) % ODRIVE_UART_PIPELINE];
+    if (r->axis == axis && r->value == value) return true;
+  }
+  if (count >= ODRIVE_UART_PIPELINE) return false;
+
+  char command[ODRIVE_UART_LINE_MAX];
+  int n = snprintf(command, sizeof(command), queries[value], axis);
+  if (bytes + n > ODRIVE_UART_RX_BYTES) return false;
+
+  // never wait on a full TX buffer, the value is asked for again on the next get
+  if (ODRIVE_SERIAL.availableForWrite() < n) return false;
+  ODRIVE_SERIAL.write(command, n);
+
+  ODriveUartRequest *r = &inFlight[(head + count) % ODRIVE_UART_PIPELINE];
+  r->axis = axis;
+  r->value = value;
+  r->bytes = n;
+  r->sent = millis();
+  count++;
+  bytes += n;
+  return true;
+}
+
+double ODriveUart::latest(int axis, ODriveUartValue value, unsigned long *time) {
+  if (axis < 0 || axis > 1) return 0;
+  if (value == OUV_VBUS || value == OUV_TOP_ERROR) axis = 0;
+  if (time != NULL) *time = times[axis][value];
+  return values[axis][value];
+}
+
+void ODriveUart::drain() {
+  unsigned long start = millis();
+  while ((count > 0 || resync) && (long)(millis() - start) < ODRIVE_UART_TIMEOUT) poll();
+}
+
+void ODriveUart::poll() {
+  read();
+
+  if (resync) {
+    if ((long)(millis() - quietSince) >= ODRIVE_UART_QUIET) resync = false;
+    return;
+  }
+
+  // the ODrive answers in order, so a missing reply stalls everything behind it
+  if (count > 0 && (long)(millis() - inFlight[head].sent) > ODRIVE_UART_TIMEOUT) {
+    timeouts++;
+    VLF("MSG: ODrive, UART reply timed out");
+    count = 0;
+    bytes = 0;
+    length = 0;
+    resync = true;
+    quietSince = millis();
+  }
+}
+
+// support functions
+
+void ODriveUart::read() {
+  while (ODRIVE_SERIAL.available()) {
+    char c = ODRIVE_SERIAL.read();
+    if (resync) { quietSince = millis(); continue; }
+    if (c == '\r') continue;
+    if (c == '\n') {
+      line[length] = 0;
+      complete();
+      length = 0;
+    } else
+    if (length < ODRIVE_UART_LINE_MAX) line[length++] = c;
+  }
+}
+
+// one reply line, for the oldest request in flight
+void ODriveUart::complete() {
+  if (count == 0) return;
+  ODriveUartRequest r = inFlight[head];
+  head = (head + 1) % ODRIVE_UART_PIPELINE;
+  count--;
+  bytes -= r.bytes;
+
+  // anything that isn't a number, like "invalid property", leaves the latest value alone
+  char *end;
+  double value = strtod(line, &end);
+  if (end == line) return;
+  values[r.axis][r.value] = value;
+  times[r.axis][r.value] = millis();
+
+  if (r.value == OUV_POS_ESTIMATE) {
+    char *next = end;
+    value = strtod(next, &end);
+    if (end == next) return;
+    values[r.axis][OUV_VEL_ESTIMATE] = value;
+    times[r.axis][OUV_VEL_ESTIMATE] = millis();
+  }
+}
+
+ODriveUart odriveUart;
+
+// the core's blocking reads wait for ours
+void odriveSerialDrain() { odriveUart.drain(); }
+
+#endif
@@ -0,0 +1,83 @@
+// =====================================================
+// ODriveUart.h
+//
+// Pipelined, non-blocking ODrive ASCII protocol client for ODRIVE_COMM_MODE == OD_UART
+// Requests are written back to back without waiting, the ODrive answers them in order
+// and a reader task matches each reply line to the oldest request in flight. Getters
+// send a request if none is in flight for that value and return the latest reply right
+// away, like the CAN driver. Position and velocity come from one "f n" feedback request.
+#pragma once
+
+#include <Arduino.h>
+#include "src/Common.h"
+
+#if defined(ODRIVE_MOTOR_PRESENT) && ODRIVE_COMM_MODE == OD_UART
+
+#define ODRIVE_UART_POLL_MS   1   // reader task period
+#define ODRIVE_UART_PIPELINE  8   // most requests in flight
+#define ODRIVE_UART_RX_BYTES  64  // most request bytes in flight, the ODrive's UART RX buffer is small
+#define ODRIVE_UART_TIMEOUT   50  // ms without a reply before the pipeline is given up and restarted
+#define ODRIVE_UART_QUIET     10  // ms the line must be silent after a timeout before requests start again
+#define ODRIVE_UART_LINE_MAX  48  // longest reply line
+#define ODRIVE_UART_FETCH_MS  200 // longest wait for a set of values that is read all at once
+
+enum ODriveUartValue: uint8_t {
+  OUV_POS_ESTIMATE, OUV_VEL_ESTIMATE, OUV_POS_COUNTS, OUV_POS_SETPOINT, OUV_I_BUS, OUV_STATE,
+  OUV_AXIS_ERROR, OUV_CONTROLLER_ERROR, OUV_MOTOR_ERROR, OUV_ENCODER_ERROR,
+  OUV_VEL_GAIN, OUV_VEL_INT_GAIN, OUV_POS_GAIN, OUV_VBUS, OUV_TOP_ERROR, OUV_COUNT
+};
+
+typedef struct ODriveUartRequest {
+  uint8_t axis;
+  uint8_t value;
+  uint8_t bytes;
+  unsigned long sent;   // millis() when written
+} ODriveUartRequest;
+
+class ODriveUart {
+  public:
+    // starts the reader task
+    void init();
+
+    // queues a request for this value unless one is in flight, false if it can't be sent now
+    bool request(int axis, ODriveUartValue value);
+
+    // the latest reply for this value, 0 until there is one
+    double latest(int axis, ODriveUartValue value, unsigned long *time = NULL);
+
+    // request() and latest() in one, never waits
+    inline double get(int axis, ODriveUartValue value) { request(axis, value); return latest(axis, value); }
+
+    // reads replies until nothing is in flight and the line is quiet, so a blocking ODriveArduino
+    // call gets its own reply
+    void drain();
+
+    // the reader task, handles the replies that arrived and expires a stalled pipeline
+    void poll();
+
+    uint16_t timeouts = 0;
+
+  private:
+    void read();
+    void complete();
+
+    ODriveUartRequest inFlight[ODRIVE_UART_PIPELINE];
+    uint8_t head = 0;
+    uint8_t count = 0;
+    uint16_t bytes = 0;
+
+    char line[ODRIVE_UART_LINE_MAX + 1];
+    uint8_t length = 0;
+
+    // after a timeout late replies are discarded until the line goes quiet, so none is
+    // taken for the answer to a newer request
+    bool resync = false;
+    unsigned long quietSince = 0;
+
+    double values[2][OUV_COUNT];
+    unsigned long times[2][OUV_COUNT];
+};
+
+extern ODriveUart odriveUart;
+
+#endif
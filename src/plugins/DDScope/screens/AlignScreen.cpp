@@ -409,14 +409,13 @@ void AlignScreen::stateMachine() {
         break;
       }   
 
-      char reply[13];
       case Goto_State: {
         if (abortBut) {
           abortBut = false;
           gotoBut = false;
           Next_State = Idle_State;
         } else if (gotoBut) {
-          if (!commandWithReply(":MS#", reply)) {
+          if (mountApi.startGoto() == CE_NONE) {
             Next_State = Wait_For_Slewing_State;
             gotoBut = false;
           } else { // Goto fails
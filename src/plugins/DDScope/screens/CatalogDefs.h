@@ -18,7 +18,7 @@
 // Common Catalog defines
 #define SD_CARD_LINE_LENGTH        110
 #define NUM_CATALOG_ROWS_PER_SCREEN 14
-#define MAX_CUSTOM_CATALOG_PAGES    10
+#define MAX_CUSTOM_CATALOG_PAGES   144
 #define MAX_CUSTOM_CATALOG_ROWS (MAX_CUSTOM_CATALOG_PAGES * NUM_CATALOG_ROWS_PER_SCREEN)
 
 #endif
\ No newline at end of file
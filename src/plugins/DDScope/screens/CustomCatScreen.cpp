@@ -12,6 +12,7 @@
 #include "MoreScreen.h"
 #include "../catalog/Catalog.h"
 #include "../catalog/CatalogTypes.h"
+#include "../catalog/CustomStore.h"
 #include "../fonts/Inconsolata_Bold8pt7b.h"
 #include "src/lib/Macros.h"
 #include "src/telescope/mount/coordinates/Transform.h"
@@ -50,17 +51,10 @@
 #define SUB_STR_X_OFF 2
 #define FONT_Y_OFF 7
 
-custom_t cArray[MAX_CUSTOM_CATALOG_ROWS];
+uint16_t cFiltArray[NUM_CATALOG_ROWS_PER_SCREEN];
 
-EXTMEM char customArray[MAX_CUSTOM_CATALOG_ROWS][SD_CARD_LINE_LENGTH];
-EXTMEM char copyCustomArray[MAX_CUSTOM_CATALOG_ROWS][SD_CARD_LINE_LENGTH]; //save a copy for row deletion purposes
-EXTMEM char cRaSrCmd[MAX_CUSTOM_CATALOG_ROWS][18];
-EXTMEM char cDecSrCmd[MAX_CUSTOM_CATALOG_ROWS][18];
-EXTMEM uint8_t cFiltArray[MAX_CUSTOM_CATALOG_ROWS];
-
-Coordinate cusTarget[MAX_CUSTOM_CATALOG_ROWS];
-double dcAlt[MAX_CUSTOM_CATALOG_ROWS];
-double dcAzm[MAX_CUSTOM_CATALOG_ROWS];
+EXTMEM double dcAlt[MAX_CUSTOM_CATALOG_ROWS];
+EXTMEM double dcAzm[MAX_CUSTOM_CATALOG_ROWS];
 
 // Catalog Button object for default Arial font
 Button customDefButton(0, 0, 0, 0, butOnBackground, butBackground, butOutline,
@@ -108,10 +102,8 @@ void CustomCatScreen::init() {
   customCatButton.draw(NEXT_X, NEXT_Y, BACK_W, BACK_H, "NEXT", BUT_OFF);
   customCatButton.draw(RETURN_X, RETURN_Y, RETURN_W, BACK_H, "RETURN", BUT_OFF);
 
-  // load the array from SD and parse it
-  if (loadCustomArray()) {
-    parseCcatIntoArray();
-  } else {
+  // load the rows from SD
+  if (!loadCustomArray()) {
     canvCustomInsPrint.printRJ(STATUS_STR_X, STATUS_STR_Y, STATUS_STR_W,
                                STATUS_STR_H, "ERR:Loading Custom", true);
     moreScreen.draw(); // go back to the More screen
@@ -123,90 +115,19 @@ void CustomCatScreen::init() {
 // The Custom catalog is a selection of User objects that have been saved on the SD card.
 //      When using any of the catalogs, the SaveToCat button will store the
 //      objects info in the Custom Catalog in the SD Flash.
-// Load the custom.csv file from SD into an RAM array of text lines
+// Load the rows from the custom catalog journal, replayed only when it has changed
 bool CustomCatScreen::loadCustomArray() {
-  File rdFile = SD.open("custom.csv");
-  if (!rdFile) {
-    SERIAL_DEBUG.println("SD Cust read error: File open failed");
+  if (!customStore.load()) {
+    SERIAL_DEBUG.println("SD Cust read error: no entries");
+    totalNumRows = 0;
     return false;
   }
 
-  char rowString[SD_CARD_LINE_LENGTH] = "";
-  int rowNum = 0;
-  int charNum = 0;
-
-  while (rdFile.available() && rowNum < MAX_CUSTOM_CATALOG_ROWS) {
-    char rdChar = rdFile.read();
-
-    // Prevent charNum overflow
-    if (charNum >= SD_CARD_LINE_LENGTH - 1) {
-      rowString[SD_CARD_LINE_LENGTH - 1] = '\0'; // Null-terminate just in case
-      SERIAL_DEBUG.println("Warning: Line too long, truncating");
-      // Save truncated line anyway
-      strncpy(customArray[rowNum], rowString, SD_CARD_LINE_LENGTH);
-      strncpy(copyCustomArray[rowNum], rowString, SD_CARD_LINE_LENGTH);
-      rowNum++;
-      charNum = 0;
-      memset(rowString, 0, SD_CARD_LINE_LENGTH);
-      continue;
-    }
-
-    // Append character to current row
-    rowString[charNum++] = rdChar;
-
-    // On newline, save the full row
-    if (rdChar == '\n') {
-      rowString[charNum] = '\0'; // Null-terminate line
-      strncpy(customArray[rowNum], rowString, SD_CARD_LINE_LENGTH);
-      strncpy(copyCustomArray[rowNum], rowString, SD_CARD_LINE_LENGTH);
-      //SERIAL_DEBUG.print("Row "); SERIAL_DEBUG.print(rowNum); SERIAL_DEBUG.print(": "); SERIAL_DEBUG.println(rowString);
-      rowNum++;
-      charNum = 0;
-      memset(rowString, 0, SD_CARD_LINE_LENGTH);
-    }
-  }
-
-  // If last line didn't end with newline, still save it
-  if (charNum > 0 && rowNum < MAX_CUSTOM_CATALOG_ROWS) {
-    rowString[charNum] = '\0';
-    strncpy(customArray[rowNum], rowString, SD_CARD_LINE_LENGTH);
-    strncpy(copyCustomArray[rowNum], rowString, SD_CARD_LINE_LENGTH);
-    SERIAL_DEBUG.print("Row "); SERIAL_DEBUG.print(rowNum); SERIAL_DEBUG.print(" (no newline): ");
-    SERIAL_DEBUG.println(rowString);
-    rowNum++;
-  }
-  rdFile.close();
-
-  // Final count: rows actually loaded
   // 1st ROW is row 0
-  totalNumRows = rowNum;
-  if (totalNumRows < 0) {
-    totalNumRows = 0;
-  }
+  totalNumRows = customStore.count();
   return true;
 }
 
-// Parse the custom.csv line data into individual fields in an array
-// custom.csv file format = ObjName;Mag;Cons;ObjType;SubId;cRahhmmss;cDecsddmmss\n
-void CustomCatScreen::parseCcatIntoArray() {
-  for (int i = 0; i < totalNumRows; i++) {
-    cArray[i].cObjName      = strtok(customArray[i], ";"); //VL(cArray[i].cObjName);
-    cArray[i].cMag          = strtok(NULL, ";");           //VL(cArray[i].cMag);
-    cArray[i].cCons         = strtok(NULL, ";");           //VL(cArray[i].cCons);
-    cArray[i].cObjType      = strtok(NULL, ";");           //VL(cArray[i].cObjType);
-    cArray[i].cSubId        = strtok(NULL, ";");           //VL(cArray[i].cSubId);
-    cArray[i].cRAhhmmss     = strtok(NULL, ";");           //VL(cArray[i].cRAhhmmss);
-    cArray[i].cDECsddmmss   = strtok(NULL, "\n");          //VL(cArray[i].cDECsddmmss);
-  }
-  // SERIAL_DEBUG.print("Final totalNumRows = ");
-  // SERIAL_DEBUG.println(totalNumRows);
-
-  // for (int i = 0; i < totalNumRows; i++) {
-  //   SERIAL_DEBUG.print("cArray["); SERIAL_DEBUG.print(i); SERIAL_DEBUG.print("] = ");
-  //   SERIAL_DEBUG.println(cArray[i].cObjName);
-  // }
-}
-
 // ========== draw CUSTOM Screen of catalog data ========
 void CustomCatScreen::drawCustomCat() {
   // write the top and bottom areas of screen
@@ -248,7 +169,7 @@ void CustomCatScreen::drawCustomCat() {
   }
 
   // Start drawing from absolute row index based on page
-  uint8_t startAbsIndex = currentPageNum * NUM_CATALOG_ROWS_PER_SCREEN;
+  uint16_t startAbsIndex = currentPageNum * NUM_CATALOG_ROWS_PER_SCREEN;
 
   SERIAL_DEBUG.print("startAbsIndex="); SERIAL_DEBUG.println(startAbsIndex);
   SERIAL_DEBUG.print("rowsThisPage="); SERIAL_DEBUG.println(rowsThisPage);
@@ -256,41 +177,30 @@ void CustomCatScreen::drawCustomCat() {
   drawPageData(startAbsIndex);
 }
 
-void CustomCatScreen::drawPageData(uint8_t startAbsIndex) {
+void CustomCatScreen::drawPageData(uint16_t startAbsIndex) {
   char catLine[50] = "";
 
   for (uint8_t i = 0; i < rowsThisPage; ++i) {
-    uint8_t absIndex = startAbsIndex + i;
+    uint16_t absIndex = startAbsIndex + i;
     if (absIndex >= totalNumRows) break;
     rowIndex = i;
 
     //SERIAL_DEBUG.print("rowIndex="); SERIAL_DEBUG.println(rowIndex);
-    // ======== process RA/DEC ===========
-    double cRAdouble;
-    double cDECdouble;
-    // to get Altitude, first convert RAh and DEC to double
-    // Note: PM_HIGH is required for the format used here
-    convert.hmsToDouble(&cRAdouble, cArray[absIndex].cRAhhmmss, PM_HIGH);
-    convert.dmsToDouble(&cDECdouble, cArray[absIndex].cDECsddmmss, true, PM_HIGH);
-
     // dcAlt[absIndex] is used by filter to check if above Horizon
     // Coordinate calculation using OnStep transforms
     // First, convert RA hours and DEC degrees to Radians
-    cusTarget[absIndex].r = hrsToRad(cRAdouble);
-    cusTarget[absIndex].d = degToRad(cDECdouble);
+    Coordinate cusTarget;
+    cusTarget.r = hrsToRad(customStore.ra(absIndex));
+    cusTarget.d = degToRad(customStore.dec(absIndex));
 
     // Then, transform RA to hour angle and equ to Altitude in radians
-    transform.rightAscensionToHourAngle(&cusTarget[absIndex], true);
-    transform.equToAlt(&cusTarget[absIndex]);
-    transform.equToHor(&cusTarget[absIndex]);
+    transform.rightAscensionToHourAngle(&cusTarget, true);
+    transform.equToAlt(&cusTarget);
+    transform.equToHor(&cusTarget);
 
     // Then, convert back to AZM and ALT degrees
-    dcAlt[absIndex] = radToDeg(cusTarget[absIndex].a);
-    dcAzm[absIndex] = NormalizeAzimuth(radToDeg(cusTarget[absIndex].z));
-
-    // Generate the Command strings for later use
-    snprintf(cRaSrCmd[absIndex], sizeof(cRaSrCmd[absIndex]), ":Sr%11s#", cArray[absIndex].cRAhhmmss);
-    snprintf(cDecSrCmd[absIndex], sizeof(cDecSrCmd[absIndex]), ":Sd%12s#", cArray[absIndex].cDECsddmmss);
+    dcAlt[absIndex] = radToDeg(cusTarget.a);
+    dcAzm[absIndex] = NormalizeAzimuth(radToDeg(cusTarget.z));
 
     // filter out elements below 10 deg if filter enabled
     //SERIAL_DEBUG.print("activeFilter="); SERIAL_DEBUG.println(moreScreen.activeFilter);
@@ -304,13 +214,13 @@ void CustomCatScreen::drawPageData(uint8_t startAbsIndex) {
     //SERIAL_DEBUG.print("y="); SERIAL_DEBUG.println(y);
     tft.fillRect(CUS_X + CUS_W + 2, y, 197, 17, butBackground);
     //tft.setCursor(CUS_X + CUS_W + 2, y);
-    customDefButton.drawLJ(CUS_X, y, CUS_W, CUS_H, cArray[absIndex].cObjName, BUT_OFF);
+    customDefButton.drawLJ(CUS_X, y, CUS_W, CUS_H, customStore.field(absIndex, CF_OBJNAME), BUT_OFF);
 
     snprintf(catLine, sizeof(catLine), "%-4s|%-4s|%-14s|%-7s",
-             cArray[absIndex].cMag,
-             cArray[absIndex].cCons,
-             cArray[absIndex].cObjType,
-             cArray[absIndex].cSubId);
+             customStore.field(absIndex, CF_MAG),
+             customStore.field(absIndex, CF_CONS),
+             customStore.field(absIndex, CF_OBJTYPE),
+             customStore.field(absIndex, CF_SUBID));
 
     tft.setCursor(CUS_X + CUS_W + SUB_STR_X_OFF + 2, y + FONT_Y_OFF);
     tft.print(catLine);
@@ -379,27 +289,27 @@ void CustomCatScreen::updateScreen() {
 
   if (prevPageNum == currentPageNum) { // erase previous selection
     customDefButton.drawLJ(CUS_X, CUS_Y + prevRelIndex * (CUS_H + CUS_Y_SPACING), CUS_W, CUS_H,
-                          cArray[prevAbsIndex].cObjName, BUT_OFF);
+                          customStore.field(prevAbsIndex, CF_OBJNAME), BUT_OFF);
   }
   // highlight selected by settting background ON color
   customDefButton.drawLJ(CUS_X, CUS_Y + relIndex * (CUS_H + CUS_Y_SPACING),
-                         CUS_W, CUS_H, cArray[absIndex].cObjName, BUT_ON);
+                         CUS_W, CUS_H, customStore.field(absIndex, CF_OBJNAME), BUT_ON);
 
   snprintf(moreScreen.catSelectionStr1, sizeof(moreScreen.catSelectionStr1),
-           "Name-:%-18s", cArray[absIndex].cObjName);
-  // SERIAL_DEBUG.print("c_objName="); //SERIAL_DEBUG.println(cArray[absIndex].cObjName);
+           "Name-:%-18s", customStore.field(absIndex, CF_OBJNAME));
+  // SERIAL_DEBUG.print("c_objName="); //SERIAL_DEBUG.println(customStore.field(absIndex, CF_OBJNAME));
   snprintf(moreScreen.catSelectionStr2, sizeof(moreScreen.catSelectionStr2),
-           "Mag--:%-4s", cArray[absIndex].cMag);
-  // SERIAL_DEBUG.print("c_Mag=");     //SERIAL_DEBUG.println(cArray[absIndex].cMag);
+           "Mag--:%-4s", customStore.field(absIndex, CF_MAG));
+  // SERIAL_DEBUG.print("c_Mag=");     //SERIAL_DEBUG.println(customStore.field(absIndex, CF_MAG));
   snprintf(moreScreen.catSelectionStr3, sizeof(moreScreen.catSelectionStr3),
-           "Const:%-4s", cArray[absIndex].cCons);
-  // SERIAL_DEBUG.print("c_constel="); //SERIAL_DEBUG.println(cArray[absIndex].cCons);
+           "Const:%-4s", customStore.field(absIndex, CF_CONS));
+  // SERIAL_DEBUG.print("c_constel="); //SERIAL_DEBUG.println(customStore.field(absIndex, CF_CONS));
   snprintf(moreScreen.catSelectionStr4, sizeof(moreScreen.catSelectionStr4),
-           "Type-:%-14s", cArray[absIndex].cObjType);
-  // SERIAL_DEBUG.print("c_objType="); //SERIAL_DEBUG.println(cArray[absIndex].cObjType);
+           "Type-:%-14s", customStore.field(absIndex, CF_OBJTYPE));
+  // SERIAL_DEBUG.print("c_objType="); //SERIAL_DEBUG.println(customStore.field(absIndex, CF_OBJTYPE));
   snprintf(moreScreen.catSelectionStr5, sizeof(moreScreen.catSelectionStr5),
-           "Id---:%-6s", cArray[absIndex].cSubId);
-  // SERIAL_DEBUG.print("c_subID=");   //SERIAL_DEBUG.println(cArray[absIndex].cSubId);
+           "Id---:%-6s", customStore.field(absIndex, CF_SUBID));
+  // SERIAL_DEBUG.print("c_subID=");   //SERIAL_DEBUG.println(customStore.field(absIndex, CF_SUBID));
 
   // show if we are above and below visible limits
   tft.setFont(&Inconsolata_Bold8pt7b);
@@ -429,48 +339,19 @@ void CustomCatScreen::deleteRow() {
 
     // Absolute index of the row to delete
     absIndex = cFiltArray[buttonSelected];
-    uint8_t delIndex = absIndex;
+    uint16_t delIndex = absIndex;
 
-    if (totalNumRows == 0) { // first entry is number 0
-      // Only one row in the file — just delete the whole file
-      File rmFile = SD.open("/custom.csv");
-      SD.remove("/custom.csv");
-      rmFile.close();
+    if (delIndex >= totalNumRows) {
+      SERIAL_DEBUG.println("Invalid deletion index — skipping.");
       return;
-    } else {
-      if (delIndex >= totalNumRows) {
-        SERIAL_DEBUG.println("Invalid deletion index — skipping.");
-        return;
-      }
-
-      // Shift remaining rows up one position
-      memmove(&copyCustomArray[delIndex], &copyCustomArray[delIndex + 1], (totalNumRows - delIndex) * SD_CARD_LINE_LENGTH);
-
-      // Clear last row
-      memset(copyCustomArray[totalNumRows], '\0', SD_CARD_LINE_LENGTH);
-
-      // Decrease total count of entries
-      totalNumRows--;
-    }
-
-    // Delete existing file
-    File rmFile = SD.open("/custom.csv");
-    if (rmFile) {
-      SD.remove("/custom.csv");
     }
-    rmFile.close();
 
-    // Rewrite trimmed array to SD
-    File cWrFile = SD.open("custom.csv", FILE_WRITE);
-    if (!cWrFile) {
-      canvCustomInsPrint.printRJ(STATUS_STR_X, STATUS_STR_Y, STATUS_STR_W, STATUS_STR_H, "SD open ERROR", true);
+    // a tombstone appended to the journal, the rows are reloaded after
+    if (!customStore.remove(delIndex)) {
+      canvCustomInsPrint.printRJ(STATUS_STR_X, STATUS_STR_Y, STATUS_STR_W, STATUS_STR_H, "SD write ERROR", true);
       return;
     }
-
-    for (uint8_t i = 0; i < totalNumRows; i++) {
-      cWrFile.print(copyCustomArray[i]);
-    }
-    cWrFile.close();
+    totalNumRows--;
   }
   prevRelIndex = 0;
   prevAbsIndex = 0;
@@ -551,10 +432,8 @@ bool CustomCatScreen::touchPoll(uint16_t px, uint16_t py) {
     delSelected = true;
     buttonDetected = true;
     deleteRow();
-    // load the array from SD and parse it
-    if (loadCustomArray()) {
-      parseCcatIntoArray();
-    } else {
+    // reload the rows from SD
+    if (!loadCustomArray()) {
     canvCustomInsPrint.printRJ(STATUS_STR_X, STATUS_STR_Y, STATUS_STR_W,
                                STATUS_STR_H, "ERR:Loading Custom", true);
     moreScreen.draw(); // go back to the More screen
@@ -572,16 +451,7 @@ bool CustomCatScreen::touchPoll(uint16_t px, uint16_t py) {
 
 // ======= write Target Coordinates to controller =========
 void CustomCatScreen::writeCustomTarget(uint16_t index) {
-
-  //: Sr[HH:MM.T]# or :Sr[HH:MM:SS]#
-  //SERIAL_DEBUG.print("index=");
-  //SERIAL_DEBUG.println(index);
-  commandBool(cRaSrCmd[index]);
-  //SERIAL_DEBUG.println(cRaSrCmd[index]);
-
-  //: Sd[sDD*MM]# or :Sd[sDD*MM:SS]#
-  commandBool(cDecSrCmd[index]);
-  //SERIAL_DEBUG.println(cDecSrCmd[index]);
+  mountApi.setTarget(customStore.ra(index), customStore.dec(index));
   objSel = true;
 }
 
@@ -622,10 +492,10 @@ void CustomCatScreen::showTargetCoords() {
 
   // Using the values stored in master array during drawCustomCat()
   // RA and DEC settings
-  sprintf(_reply, "RA : %s", cArray[absIndex].cRAhhmmss);
+  sprintf(_reply, "RA : %s", customStore.field(absIndex, CF_RA));
   //sprintf(_reply, "RA: %6.1f", cusTarget[absIndex].r);
   canvCustomDefPrint.printRJ(radec_x, ra_y, width, height, _reply, false);
-  sprintf(_reply, "DEC: %s", cArray[absIndex].cDECsddmmss);
+  sprintf(_reply, "DEC: %s", customStore.field(absIndex, CF_DEC));
   //sprintf(_reply, "DEC: %6.1f", cusTarget[absIndex].d);
   canvCustomDefPrint.printRJ(radec_x, dec_y, width, height, _reply, false);
   
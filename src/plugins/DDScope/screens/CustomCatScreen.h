@@ -10,16 +10,6 @@
 class Display;
 class MoreScreen;
 
-typedef struct {
-  char* cObjName;
-  char* cMag;
-  char* cCons;
-  char* cObjType;
-  char* cSubId;
-  char* cRAhhmmss;
-  char* cDECsddmmss;
-} custom_t; 
-
 class CustomCatScreen : public Display {
   public:
     void init();
@@ -33,10 +23,9 @@ class CustomCatScreen : public Display {
     void writeCustomTarget(uint16_t index);
     void showTargetCoords();
     bool loadCustomArray();
-    void parseCcatIntoArray();
     void drawCustomCat();
     void deleteRow();
-    void drawPageData(uint8_t startAbsIndex);
+    void drawPageData(uint16_t startAbsIndex);
 
     bool delSelected = false;
     bool buttonDetected = false;
@@ -45,12 +34,12 @@ class CustomCatScreen : public Display {
     bool objSel = false;
 
     uint8_t buttonSelected = 0;
-    uint8_t totalNumRows = 0;
-    uint8_t rowIndex = 0;
-    uint8_t relIndex = 0;
-    uint8_t absIndex = 0;
-    uint8_t prevAbsIndex = 0;
-    uint8_t prevRelIndex = 0;
+    uint16_t totalNumRows = 0;
+    uint16_t rowIndex = 0;
+    uint16_t relIndex = 0;
+    uint16_t absIndex = 0;
+    uint16_t prevAbsIndex = 0;
+    uint16_t prevRelIndex = 0;
 
     // Paging
     uint8_t currentPageNum = 0;
@@ -63,7 +52,6 @@ class CustomCatScreen : public Display {
     const char *activeFilterStr[3] = {"Filt: None", "Filt: Abv Hor", "Filt: All Sky"};
 };
 
-extern custom_t cArray[MAX_CUSTOM_CATALOG_ROWS];
 extern CustomCatScreen customCatScreen;
 
 #endif
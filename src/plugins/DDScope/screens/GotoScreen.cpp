@@ -9,6 +9,7 @@
 #include <Fonts/FreeSansBold9pt7b.h>
 #include "src/telescope/mount/Mount.h"
 #include "src/lib/tasks/OnTask.h"
+#include "../catalog/NameIndex.h"
 
 #define NUM_BUTTON_X         2
 #define NUM_BUTTON_Y         252
@@ -38,6 +39,10 @@
 #define DEC_CLEAR_X          RA_CLEAR_X
 #define DEC_CLEAR_Y          DEC_SELECT_Y
 
+#define NAME_SELECT_X        148
+#define NAME_SELECT_Y        221
+#define NAME_FIELD_WIDTH     195
+
 #define SEND_BUTTON_X        215
 #define SEND_BUTTON_Y        220
 #define SEND_BOXSIZE_X       70
@@ -108,18 +113,14 @@ void GotoScreen::draw() {
   tft.setFont(&Inconsolata_Bold8pt7b);
 
   drawCommonStatusLabels();
+  nameShown = NAMEselect;
   updateGotoButtons();
 
   RAtextIndex = 0; 
   DECtextIndex = 0; 
 
-  // Draw RA and DEC Coordinate Labels
   tft.setCursor(160, 430);
   tft.print("Assumes Epoch J2000");
-  tft.setCursor(TEXT_LABEL_X, TEXT_LABEL_Y);
-  tft.print(" RA  (hhmm[ss]):");
-  tft.setCursor(TEXT_LABEL_X, TEXT_LABEL_Y+TEXT_SPACING_Y);
-  tft.print("DEC(sddmm[sec]):");
 
   // Draw Key Pad
   int z=0;
@@ -133,9 +134,7 @@ void GotoScreen::draw() {
     }
   }
 
-  // show number input fields
-  tft.fillRect(TEXT_FIELD_X, TEXT_FIELD_Y+CUSTOM_FONT_OFFSET, TEXT_FIELD_WIDTH, TEXT_FIELD_HEIGHT-9,  butBackground);
-  tft.fillRect(TEXT_FIELD_X, TEXT_FIELD_Y+TEXT_SPACING_Y+CUSTOM_FONT_OFFSET, TEXT_FIELD_WIDTH, TEXT_FIELD_HEIGHT-9,  butBackground);
+  if (NAMEselect) showNameMatch(); else drawCoordFields();
   
   updateCommonStatus();
   #ifdef ENABLE_TFT_MIRROR
@@ -147,6 +146,46 @@ void GotoScreen::draw() {
   #endif
 } // end initialize
 
+// Draw RA and DEC Coordinate Labels and number input fields
+void GotoScreen::drawCoordFields() {
+  tft.fillRect(TEXT_LABEL_X, TEXT_LABEL_Y+CUSTOM_FONT_OFFSET, NAME_FIELD_WIDTH, TEXT_SPACING_Y+TEXT_FIELD_HEIGHT-9, pgBackground);
+  tft.setCursor(TEXT_LABEL_X, TEXT_LABEL_Y);
+  tft.print(" RA  (hhmm[ss]):");
+  tft.setCursor(TEXT_LABEL_X, TEXT_LABEL_Y+TEXT_SPACING_Y);
+  tft.print("DEC(sddmm[sec]):");
+
+  tft.fillRect(TEXT_FIELD_X, TEXT_FIELD_Y+CUSTOM_FONT_OFFSET, TEXT_FIELD_WIDTH, TEXT_FIELD_HEIGHT-9,  butBackground);
+  tft.fillRect(TEXT_FIELD_X, TEXT_FIELD_Y+TEXT_SPACING_Y+CUSTOM_FONT_OFFSET, TEXT_FIELD_WIDTH, TEXT_FIELD_HEIGHT-9,  butBackground);
+}
+
+// Show the selected match for the name typed so far in place of the RA and DEC fields
+// Keypad: 2-9 letters, 0 space, 1 punctuation, "-" delete last key, "+" next match
+void GotoScreen::showNameMatch() {
+  char name[22] = "";
+  char line[28] = "";
+
+  tft.fillRect(TEXT_LABEL_X, TEXT_LABEL_Y+CUSTOM_FONT_OFFSET, NAME_FIELD_WIDTH, TEXT_SPACING_Y+TEXT_FIELD_HEIGHT-9, pgBackground);
+  tft.fillRect(TEXT_LABEL_X, TEXT_FIELD_Y+CUSTOM_FONT_OFFSET, NAME_FIELD_WIDTH, TEXT_FIELD_HEIGHT-9, butBackground);
+  tft.setCursor(TEXT_LABEL_X, TEXT_LABEL_Y+TEXT_SPACING_Y);
+  if (nameIndex.numKeys() == 0) {
+    tft.print("Name: 2-9 letters");
+    return;
+  }
+
+  nameIndex.getName(nameMatch, name, sizeof(name));
+  snprintf(line, sizeof(line), "%d/%d %s", nameMatch+1, nameIndex.count(), nameIndex.getCatalogTitle(nameMatch));
+  tft.print(line);
+  tft.setCursor(TEXT_LABEL_X, TEXT_FIELD_Y);
+  tft.print(name);
+}
+
+// Write the selected name match as the Go To target
+void GotoScreen::setNameTarget() {
+  double ra, dec;
+  if (nameIndex.numKeys() == 0 || !nameIndex.getCoords(nameMatch, ra, dec)) return;
+  mountApi.setTarget(ra, dec);
+}
+
 // task update for this screen
 void GotoScreen::updateGotoStatus() {
   //
@@ -155,6 +194,21 @@ void GotoScreen::updateGotoStatus() {
 // assign label to pressed button field
 void GotoScreen::processNumPadButton() {
   if (numDetected) {
+    if (NAMEselect && buttonPosition >= 0 && buttonPosition < 12) {
+      char key = numLabels[buttonPosition][0];
+      if (key == '-') {
+        nameIndex.popKey();
+        nameMatch = 0;
+      } else if (key == '+') {
+        if (nameIndex.count() > 0) nameMatch = (nameMatch + 1) % nameIndex.count();
+      } else if (nameIndex.pushKey(key)) {
+        nameMatch = 0;
+      } else {
+        ALERT; // no name continues with this key
+      }
+      showNameMatch();
+    }
+
     if (RAselect && (buttonPosition >= 0 && (buttonPosition < 9 || buttonPosition == 10)) && RAtextIndex < 6) {
       RAtext[RAtextIndex] = numLabels[buttonPosition][0];
       tft.fillRect(TEXT_FIELD_X, TEXT_FIELD_Y+CUSTOM_FONT_OFFSET, TEXT_FIELD_WIDTH, TEXT_FIELD_HEIGHT-9,  butBackground);
@@ -189,7 +243,7 @@ bool GotoScreen::gotoButStateChange() {
       changed = true;
     }
 
-    if (RAselect || DECselect){
+    if (RAselect || DECselect || NAMEselect){
       changed = true;
     }
   }
@@ -265,6 +319,27 @@ void GotoScreen::updateGotoButtons() {
     gotoButton.draw(DEC_CLEAR_X,  DEC_CLEAR_Y, CO_BOXSIZE_X, CO_BOXSIZE_Y, "DeClr", BUT_OFF);
   }
   
+  // Name search Select button
+  if (NAMEselect) {
+    gotoButton.draw(NAME_SELECT_X, NAME_SELECT_Y, CO_BOXSIZE_X, CO_BOXSIZE_Y, "Name", BUT_ON);
+  } else {
+    gotoButton.draw(NAME_SELECT_X, NAME_SELECT_Y, CO_BOXSIZE_X, CO_BOXSIZE_Y, "Name", BUT_OFF);
+  }
+
+  // swap the RA/DEC fields and the name match display
+  if (nameShown != NAMEselect) {
+    nameShown = NAMEselect;
+    if (NAMEselect) {
+      showNameMatch();
+    } else {
+      drawCoordFields();
+      tft.setCursor(TEXT_FIELD_X, TEXT_FIELD_Y);
+      tft.print(RAtext);
+      tft.setCursor(TEXT_FIELD_X, TEXT_FIELD_Y+TEXT_SPACING_Y);
+      tft.print(DECtext);
+    }
+  }
+
   // Send Coordinates Button
   if (sendOn) {
     gotoButton.draw(SEND_BUTTON_X, SEND_BUTTON_Y, SEND_BOXSIZE_X, SEND_BOXSIZE_Y, "Sent", BUT_ON);
@@ -342,6 +417,7 @@ bool GotoScreen::touchPoll(uint16_t px, uint16_t py) {
     BEEP;
     RAselect = true; 
     DECselect = false;
+    NAMEselect = false;
     return true;
   }
 
@@ -359,6 +435,7 @@ bool GotoScreen::touchPoll(uint16_t px, uint16_t py) {
     BEEP;
     DECselect = true;
     RAselect = false;
+    NAMEselect = false;
     return true;
   }
 
@@ -371,6 +448,19 @@ bool GotoScreen::touchPoll(uint16_t px, uint16_t py) {
     return true; 
   }
 
+  // Select Name search, typed on the keypad
+  if (py > NAME_SELECT_Y && py < (NAME_SELECT_Y + CO_BOXSIZE_Y) && px > NAME_SELECT_X && px < (NAME_SELECT_X + CO_BOXSIZE_X)) {
+    BEEP;
+    if (!NAMEselect) {
+      nameIndex.clear();
+      nameMatch = 0;
+    }
+    NAMEselect = true;
+    RAselect = false;
+    DECselect = false;
+    return true;
+  }
+
   // SEND Coordinates
   if (py > SEND_BUTTON_Y && py < (SEND_BUTTON_Y + SEND_BOXSIZE_Y) && px > SEND_BUTTON_X && px < (SEND_BUTTON_X + SEND_BOXSIZE_X)) {
     BEEP;
@@ -379,7 +469,9 @@ bool GotoScreen::touchPoll(uint16_t px, uint16_t py) {
     DECtextIndex = 0;
     buttonPosition = 12; 
     
-    if (RAselect) {
+    if (NAMEselect) {
+      setNameTarget();
+    } else if (RAselect) {
       //:Sr[HH:MM.T]# or :Sr[HH:MM:SS]# 
       sprintf(temp, ":Sr%c%c:%c%c:%c%c#", RAtext[0], RAtext[1], RAtext[2], RAtext[3], RAtext[4], RAtext[5]);
       commandBool(temp);
@@ -404,8 +496,8 @@ bool GotoScreen::touchPoll(uint16_t px, uint16_t py) {
   if (py > GOTO_BUTTON_Y && py < (GOTO_BUTTON_Y + GOTO_BOXSIZE_Y) && px > GOTO_BUTTON_X && px < (GOTO_BUTTON_X + GOTO_BOXSIZE_X)) {
     BEEP;
     goToButton = true;
-    commandBool(":Te#"); // Enable Tracking
-    commandWithReply(":MS#", temp);
+    mountApi.setTracking(true);
+    mountApi.startGoto();
     return true;
   }
 
@@ -440,8 +532,7 @@ bool GotoScreen::touchPoll(uint16_t px, uint16_t py) {
  // Quick set the target to Polaris
 void GotoScreen::setTargPolaris() {
   // Polaris location RA=02:31:49.09, Dec=+89:15:50.8 (2.5303, 89.2641)
-  commandBool(":Sr02:31:49#");
-  commandBool(":Sd+89:15:50#"); 
+  mountApi.setTarget(2.530303, 89.264111);
   updateAltAzmTarget();
 }
 
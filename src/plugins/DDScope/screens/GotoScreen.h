@@ -20,6 +20,9 @@ class GotoScreen : public Display {
   private:
     void processNumPadButton();
     void setTargPolaris();
+    void drawCoordFields();
+    void showNameMatch();
+    void setNameTarget();
     
     char RAtext[8] = "";
     char DECtext[8] = "";
@@ -34,6 +37,9 @@ class GotoScreen : public Display {
     bool RAclear = false;
     bool DECselect = false;
     bool DECclear = false;
+    bool NAMEselect = false;
+    bool nameShown = false;
+    int nameMatch = 0;
     bool sendOn = false;
     bool setPolOn = false;
     bool numDetected = false;
@@ -309,16 +309,16 @@ bool GuideScreen::touchPoll(uint16_t px, uint16_t py) {
       BEEP; 
       if (!guidingWest) {
         #ifdef EAST_WEST_SWAPPED 
-          commandBlind(":Me#");
+          mountApi.move(MD_EAST);
         #else
-          commandBlind(":Mw#");
+          mountApi.move(MD_WEST);
         #endif 
         guidingWest = true;
       } else if (!mount.isSlewing() || guidingWest) {
         #ifdef EAST_WEST_SWAPPED 
-          commandBlind(":Qe#");
+          mountApi.stopGuide(MD_EAST);
         #else
-          commandBlind(":Qw#");
+          mountApi.stopGuide(MD_WEST);
         #endif
         guidingWest = false;
       }
@@ -330,16 +330,16 @@ bool GuideScreen::touchPoll(uint16_t px, uint16_t py) {
       BEEP; 
       if (!guidingEast) {
         #ifdef EAST_WEST_SWAPPED 
-          commandBlind(":Mw#");
+          mountApi.move(MD_WEST);
         #else
-          commandWBlind(":Me#");
+          mountApi.move(MD_EAST);
         #endif
         guidingEast = true;
       } else if (!mount.isSlewing() || guidingEast) {
         #ifdef EAST_WEST_SWAPPED 
-          commandBlind(":Qw#");
+          mountApi.stopGuide(MD_WEST);
         #else
-          commandBlind(":Qe#");
+          mountApi.stopGuide(MD_EAST);
         #endif
         guidingEast = false;
       }
@@ -350,10 +350,10 @@ bool GuideScreen::touchPoll(uint16_t px, uint16_t py) {
     if (py > UP_OFFSET_Y && py < (UP_OFFSET_Y + GUIDE_BOXSIZE_Y) && px > UP_OFFSET_X && px < (UP_OFFSET_X + GUIDE_BOXSIZE_X)) {
       BEEP; 
       if (!guidingNorth) {
-        commandBlind(":Mn#");
+        mountApi.move(MD_NORTH);
         guidingNorth = true;
       } else if (!mount.isSlewing() || guidingNorth) {
-        commandBlind(":Qn#");
+        mountApi.stopGuide(MD_NORTH);
         guidingNorth = false;
       }
       return true;
@@ -363,10 +363,10 @@ bool GuideScreen::touchPoll(uint16_t px, uint16_t py) {
     if (py > DOWN_OFFSET_Y && py < (DOWN_OFFSET_Y + GUIDE_BOXSIZE_Y) && px > DOWN_OFFSET_X && px < (DOWN_OFFSET_X + GUIDE_BOXSIZE_X)) {
       BEEP; 
       if (!guidingSouth) {
-        commandBlind(":Ms#");
+        mountApi.move(MD_SOUTH);
         guidingSouth = true;
       } else if (!mount.isSlewing() || guidingSouth) {
-        commandBlind(":Qs#");
+        mountApi.stopGuide(MD_SOUTH);
         guidingSouth = false;
       }
       return true;
@@ -17,6 +17,7 @@
 #include "PlanetsScreen.h"
 #include "HomeScreen.h"
 #include "../catalog/Catalog.h" // from SHC
+#include "../catalog/CustomStore.h"
 #include "../fonts/Inconsolata_Bold8pt7b.h"
 #include <Fonts/FreeSansBold9pt7b.h>
 #include "../fonts/UbuntuMono_Bold11pt7b.h"
@@ -27,7 +28,8 @@
 #define CAT_SEL_Y              179
 #define CAT_SEL_BOXSIZE_X      110 
 #define CAT_SEL_BOXSIZE_Y       28
-#define CAT_SEL_SPACER          CAT_SEL_BOXSIZE_Y + 5
+#define CAT_SEL_SPACER         (CAT_SEL_BOXSIZE_Y + 5)
+#define CAT_SEL_ROWS             8 // rows that fit above the bottom status line, Planets/Treasure/Custom included
 
 // Tracking rate buttons
 #define TRACK_R_X              125
@@ -176,6 +178,12 @@ bool MoreScreen::moreButStateChange() {
   return changed;
 }
 
+// catalog buttons shown at once, with more catalogs than fit the last row pages through them
+int MoreScreen::catButtonsPerPage() {
+  if (cat_mgr.numCatalogs() <= CAT_SEL_ROWS - 3) return CAT_SEL_ROWS - 3;
+  return CAT_SEL_ROWS - 4;
+}
+
 //================== Update the Buttons ======================
 void MoreScreen::updateMoreButtons() {
 
@@ -280,11 +288,7 @@ void MoreScreen::updateMoreButtons() {
     if (yesBut) { // go ahead and clear
       moreButton.draw(MISC_X, MISC_Y + y_offset, MISC_BOXSIZE_X, MISC_BOXSIZE_Y, "Clearing", BUT_ON);
       
-      File rmFile = SD.open("/custom.csv");
-        if (rmFile) {
-          SD.remove("/custom.csv");
-        }
-      rmFile.close(); 
+      customStore.clear();
 
       display._redrawBut = true;
       yesBut = false;
@@ -331,15 +335,27 @@ void MoreScreen::updateMoreButtons() {
   tft.setFont(&Inconsolata_Bold8pt7b); 
 
   // Draw the Catalog Buttons
-  char title[16]="";
+  char title[CAT_TITLE_SIZE]="";
+  int numCats = cat_mgr.numCatalogs();
+  int perPage = catButtonsPerPage();
+  int first = catPage*perPage;
+  if (first >= numCats) { catPage = 0; first = 0; }
   y_offset = 0;
-  for (uint16_t i=1; i<=cat_mgr.numCatalogs(); i++) {
-    cat_mgr.select(i-1);
-    strcpy(title,cat_mgr.catalogTitle());
+  if (numCats > perPage) tft.fillRect(CAT_SEL_X, CAT_SEL_Y, CAT_SEL_BOXSIZE_X, perPage*CAT_SEL_SPACER, pgBackground);
+  for (int i=first; i<numCats && i<first+perPage; i++) {
+    cat_mgr.select(i);
+    strlcpy(title,cat_mgr.catalogTitle(),sizeof(title));
     moreButton.draw(CAT_SEL_X, CAT_SEL_Y+y_offset, CAT_SEL_BOXSIZE_X, CAT_SEL_BOXSIZE_Y, title, BUT_OFF);
     y_offset += CAT_SEL_SPACER;
   }
 
+  // Next page of catalogs
+  if (numCats > perPage) {
+    y_offset = perPage*CAT_SEL_SPACER;
+    moreButton.draw(CAT_SEL_X, CAT_SEL_Y+y_offset, CAT_SEL_BOXSIZE_X, CAT_SEL_BOXSIZE_Y, "More Cats>", BUT_OFF);
+    y_offset += CAT_SEL_SPACER;
+  }
+
   // Planet Catalog Button
   moreButton.draw(CAT_SEL_X, CAT_SEL_Y+y_offset, CAT_SEL_BOXSIZE_X, CAT_SEL_BOXSIZE_Y, "Planets", BUT_OFF);
 
@@ -490,10 +506,9 @@ bool MoreScreen::touchPoll(uint16_t px, uint16_t py) {
   // **** Go To Target Coordinates ****
   if (py > GOTO_BUT_Y && py < (GOTO_BUT_Y + GOTO_M_BOXSIZE_Y) && px > GOTO_BUT_X && px < (GOTO_BUT_X + GOTO_M_BOXSIZE_X)) {
     BEEP;
-    char reply[80] = "";
     goToButton = true;
-    commandBool(":Te#"); // Enable Tracking
-    commandWithReply(":MS#", reply);
+    mountApi.setTracking(true);
+    mountApi.startGoto();
     return true;
   }
 
@@ -507,16 +522,19 @@ bool MoreScreen::touchPoll(uint16_t px, uint16_t py) {
   }
 
   // SHC Catalog Selection Buttons 
+  int numCats = cat_mgr.numCatalogs();
+  int perPage = catButtonsPerPage();
+  int first = catPage*perPage;
   y_offset = 0;
-  for (uint16_t i=1; i<=cat_mgr.numCatalogs(); i++) {
+  for (int i=first; i<numCats && i<first+perPage; i++) {
     if (px > CAT_SEL_X && px < CAT_SEL_X + CAT_SEL_BOXSIZE_X && py > CAT_SEL_Y+y_offset  && py < CAT_SEL_Y+y_offset + CAT_SEL_BOXSIZE_Y) {
       BEEP;
       // disable ALL_SKY filter if any DSO catalog...it's for STARS only
-      if (i != 1 && activeFilter == FM_ALIGN_ALL_SKY) { // 1 is STARS
+      if (i != 0 && activeFilter == FM_ALIGN_ALL_SKY) { // 0 is STARS
         cat_mgr.filtersClear();
         activeFilter = FM_NONE;
       } 
-      shcCatScreen.init(i-1); // draws the selected SHC Catalog page
+      shcCatScreen.init(i); // draws the selected SHC Catalog page
       //catalogsActive = true;
       return false; // shut off flag that draws More Page buttons
 
@@ -524,6 +542,19 @@ bool MoreScreen::touchPoll(uint16_t px, uint16_t py) {
     y_offset += CAT_SEL_SPACER;
   }
 
+  // Next page of catalogs Button
+  if (numCats > perPage) {
+    y_offset = perPage*CAT_SEL_SPACER;
+    if (px > CAT_SEL_X && px < CAT_SEL_X + CAT_SEL_BOXSIZE_X && py > CAT_SEL_Y+y_offset  && py < CAT_SEL_Y+y_offset + CAT_SEL_BOXSIZE_Y) {
+      BEEP;
+      catPage++;
+      if (catPage*perPage >= numCats) catPage = 0;
+      display._redrawBut = true;
+      return true;
+    }
+    y_offset += CAT_SEL_SPACER;
+  }
+
   // Planet Catalog Select Button
   if (px > CAT_SEL_X && px < CAT_SEL_X + CAT_SEL_BOXSIZE_X && py > CAT_SEL_Y+y_offset  && py < CAT_SEL_Y+y_offset + CAT_SEL_BOXSIZE_Y) {
     BEEP;
@@ -46,6 +46,9 @@ class MoreScreen : public Display {
     bool cancelBut = false;
     bool yesCancelActive = false;
     bool preSlewState = false;
+
+    int catButtonsPerPage();
+    int catPage = 0;
     
 };
 
@@ -6,12 +6,16 @@
 #include "../../../telescope/mount/Mount.h"
 #include "../fonts/Inconsolata_Bold8pt7b.h"
 #include "src/lib/tasks/OnTask.h"
+#include "../odriveExt/ODriveUart.h"
 #include <ODriveArduino.h> // https://github.com/odriverobotics/ODrive/tree/master/Arduino/ODriveArduino
 
 #define OD_ERR_OFFSET_X 4
 #define OD_ERR_OFFSET_Y 190
 #define OD_ERR_SPACING 11
 #define OD_BUTTONS_OFFSET 45
+#define OD_CAN_OFFSET_X 206
+#define OD_CAN_OFFSET_Y 224
+#define OD_CAN_SPACING 10
 
 // Buttons for actions that are not page selections
 #define OD_ACT_BOXSIZE_X 100
@@ -25,6 +29,14 @@
 #define OD_ACT_X_SPACING 7
 #define OD_ACT_Y_SPACING 3
 
+// Velocity gain buttons at the top of column 3
+#define OD_GAIN_Y (OD_ACT_COL_3_Y - 160)
+#if ODRIVE_COMM_MODE == OD_CAN
+  #define OD_GAIN_LABELS {"AZ Hi", "AZ Def", "AL Hi", "AL Def"}
+#else
+  #define OD_GAIN_LABELS {"AZ Gain Hi", "AZ Gain Def", "ALT Gain Hi", "ALT Gain Def"}
+#endif
+
 // Printing with stream operator helper functions
 template <class T> inline Print &operator<<(Print &obj, T arg) {
   obj.print(arg);
@@ -70,6 +82,8 @@ void ODriveScreen::draw() {
   tft.setFont(&Inconsolata_Bold8pt7b);
 
 #if ODRIVE_COMM_MODE == OD_UART
+  // blocking reads, so nothing of the pipelined client's may be left in flight
+  odriveUart.drain();
   ODRIVE_SERIAL << "r hw_version_major\n";
   oDversion.hwMajor = _oDriveDriver->readInt();
 
@@ -124,7 +138,10 @@ void ODriveScreen::draw() {
   updateOdriveButtons();
   updateOdriveStatus();
   showGains();
-  showODriveErrors();
+  #if ODRIVE_COMM_MODE == OD_CAN
+    tuneShown = false;
+  #endif
+  showODriveErrors(true);
 #ifdef ENABLE_TFT_MIRROR
   wifiDisplay.enableScreenCapture(false);
   wifiDisplay.sendFrameToEsp(FRAME_TYPE_DEF);
@@ -136,7 +153,131 @@ void ODriveScreen::draw() {
 
 // status update for this screen
 void ODriveScreen::updateOdriveStatus() {
-  // showODriveErrors();
+  #if ODRIVE_COMM_MODE == OD_CAN
+    if (tuneShown) showTuning(false); else showODriveErrors(false);
+    showCanHealth();
+  #else
+    showODriveErrors(false);
+  #endif
+}
+
+#if ODRIVE_COMM_MODE == OD_CAN
+// ====== Show the CAN bus and heartbeat health ======
+void ODriveScreen::showCanHealth() {
+  ODriveCanHealth health = _oDriveDriver->getHealth();
+  char line[24];
+  tft.setFont(0);
+  tft.fillRect(OD_CAN_OFFSET_X, OD_CAN_OFFSET_Y, 320 - OD_CAN_OFFSET_X, 5 * OD_CAN_SPACING, pgBackground);
+
+  tft.setCursor(OD_CAN_OFFSET_X, OD_CAN_OFFSET_Y);
+  sprintf(line, "CAN load %3u%% %4u/s", health.loadPercent, health.framesPerSecond);
+  tft.print(line);
+
+  tft.setCursor(OD_CAN_OFFSET_X, OD_CAN_OFFSET_Y + OD_CAN_SPACING);
+  sprintf(line, "RTT %lu/%lu us", health.rttAverage, health.rttMax);
+  tft.print(line);
+
+  tft.setCursor(OD_CAN_OFFSET_X, OD_CAN_OFFSET_Y + 2 * OD_CAN_SPACING);
+  sprintf(line, "TO %u Full %u Err %u", health.timeouts, health.txFull, health.busErrors);
+  tft.print(line);
+
+  // AZ is motor 1, ALT is motor 0
+  for (int i = 0; i < 2; i++) {
+    int motor = i == 0 ? AZM_MOTOR : ALT_MOTOR;
+    ODriveCanNodeHealth *node = &health.node[motor];
+    tft.setCursor(OD_CAN_OFFSET_X, OD_CAN_OFFSET_Y + (3 + i) * OD_CAN_SPACING);
+    if (node->alive) {
+      sprintf(line, "%s st%u miss %u", i == 0 ? "AZM" : "ALT", node->state, node->missed);
+    } else {
+      sprintf(line, "%s heartbeat LOST", i == 0 ? "AZM" : "ALT");
+    }
+    if (!node->alive || node->axisError) tft.setTextColor(RED);
+    tft.print(line);
+    tft.setTextColor(textColor);
+  }
+  tft.setFont(&Inconsolata_Bold8pt7b);
+}
+
+// ====== Tuning assistant ======
+// Tune, then Apply once there's a proposal, any press while tuning cancels
+void ODriveScreen::drawTuneButton(int axis, int x, int y, int width) {
+  const char *label = axis == AZM_MOTOR ? "TuneAZ" : "TuneAL";
+  bool active = false;
+  ODriveTuneResult result = oDriveTuner.result(axis);
+  if (oDriveTuner.busy() && oDriveTuner.axis() == axis) { label = "Tuning"; active = true; } else
+  if (result.valid && !result.applied) label = "Apply";
+  odriveButton.draw(x, y, width, OD_ACT_BOXSIZE_Y - box_height_adj, label, active);
+}
+
+bool ODriveScreen::tuneButton(int axis) {
+  tuneShown = true;
+  tuneAxis = axis;
+  if (oDriveTuner.busy()) oDriveTuner.cancel(); else {
+    ODriveTuneResult result = oDriveTuner.result(axis);
+    if (result.valid && !result.applied) oDriveTuner.apply(axis); else oDriveTuner.start(axis);
+  }
+  showTuning(true);
+  display._redrawBut = true;
+  return true;
+}
+
+// the tuning phase and results in the error area, redrawn when the phase changes
+void ODriveScreen::showTuning(bool redrawAll) {
+  ODriveTunePhase phase = oDriveTuner.phase();
+  if (!redrawAll && phase == shownTunePhase) return;
+  shownTunePhase = phase;
+
+  static const char *phases[] = {"Idle", "Holding", "Step", "Returning", "Chirp", "Done", "Failed"};
+  int axis = oDriveTuner.busy() ? oDriveTuner.axis() : tuneAxis;
+  ODriveTuneResult r = oDriveTuner.result(axis);
+  char line[40];
+
+  tft.fillRect(OD_ERR_OFFSET_X, OD_ERR_OFFSET_Y, 197, 15 * OD_ERR_SPACING, pgBackground);
+  tft.setFont(0);
+  int y = OD_ERR_OFFSET_Y;
+  tft.setCursor(OD_ERR_OFFSET_X, y);
+  tft.print(axis == AZM_MOTOR ? "----------AZM Tuning----------" : "----------ALT Tuning----------");
+  y += OD_ERR_SPACING;
+
+  tft.setCursor(OD_ERR_OFFSET_X, y);
+  if (phase == OTP_FAILED) tft.setTextColor(RED);
+  sprintf(line, "%s %s", phases[phase], oDriveTuner.failure());
+  tft.print(line);
+  tft.setTextColor(textColor);
+  y += OD_ERR_SPACING;
+  if (!r.valid) { tft.setFont(&Inconsolata_Bold8pt7b); return; }
+
+  char text[8][40];
+  sprintf(text[0], "J %.5f b %.5f", r.inertia, r.damping);
+  sprintf(text[1], "Fit R2 %.2f", r.fit);
+  sprintf(text[2], "Now:  over %3.0f%% set %4.0fms", r.measuredOvershoot, r.measuredSettling);
+  sprintf(text[3], "pos_gain         %.3f", r.posGain);
+  sprintf(text[4], "vel_gain         %.4f", r.velGain);
+  sprintf(text[5], "vel_int_gain     %.4f", r.velIntGain);
+  sprintf(text[6], "Pred: over %3.0f%% set %4.0fms", r.predictedOvershoot, r.predictedSettling);
+  sprintf(text[7], "%s", r.applied ? "Applied" : "Press Apply to use them");
+  for (int i = 0; i < 8; i++) {
+    tft.setCursor(OD_ERR_OFFSET_X, y);
+    tft.print(text[i]);
+    y += OD_ERR_SPACING;
+  }
+  tft.setFont(&Inconsolata_Bold8pt7b);
+}
+#endif
+
+// ====== Velocity gain Buttons ======
+// area of gain button i of column 3 (AZ Hi, AZ Def, ALT Hi, ALT Def), with CAN they're half
+// width in two rows so the bus health fits below them
+void ODriveScreen::gainButtonArea(int i, int *x, int *y, int *w) {
+  #if ODRIVE_COMM_MODE == OD_CAN
+    *x = OD_ACT_COL_3_X + (i % 2) * (OD_ACT_BOXSIZE_X/2 + 1);
+    *y = OD_GAIN_Y + (i / 2) * (OD_ACT_BOXSIZE_Y - box_height_adj + OD_ACT_Y_SPACING);
+    *w = OD_ACT_BOXSIZE_X/2 - 1;
+  #else
+    *x = OD_ACT_COL_3_X;
+    *y = OD_GAIN_Y + i * (OD_ACT_BOXSIZE_Y - box_height_adj + OD_ACT_Y_SPACING);
+    *w = OD_ACT_BOXSIZE_X;
+  #endif
 }
 
 // ====== Show the Gains ======
@@ -569,76 +710,62 @@ uint8_t ODriveScreen::decodeODriveEncErrors(int axis, uint32_t odErrorCode, int
   return errorCount; // Return the number of detected errors
 }
 
+// an error word the ODrive hasn't answered yet, in place of its decoded errors
+uint8_t ODriveScreen::showNotRead(int y_offset) {
+  tft.setCursor(OD_ERR_OFFSET_X, y_offset);
+  tft.println("NOT_READ_YET");
+  return 1;
+}
+
 // ======== Show the ODRIVE errors ========
-void ODriveScreen::showODriveErrors() {
-  int y_offset = 0;
-  uint8_t err = 0;
-  uint8_t errCnt = 0;
+// only the words that changed since the last snapshot are redrawn, from the first changed one
+// down since the lines below it move
+void ODriveScreen::showODriveErrors(bool redrawAll) {
+  typedef uint8_t (ODriveScreen::*Decoder)(int, uint32_t, int);
+  static const Decoder decoders[4] = {&ODriveScreen::decodeODriveAxisErrors, &ODriveScreen::decodeODriveContErrors,
+                                      &ODriveScreen::decodeODriveMotorErrors, &ODriveScreen::decodeODriveEncErrors};
 
   // **** enum ordering: AXIS=2, CONTROLLER=3, MOTOR=4, ENCODER=5 *****//
-  // 
-  // clear background
-  tft.fillRect(OD_ERR_OFFSET_X, OD_ERR_OFFSET_Y, 197, 15 * OD_ERR_SPACING, pgBackground);
-  tft.setFont(0);
-  
-  // ODrive top level errors
-  tft.setCursor(OD_ERR_OFFSET_X, OD_ERR_OFFSET_Y);
-  tft.println("-------Top Level Errors-------");
-
-  y_offset = OD_ERR_OFFSET_Y + OD_ERR_SPACING;
-  err = oDriveExt.getODriveErrors(-1, Component::NO_COMP); // no axis number since Top Level
-  //sprintf(tempString, "Top Level err=%08lX", err); VL(tempString);
-  errCnt = oDriveScreen.decodeODriveTopErrors(-1, err, y_offset);
+  ODriveErrorSnapshot errors = oDriveExt.getODriveErrorSnapshot(redrawAll);
 
-  // AZM Errors
-  y_offset += (errCnt * OD_ERR_SPACING+3);
+  int first = 0;
+  if (!redrawAll && errorsShown) {
+    while (first < OD_ERR_WORDS && errors.word[first] == shownErrors.word[first] &&
+           (errors.unread & (1 << first)) == (shownErrors.unread & (1 << first))) first++;
+    if (first == OD_ERR_WORDS) return;
+  }
+  shownErrors = errors;
+  errorsShown = true;
 
-  tft.setCursor(OD_ERR_OFFSET_X, y_offset);
-  tft.println("----------AZM Errors----------");
-  
-  y_offset += (OD_ERR_SPACING);
-  err = oDriveExt.getODriveErrors(AZM_MOTOR, AXIS);
-  //sprintf(tempString, "AZM AXIS=%c err=%08lX", AXIS+48, err); VL(tempString);
-  errCnt = oDriveScreen.decodeODriveAxisErrors(AZM_MOTOR, err, y_offset);
-  y_offset += (errCnt * OD_ERR_SPACING);
-
-  err = oDriveExt.getODriveErrors(AZM_MOTOR, CONTROLLER);
-  //sprintf(tempString, "AZM CONTROLLER=%c err=%08lX", CONTROLLER+48, err); VL(tempString);
-  errCnt = oDriveScreen.decodeODriveContErrors(AZM_MOTOR, err, y_offset);
-  y_offset += (errCnt * OD_ERR_SPACING);
-
-  err = oDriveExt.getODriveErrors(AZM_MOTOR, MOTOR);
-  //sprintf(tempString, "AZM MOTOR=%c err=%08lX", MOTOR+48, err); VL(tempString);
-  errCnt = oDriveScreen.decodeODriveMotorErrors(AZM_MOTOR, err, y_offset);
-  y_offset += (errCnt * OD_ERR_SPACING);
-
-  err = oDriveExt.getODriveErrors(AZM_MOTOR, ENCODER);
-  //sprintf(tempString, "AZM ENCODER=%c err=%08lX", ENCODER+48, err); VL(tempString);
-  errCnt = oDriveScreen.decodeODriveEncErrors(AZM_MOTOR, err, y_offset);
-  y_offset += (errCnt * OD_ERR_SPACING+3);
+  // clear background
+  int y_offset = first == 0 ? OD_ERR_OFFSET_Y : errorsY[first];
+  tft.fillRect(OD_ERR_OFFSET_X, y_offset, 197, OD_ERR_OFFSET_Y + 15 * OD_ERR_SPACING - y_offset, pgBackground);
+  tft.setFont(0);
 
-  tft.setCursor(OD_ERR_OFFSET_X, y_offset);
-  tft.println("----------ALT Errors----------");
-
-  y_offset += OD_ERR_SPACING;
-  err = oDriveExt.getODriveErrors(ALT_MOTOR, AXIS);
-  //sprintf(tempString, "ALT AXIS=%c err=%08lX", AXIS+48, err); VL(tempString);
-  errCnt = oDriveScreen.decodeODriveAxisErrors(ALT_MOTOR, err, y_offset);
-  y_offset += (errCnt * OD_ERR_SPACING);
-
-  err = oDriveExt.getODriveErrors(ALT_MOTOR, CONTROLLER);
-  //sprintf(tempString, "ALT CONTROLLER=%c err=%08lX", CONTROLLER+48, err); VL(tempString);
-  errCnt = oDriveScreen.decodeODriveContErrors(ALT_MOTOR, err, y_offset);
-  y_offset += (errCnt * OD_ERR_SPACING);
-
-  err = oDriveExt.getODriveErrors(ALT_MOTOR, MOTOR);
-  //sprintf(tempString, "ALT MOTOR=%c err=%08lX", MOTOR+48, err); VL(tempString);
-  errCnt = oDriveScreen.decodeODriveMotorErrors(AZM_MOTOR, err, y_offset);
-  y_offset += (errCnt * OD_ERR_SPACING);
-
-  err = oDriveExt.getODriveErrors(ALT_MOTOR, ENCODER);
-  //sprintf(tempString, "ALT ENCODER=%c err=%08lX", ENCODER+48, err); VL(tempString);
-  errCnt = oDriveScreen.decodeODriveEncErrors(ALT_MOTOR, err, y_offset);
+  for (int w = first; w < OD_ERR_WORDS; w++) {
+    errorsY[w] = y_offset;
+    uint32_t err = errors.word[w];
+    bool unread = errors.unread & (1 << w);
+
+    if (w == 0) {
+      // ODrive top level errors
+      tft.setCursor(OD_ERR_OFFSET_X, y_offset);
+      tft.println("-------Top Level Errors-------");
+      y_offset += OD_ERR_SPACING;
+      y_offset += (unread ? showNotRead(y_offset) : decodeODriveTopErrors(-1, err, y_offset)) * OD_ERR_SPACING + 3;
+      continue;
+    }
+
+    int component = (w - 1) % 4;
+    int motor = w <= 4 ? AZM_MOTOR : ALT_MOTOR;
+    if (component == 0) {
+      tft.setCursor(OD_ERR_OFFSET_X, y_offset);
+      tft.println(motor == AZM_MOTOR ? "----------AZM Errors----------" : "----------ALT Errors----------");
+      y_offset += OD_ERR_SPACING;
+    }
+    y_offset += (unread ? showNotRead(y_offset) : (this->*decoders[component])(motor, err, y_offset)) * OD_ERR_SPACING;
+    if (component == 3) y_offset += 3;
+  }
 }
 
 bool ODriveScreen::odriveButStateChange() {
@@ -664,6 +791,13 @@ bool ODriveScreen::odriveButStateChange() {
     }
   }
 
+  #if ODRIVE_COMM_MODE == OD_CAN
+    if (buttonTunePhase != oDriveTuner.phase()) {
+      buttonTunePhase = oDriveTuner.phase();
+      changed = true;
+    }
+  #endif
+
   if (display._redrawBut) {
     display._redrawBut = false;
     changed = true;
@@ -714,6 +848,11 @@ void ODriveScreen::updateOdriveButtons() {
 
   y_offset += OD_ACT_BOXSIZE_Y + OD_ACT_Y_SPACING;
   // Clear Errors
+  #if ODRIVE_COMM_MODE == OD_CAN
+  if (tuneShown) {
+    odriveButton.draw(OD_ACT_COL_2_X, OD_ACT_COL_2_Y + y_offset, "Errors<", BUT_OFF);
+  } else
+  #endif
   if (clearODriveErrs) {
     odriveButton.draw(OD_ACT_COL_2_X, OD_ACT_COL_2_Y + y_offset, "Errs Cleared", BUT_ON);
     clearODriveErrs = false;
@@ -723,57 +862,31 @@ void ODriveScreen::updateOdriveButtons() {
   }
 
   // ----- 3rd Column -----
-  y_offset = -160;
-
-  // AZ Gains High
-  if (!oDriveExt.AZgainHigh) {
-    odriveButton.draw(OD_ACT_COL_3_X + x_offset, OD_ACT_COL_3_Y + y_offset,
-                      OD_ACT_BOXSIZE_X, OD_ACT_BOXSIZE_Y - box_height_adj,
-                      "AZ Gain Hi", BUT_OFF);
-  } else {
-    odriveButton.draw(OD_ACT_COL_3_X + x_offset, OD_ACT_COL_3_Y + y_offset,
-                      OD_ACT_BOXSIZE_X, OD_ACT_BOXSIZE_Y - box_height_adj,
-                      "AZ Gain Hi", BUT_ON);
-  }
-
-  // AZ Gains Default
-  y_offset += OD_ACT_BOXSIZE_Y - box_height_adj + OD_ACT_Y_SPACING;
-  if (!oDriveExt.AZgainDefault) {
-    odriveButton.draw(OD_ACT_COL_3_X + x_offset, OD_ACT_COL_3_Y + y_offset,
-                      OD_ACT_BOXSIZE_X, OD_ACT_BOXSIZE_Y - box_height_adj,
-                      "AZ Gain Def", BUT_OFF);
-  } else {
-    odriveButton.draw(OD_ACT_COL_3_X + x_offset, OD_ACT_COL_3_Y + y_offset,
-                      OD_ACT_BOXSIZE_X, OD_ACT_BOXSIZE_Y - box_height_adj,
-                      "AZ Gain Def", BUT_ON);
-  }
-
-  // ALT Velocity Gain High
-  y_offset += OD_ACT_BOXSIZE_Y - box_height_adj + OD_ACT_Y_SPACING;
-  if (!oDriveExt.ALTgainHigh) {
-    odriveButton.draw(OD_ACT_COL_3_X + x_offset, OD_ACT_COL_3_Y + y_offset,
-                      OD_ACT_BOXSIZE_X, OD_ACT_BOXSIZE_Y - box_height_adj,
-                      "ALT Gain Hi", BUT_OFF);
-  } else {
-    odriveButton.draw(OD_ACT_COL_3_X + x_offset, OD_ACT_COL_3_Y + y_offset,
-                      OD_ACT_BOXSIZE_X, OD_ACT_BOXSIZE_Y - box_height_adj,
-                      "ALT Gain Hi", BUT_ON);
-  }
-
-  // ALT Velocity Gain Default
-  y_offset += OD_ACT_BOXSIZE_Y - box_height_adj + OD_ACT_Y_SPACING;
-  if (!oDriveExt.ALTgainDefault) {
-    odriveButton.draw(OD_ACT_COL_3_X + x_offset, OD_ACT_COL_3_Y + y_offset,
-                      OD_ACT_BOXSIZE_X, OD_ACT_BOXSIZE_Y - box_height_adj,
-                      "ALT Gain Def", BUT_OFF);
-  } else {
-    odriveButton.draw(OD_ACT_COL_3_X + x_offset, OD_ACT_COL_3_Y + y_offset,
-                      OD_ACT_BOXSIZE_X, OD_ACT_BOXSIZE_Y - box_height_adj,
-                      "ALT Gain Def", BUT_ON);
+  // Velocity gain Buttons
+  const char *gainLabels[4] = OD_GAIN_LABELS;
+  bool gainOn[4] = {oDriveExt.AZgainHigh, oDriveExt.AZgainDefault, oDriveExt.ALTgainHigh, oDriveExt.ALTgainDefault};
+  for (int i = 0; i < 4; i++) {
+    int x, y, w;
+    gainButtonArea(i, &x, &y, &w);
+    odriveButton.draw(x, y, w, OD_ACT_BOXSIZE_Y - box_height_adj, gainLabels[i], gainOn[i]);
   }
 
   //----------------------------------------
   y_offset = 0;
+  #if ODRIVE_COMM_MODE == OD_CAN
+  // Demo and Tune share the button, on the tuning page it has one Tune button per motor
+  if (tuneShown) {
+    drawTuneButton(AZM_MOTOR, OD_ACT_COL_3_X, OD_ACT_COL_3_Y + y_offset, OD_ACT_BOXSIZE_X/2 - 1);
+    drawTuneButton(ALT_MOTOR, OD_ACT_COL_3_X + OD_ACT_BOXSIZE_X/2 + 1, OD_ACT_COL_3_Y + y_offset, OD_ACT_BOXSIZE_X/2 - 1);
+  } else {
+    odriveButton.draw(OD_ACT_COL_3_X, OD_ACT_COL_3_Y + y_offset,
+                      OD_ACT_BOXSIZE_X/2 - 1, OD_ACT_BOXSIZE_Y - box_height_adj,
+                      "Demo", demoActive);
+    odriveButton.draw(OD_ACT_COL_3_X + OD_ACT_BOXSIZE_X/2 + 1, OD_ACT_COL_3_Y + y_offset,
+                      OD_ACT_BOXSIZE_X/2 - 1, OD_ACT_BOXSIZE_Y - box_height_adj,
+                      "Tune>", BUT_OFF);
+  }
+  #else
   // Demo Button
   if (demoActive) {
     odriveButton.draw(OD_ACT_COL_3_X + x_offset, OD_ACT_COL_3_Y + y_offset,
@@ -784,6 +897,7 @@ void ODriveScreen::updateOdriveButtons() {
                       OD_ACT_BOXSIZE_X, OD_ACT_BOXSIZE_Y - box_height_adj,
                       "Demo ODrive", BUT_OFF);
   }
+  #endif
 
   y_offset += OD_ACT_BOXSIZE_Y + OD_ACT_Y_SPACING;
   // Reset ODrive Button
@@ -811,6 +925,29 @@ void ODriveScreen::updateOdriveButtons() {
   }
 }
 
+// Demo Mode for ODrive
+// Toggle on Demo Mode if button pressed, toggle off if pressed and already on
+// Demo Mode bypasses OnStep control to repeat a sequence of moves
+void ODriveScreen::toggleDemo() {
+  if (!demoActive) {
+    commandBool(":Q#"); // does not turn off Motor power
+    demoActive = true;
+
+    // Start demo task
+    VF("MSG: Setup, Demo Mode (rate 10 sec priority 6)... ");
+    demoHandle = tasks.add(10000, 0, true, 6, demoWrapper, "Demo");
+    if (demoHandle) {
+      VLF("success");
+    } else {
+      VLF("FAILED!");
+    }
+  } else {
+    demoActive = false;
+    VLF("MSG: Demo OFF ODrive");
+    tasks.setDurationComplete(demoHandle);
+  }
+}
+
 // =========== ODrive button update ===========
 bool ODriveScreen::touchPoll(uint16_t px, uint16_t py) {
   int x_offset = 0;
@@ -879,107 +1016,87 @@ bool ODriveScreen::touchPoll(uint16_t px, uint16_t py) {
       py > OD_ACT_COL_2_Y + y_offset &&
       py < OD_ACT_COL_2_Y + y_offset + OD_ACT_BOXSIZE_Y) {
     BEEP;
+    #if ODRIVE_COMM_MODE == OD_CAN
+      // leave the tuning page, the error area goes back to the errors
+      if (tuneShown) {
+        if (!oDriveTuner.busy()) { tuneShown = false; showODriveErrors(true); display._redrawBut = true; }
+        return true;
+      }
+    #endif
     VLF("MSG: Clearing ODrive Errors");
     oDriveExt.clearAllODriveErrors();
     clearODriveErrs = true;
-    showODriveErrors();
+    showODriveErrors(false);
     return true;
   }
 
   // Column 3
-  y_offset = -165;
-  // AZ Gain HIGH
-  if (px > OD_ACT_COL_3_X + x_offset &&
-      px < OD_ACT_COL_3_X + x_offset + OD_ACT_BOXSIZE_X &&
-      py > OD_ACT_COL_3_Y + y_offset &&
-      py < OD_ACT_COL_3_Y + y_offset + OD_ACT_BOXSIZE_Y - box_height_adj) {
-    BEEP;
-    oDriveExt.AZgainHigh = true;
-    oDriveExt.AZgainDefault = false;
-    oDriveExt.setODriveVelGains(AZM_MOTOR, AZM_VEL_GAIN_HI,
-                                AZM_VEL_INT_GAIN_HI); // Set Velocity Gain
-    delay(1); // wait for ODrive to process change
-    showGains();
-    return true;
-  }
-
-  // AZ Gain DEFault
-  y_offset += OD_ACT_BOXSIZE_Y - box_height_adj + OD_ACT_Y_SPACING;
-  if (px > OD_ACT_COL_3_X + x_offset &&
-      px < OD_ACT_COL_3_X + x_offset + OD_ACT_BOXSIZE_X &&
-      py > OD_ACT_COL_3_Y + y_offset &&
-      py < OD_ACT_COL_3_Y + y_offset + OD_ACT_BOXSIZE_Y - box_height_adj) {
-    BEEP;
-    oDriveExt.AZgainHigh = false;
-    oDriveExt.AZgainDefault = true;
-    oDriveExt.setODriveVelGains(AZM_MOTOR, AZM_VEL_GAIN_DEF,
-                                AZM_VEL_INT_GAIN_DEF);
-    delay(1);
-    showGains();
-    return true;
-  }
-
-  // ALT Gain HIGH
-  y_offset += OD_ACT_BOXSIZE_Y - box_height_adj + OD_ACT_Y_SPACING;
-  if (px > OD_ACT_COL_3_X + x_offset &&
-      px < OD_ACT_COL_3_X + x_offset + OD_ACT_BOXSIZE_X &&
-      py > OD_ACT_COL_3_Y + y_offset &&
-      py < OD_ACT_COL_3_Y + y_offset + OD_ACT_BOXSIZE_Y - box_height_adj) {
-    BEEP;
-    oDriveExt.ALTgainHigh = true;
-    oDriveExt.ALTgainDefault = false;
-    oDriveExt.setODriveVelGains(
-        ALT_MOTOR, ALT_VEL_GAIN_HI,
-        ALT_VEL_INT_GAIN_HI); // Set Velocity Gain, Integrator gain
-    delay(1);
-    showGains();
-    return true;
+  // Velocity gain Buttons
+  for (int i = 0; i < 4; i++) {
+    int x, y, w;
+    gainButtonArea(i, &x, &y, &w);
+    if (px > x && px < x + w && py > y && py < y + OD_ACT_BOXSIZE_Y - box_height_adj) {
+      BEEP;
+      switch (i) {
+        case 0: // AZ Gain HIGH
+          oDriveExt.AZgainHigh = true;
+          oDriveExt.AZgainDefault = false;
+          oDriveExt.setODriveVelGains(AZM_MOTOR, AZM_VEL_GAIN_HI,
+                                      AZM_VEL_INT_GAIN_HI); // Set Velocity Gain
+        break;
+        case 1: // AZ Gain DEFault
+          oDriveExt.AZgainHigh = false;
+          oDriveExt.AZgainDefault = true;
+          oDriveExt.setODriveVelGains(AZM_MOTOR, AZM_VEL_GAIN_DEF,
+                                      AZM_VEL_INT_GAIN_DEF);
+        break;
+        case 2: // ALT Gain HIGH
+          oDriveExt.ALTgainHigh = true;
+          oDriveExt.ALTgainDefault = false;
+          oDriveExt.setODriveVelGains(
+              ALT_MOTOR, ALT_VEL_GAIN_HI,
+              ALT_VEL_INT_GAIN_HI); // Set Velocity Gain, Integrator gain
+        break;
+        case 3: // ALT Gain DEFault
+          oDriveExt.ALTgainHigh = false;
+          oDriveExt.ALTgainDefault = true;
+          oDriveExt.setODriveVelGains(ALT_MOTOR, ALT_VEL_GAIN_DEF,
+                                      ALT_VEL_INT_GAIN_DEF);
+        break;
+      }
+      delay(1); // wait for ODrive to process change
+      showGains();
+      return true;
+    }
   }
 
-  // ALT Gain DEFault
-  y_offset += OD_ACT_BOXSIZE_Y - box_height_adj + OD_ACT_Y_SPACING;
+  y_offset = 0;
+  #if ODRIVE_COMM_MODE == OD_CAN
+  // Demo on the left half and Tune on the right, on the tuning page AZM tuning on the left and ALT on the right
   if (px > OD_ACT_COL_3_X + x_offset &&
       px < OD_ACT_COL_3_X + x_offset + OD_ACT_BOXSIZE_X &&
       py > OD_ACT_COL_3_Y + y_offset &&
-      py < OD_ACT_COL_3_Y + y_offset + OD_ACT_BOXSIZE_Y - box_height_adj) {
+      py < OD_ACT_COL_3_Y + y_offset + OD_ACT_BOXSIZE_Y) {
     BEEP;
-    oDriveExt.ALTgainHigh = false;
-    oDriveExt.ALTgainDefault = true;
-    oDriveExt.setODriveVelGains(ALT_MOTOR, ALT_VEL_GAIN_DEF,
-                                ALT_VEL_INT_GAIN_DEF);
-    delay(1);
-    showGains();
+    bool left = px < OD_ACT_COL_3_X + OD_ACT_BOXSIZE_X/2;
+    if (tuneShown) return tuneButton(left ? AZM_MOTOR : ALT_MOTOR);
+    if (left) { toggleDemo(); return true; }
+    tuneShown = true;
+    showTuning(true);
+    display._redrawBut = true;
     return true;
   }
-
-  y_offset = 0;
+  #else
   // Demo Mode for ODrive
-  // Toggle on Demo Mode if button pressed, toggle off if pressed and already on
-  // Demo Mode bypasses OnStep control to repeat a sequence of moves
   if (px > OD_ACT_COL_3_X + x_offset &&
       px < OD_ACT_COL_3_X + x_offset + OD_ACT_BOXSIZE_X &&
       py > OD_ACT_COL_3_Y + y_offset &&
       py < OD_ACT_COL_3_Y + y_offset + OD_ACT_BOXSIZE_Y) {
     BEEP;
-    if (!demoActive) {
-      commandBool(":Q#"); // does not turn off Motor power
-      demoActive = true;
-
-      // Start demo task
-      VF("MSG: Setup, Demo Mode (rate 10 sec priority 6)... ");
-      uint8_t demoHandle = tasks.add(10000, 0, true, 6, demoWrapper, "Demo");
-      if (demoHandle) {
-        VLF("success");
-      } else {
-        VLF("FAILED!");
-      }
-    } else {
-      demoActive = false;
-      VLF("MSG: Demo OFF ODrive");
-      tasks.setDurationComplete(demoHandle);
-    }
+    toggleDemo();
     return true;
   }
+  #endif
 
   y_offset += OD_ACT_BOXSIZE_Y + OD_ACT_Y_SPACING;
   // Reset ODRIVE
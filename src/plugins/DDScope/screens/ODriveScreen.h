@@ -7,6 +7,7 @@
 #include <Arduino.h>
 #include "../display/Display.h"
 #include "../odriveExt/ODriveExt.h"
+#include "../odriveExt/ODriveTuner.h"
 
 class Display;
 
@@ -20,8 +21,17 @@ class ODriveScreen : public Display {
     
     
   private:
-    void showODriveErrors();
+    void showODriveErrors(bool redrawAll);
     void showGains();
+    void gainButtonArea(int i, int *x, int *y, int *w);
+    #if ODRIVE_COMM_MODE == OD_CAN
+    void showCanHealth();
+    void showTuning(bool redrawAll);
+    void drawTuneButton(int axis, int x, int y, int width);
+    bool tuneButton(int axis);
+    #endif
+    void toggleDemo();
+    uint8_t showNotRead(int y_offset);
     uint8_t decodeODriveTopErrors(int axis, uint32_t errorCode, int y_offset);
     uint8_t decodeODriveAxisErrors(int axis, uint32_t errorCode, int y_offset);
     uint8_t decodeODriveMotorErrors(int axis, uint32_t errorCode, int y_offset);
@@ -39,6 +49,17 @@ class ODriveScreen : public Display {
     int preAzmState       = 0;
     int preAltState       = 0;
     int demoHandle;
+
+    ODriveErrorSnapshot shownErrors;
+    bool errorsShown = false;
+    int errorsY[OD_ERR_WORDS];     // where each error word's lines start
+
+    #if ODRIVE_COMM_MODE == OD_CAN
+    bool tuneShown = false;        // the tuning page, its results have the error area
+    int tuneAxis = AZM_MOTOR;
+    uint8_t shownTunePhase = 0;
+    uint8_t buttonTunePhase = 0;
+    #endif
 };
 
 extern ODriveScreen oDriveScreen;
@@ -11,6 +11,8 @@
 #include "MoreScreen.h"
 #include "../catalog/Catalog.h"
 #include "../catalog/CatalogTypes.h"
+#include "../catalog/CustomStore.h"
+#include "../catalog/SkyContext.h"
 #include "../fonts/Inconsolata_Bold8pt7b.h"
 #include "src/lib/tasks/OnTask.h"
 #include "src/telescope/mount/Mount.h"
@@ -104,21 +106,24 @@ void SHCCatScreen::init(uint8_t catSelected) {
   shcPrevRowIndex = cat_mgr.getIndex();
   cat_mgr.select(catSelected);
   cat_mgr.setIndex(0);                     // initialize row index for entire catalog array at zero
-  strcpy(prefix, cat_mgr.catalogPrefix()); // prefix for catalog e.g. Star, M, N, I etc
+  strlcpy(prefix, cat_mgr.catalogPrefix(), sizeof(prefix)); // prefix for catalog e.g. Star, M, N, I etc
+
+  // Herschel, NGC and IC objects have few names, the catalogs are known by prefix since the table order varies with CATALOGS_ON_SD
+  _ngcIcNumbered = !strcmp(prefix, "N") || !strcmp(prefix, "I");
 
   // Show Page Title
-  strcpy(title, cat_mgr.catalogTitle());
-  if (catSelected == HERSCHEL)
+  strlcpy(title, cat_mgr.catalogTitle(), sizeof(title));
+  if (!strcmp(title, "Herschel400"))
     strcpy(title, "Herschel");
   else // shorten title
-    if (catSelected == STARS)
+    if (!strcmp(title, "Bright Stars"))
       strcpy(title, "  Stars"); // shorten title
   drawTitle(110, TITLE_TEXT_Y, title);
 
   // Sub title
   tft.setFont(0); // revert to basic Arial font
   tft.setCursor(9, 25);
-  strcpy(title, cat_mgr.catalogSubMenu());
+  strlcpy(title, cat_mgr.catalogSubMenu(), sizeof(title));
   tft.print(title);
 
   // show number of catalog entries and active filter
@@ -175,6 +180,7 @@ void SHCCatScreen::drawShcCat() {
   tft.setCursor(6, 25);
   tft.print(activeFilterStr[moreScreen.activeFilter]);
 
+  skyContext.update(); // same LST and refraction for every row on the page
   cat_mgr.setIndex(shcPagingArrayIndex[shcCurrentPage]); // array of page 1st row indexes
   if (cat_mgr.hasActiveFilter()) {
     shcLastPage = shcPrevRowIndex >= cat_mgr.getIndex();
@@ -201,7 +207,7 @@ void SHCCatScreen::drawShcCat() {
 
     // fill the button with some identifying text which varies depending on catalog chosen
     memset(shcObjName[shcRow], '\0', OBJNAME_LENGTH);                    // NULL out row first
-    if (_catSelected == HERSCHEL || _catSelected == INDEX) { // use prefix and primaryId for these 2 catalogs
+    if (_ngcIcNumbered) { // use prefix and primaryId for these catalogs
       snprintf(shcObjName[shcRow], sizeof(shcObjName[shcRow]), "%2s%4ld", prefix, cat_mgr.primaryId());
       // VF("priId="); VL(cat_mgr.primaryId());
     } else if (cat_mgr.objectName() != -1) { // does it have a name
@@ -257,12 +263,8 @@ void SHCCatScreen::drawShcCat() {
     // shcRACustLine is used by the "Save to custom" catalog feature
     snprintf(shcRACustLine[shcRow], 12, "%02u:%02u:%02u", (uint8_t)*shcRaHrs[shcRow], (uint8_t)*shcRaMin[shcRow], (uint8_t)*shcRaSec[shcRow]);
 
-    // Create a temporary buffer to avoid overlap
-    char temp[10];
-    strncpy(temp, shcRACustLine[shcRow], 9);
-
     // Written to the controller for GoTo coordinates
-    snprintf(shcRaSrCmd[shcRow], 14, ":Sr%s#", temp);
+    shcRaTarget[shcRow] = cat_mgr.rah();
 
     // fill the DEC array for this Row on the current page
     // DEC in Deg:Min:Sec
@@ -277,12 +279,7 @@ void SHCCatScreen::drawShcCat() {
     //Serial.printf("RA=%f, Dec=%f\n", cat_mgr.ra(), cat_mgr.dec());
     //Serial.printf("Alt=%f, Azm=%f\n", shcAlt[shcRow], shcAzm[shcRow]);
 
-    // avoid possible overlapping regions
-    char bufTemp[12];
-    strncpy(bufTemp, shcDECCustLine[shcRow], sizeof(bufTemp) - 1);
-    bufTemp[sizeof(bufTemp) - 1] = '\0';
-    snprintf(shcDecSrCmd[shcRow], 16, ":Sd%s#", bufTemp);
-    // snprintf(shcDecSrCmd[shcRow], 16, ":Sd%s#", shcDECCustLine[shcRow]); // written to the controller for GoTo coordinates
+    shcDecTarget[shcRow] = cat_mgr.dec(); // written to the controller for GoTo coordinates
 
     shcPrevRowIndex = cat_mgr.getIndex();
     shcRow++;           // increments through the number of lines on screen
@@ -415,13 +412,11 @@ void SHCCatScreen::saveSHC() {
            shcSubId[curSelSIndex],
            shcRACustLine[curSelSIndex],
            shcDECCustLine[curSelSIndex]);
-  // write string to the SD card
-  File wrFile = SD.open("custom.csv", FILE_WRITE);
-  if (wrFile) {
-    wrFile.print(shcCustWrSD);
+  // append to the custom catalog journal on the SD card
+  if (!customStore.add(shcCustWrSD)) {
+    canvShcInsPrint.printRJ(STATUS_STR_X, STATUS_STR_Y, STATUS_STR_W,
+      STATUS_STR_H, "SD open ERROR", true);
   }
-  // VF("size="); VL(wrFile.size());
-  wrFile.close();
 }
 
 // =============== check the Catalog Buttons if pressed ================
@@ -502,11 +497,7 @@ bool SHCCatScreen::touchPoll(uint16_t px, uint16_t py) {
 
 // ======= write Target Coordinates to controller =========
 void SHCCatScreen::writeSHCTarget(uint16_t index) {
-  //: Sr[HH:MM.T]# or :Sr[HH:MM:SS]#
-  commandBool(shcRaSrCmd[index]);
-
-  //: Sd[sDD*MM]# or :Sd[sDD*MM:SS]#
-  commandBool(shcDecSrCmd[index]);
+  mountApi.setTarget(shcRaTarget[index], shcDecTarget[index]);
   objSel = true;
 }
 
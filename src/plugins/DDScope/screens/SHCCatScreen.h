@@ -6,6 +6,7 @@
 
 #include <Arduino.h>
 #include "CatalogDefs.h"
+#include "../catalog/Catalog.h"
 
 class Display;
 
@@ -38,6 +39,7 @@ class SHCCatScreen : public Display {
     
     // === Catalog selection & paging ===
     uint8_t  _catSelected;
+    bool     _ngcIcNumbered = false; // objects are listed by prefix and NGC/IC number
     uint16_t catButSelPos = 0;
     uint16_t shcCurrentPage;
     uint16_t returnToPage;
@@ -54,7 +56,7 @@ class SHCCatScreen : public Display {
 
     char herschObjName[7];
     char prefix[5];
-    char title[14];
+    char title[CAT_TITLE_SIZE];
     char shcCustWrSD[SD_CARD_LINE_LENGTH];
 
     // Smart Hand Controller (4) Catalogs
@@ -67,8 +69,8 @@ class SHCCatScreen : public Display {
     char     objTypeStr[NUM_CAT_ROWS_PER_SCREEN][OBJTYPE_LENGTH]; 
     char  shcRACustLine[NUM_CAT_ROWS_PER_SCREEN][RA_LENGTH]; 
     char shcDECCustLine[NUM_CAT_ROWS_PER_SCREEN][DEC_LENGTH]; 
-    char     shcRaSrCmd[NUM_CAT_ROWS_PER_SCREEN][17]; // has ":Sr...#" cmd channel chars
-    char    shcDecSrCmd[NUM_CAT_ROWS_PER_SCREEN][18]; // has ":Sd...#" cmd channel chars
+    double   shcRaTarget[NUM_CAT_ROWS_PER_SCREEN]; // goto target RA, hours
+    double  shcDecTarget[NUM_CAT_ROWS_PER_SCREEN]; // goto target Dec, degrees
 
     uint8_t    shcRaHrs[NUM_CAT_ROWS_PER_SCREEN][3]; 
     uint8_t    shcRaMin[NUM_CAT_ROWS_PER_SCREEN][3];
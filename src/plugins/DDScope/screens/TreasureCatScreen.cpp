@@ -11,6 +11,8 @@
 #include "TreasureCatScreen.h"
 #include "../catalog/Catalog.h"
 #include "../catalog/CatalogTypes.h"
+#include "../catalog/CsvIndex.h"
+#include "../catalog/CustomStore.h"
 #include "../fonts/Inconsolata_Bold8pt7b.h"
 #include "src/telescope/mount/Mount.h"
 #include "src/telescope/mount/goto/Goto.h"
@@ -82,8 +84,6 @@ void TreasureCatScreen::init() {
   drawTitle(110, TITLE_TEXT_Y, "Treasure");
   if (!loadTreasureArray()) {
       canvTreasureInsPrint.printRJ(STATUS_STR_X, STATUS_STR_Y, STATUS_STR_W, STATUS_STR_H, "ERR:Loading Treasure", false);
-  } else { 
-      parseTcatIntoArray();
   }
   
   drawTreasureCat(); // draw first page of the selected catalog
@@ -97,39 +97,6 @@ void TreasureCatScreen::init() {
   updateTreasureButtons(); 
 }
 
-bool TreasureCatScreen::loadTreasureArray() {
-  //============== Begin Load from File ==========================
-  // Load RAM array from SD catalog file
-  char rdChar;
-  char rowString[SD_CARD_LINE_LEN]=""; // temp row buffer
-  int rowNum=0;
-  int charNum=0;
-  File rdFile = SD.open("mod1_treasure.csv");
-
-  if (rdFile) {
-    // load data from SD into array
-    while (rdFile.available()) {
-      rdChar = rdFile.read();
-      rowString[charNum] = rdChar;
-      charNum++;
-      
-      if (rdChar == '\n') {
-        strcpy(Treasure_Array[rowNum], rowString);
-        rowNum++;
-        memset(&rowString, 0, SD_CARD_LINE_LEN);
-        charNum = 0;
-      }
-    }
-    treRowEntries = rowNum-1;
-    //VF("treEntries="); VL(treRowEntries);
-  } else {
-    VLF("SD Treas read error");
-    return false;
-  }
-  rdFile.close();
-  return true;
-}
-
 // The parsing of the mod1_treasure.csv file is based on these first few lines
 // as an example.
 // NGC189 ;00h39.6m;+61d06m;Cari;Open Clus; 8.8;5m       ;Caroline Herschel
@@ -139,7 +106,6 @@ bool TreasureCatScreen::loadTreasureArray() {
 // NGC404 ;01h09.4m;+35d43m;Andr;Galaxy   ; 9.8;6.6m     ;Mirachms Ghost   
 // NGC584 ;01h31.3m;-06d52m;Ceph;Galaxy   ;10.4;3.8m-2.4m;Little Spindle   
 //
-// Parse the treasure.csv line data into individual fields in an array
 // mod1_treasure.csv file format = ObjName;RAhRAm;SignDECdDECm;Cons;ObjType;Mag;Size;SubId\n
 // mod1_treasure.csv field spacing: 7;8;7;4;9;4;9;18 = 66 total w/out semicolons, 73 with
 // 7 - objName
@@ -150,17 +116,40 @@ bool TreasureCatScreen::loadTreasureArray() {
 // 4 - Mag
 // 9 - Size
 //18 - SubId
-void TreasureCatScreen::parseTcatIntoArray() {
-  for (int i=0; i<MAX_TREASURE_ROWS; i++) {
-    tArray[i].tObjName      = strtok(Treasure_Array[i], ";"); //VL(tArray[i].tObjName);
-    tArray[i].tRAhRAm       = strtok(NULL, ";");              //VL(tArray[i].tRAhRAm);
-    tArray[i].tsDECdDECm    = strtok(NULL, ";");              //VL(tArray[i].tsDECdDECm);
-    tArray[i].tCons         = strtok(NULL, ";");              //VL(tArray[i].tCons);
-    tArray[i].tObjType      = strtok(NULL, ";");              //VL(tArray[i].tObjType);
-    tArray[i].tMag          = strtok(NULL, ";");              //VL(tArray[i].tMag);
-    tArray[i].tSize         = strtok(NULL, ";");              //VL(tArray[i].tSize);
-    tArray[i].tSubId        = strtok(NULL, "\r");             //VL(tArray[i].tSubId);
+//
+// RA/DEC/Mag fields are converted to numbers once when mod1_treasure.idx is built
+static bool parseTreasureRow(char **field, csv_idx_rec_t *rec) {
+  char *raM  = strchr(field[TF_RA], 'h');
+  char *decM = strchr(field[TF_DEC], 'd');
+  if (raM == NULL || decM == NULL) return false;
+  rec->RA = atof(field[TF_RA]) + atof(raM+1)/60.0;
+
+  // sign from the text so -00d30m stays south
+  const char *decD = field[TF_DEC];
+  while (*decD == ' ') decD++;
+  double dec = fabs(atof(decD)) + atof(decM+1)/60.0;
+  rec->DE = (*decD == '-') ? -dec : dec;
+
+  char *_end;
+  double mag = strtod(field[TF_MAG], &_end);
+  if (_end != field[TF_MAG]) rec->Mag = mag;
+  return true;
+}
+
+EXTMEM uint8_t treasureIdxBuf[CSV_IDX_BUF_SIZE(MAX_TREASURE_ROWS)];
+CsvIndex treasureIdx("mod1_treasure.csv", "mod1_treasure.idx", TF_COUNT, parseTreasureRow,
+                     treasureIdxBuf, sizeof(treasureIdxBuf), MAX_TREASURE_ROWS);
+
+// Load the rows from the binary index, rebuilt from the CSV only when it has changed
+bool TreasureCatScreen::loadTreasureArray() {
+  if (!treasureIdx.load()) {
+    VLF("SD Treas read error");
+    treRowEntries = 0;
+    return false;
   }
+  treRowEntries = treasureIdx.count();
+  //VF("treEntries="); VL(treRowEntries);
+  return true;
 }
 
 // ========== draw TREASURE page of catalog data ========
@@ -172,8 +161,8 @@ void TreasureCatScreen::drawTreasureCat() {
   char catLine[47]=""; //hold the string that is displayed beside the button on each page
   
   tAbsRow = (tPagingArrayIndex[tCurrentPage]); // array of page 1st row indexes
-  tLastPage = ((MAX_TREASURE_ROWS / NUM_CAT_ROWS_PER_SCREEN)+1);
-  tNumRowsLastPage = MAX_TREASURE_ROWS % NUM_CAT_ROWS_PER_SCREEN;
+  tLastPage = ((treRowEntries / NUM_CAT_ROWS_PER_SCREEN)+1);
+  tNumRowsLastPage = treRowEntries % NUM_CAT_ROWS_PER_SCREEN;
   if (tCurrentPage+1 == tLastPage) isLastPage = tNumRowsLastPage <= NUM_CAT_ROWS_PER_SCREEN; else isLastPage = false;
 
   // Show Page number and total Pages
@@ -192,50 +181,11 @@ void TreasureCatScreen::drawTreasureCat() {
   tft.print(activeFilterStr[moreScreen.activeFilter]);
   
   // TO DO: add code for case when filter enabled and screen contains fewer than NUM_CAT_ROWS_PER_SCREEN
-  while ((tRow < NUM_CAT_ROWS_PER_SCREEN) && (tAbsRow != MAX_TREASURE_ROWS)) {  
-    // ======== convert RA/DEC ===========
-    char  *_end;
-    char  *nextStr;
-    double raH  = 0.0;
-    int    raM  = 0;
-    int    raS  = 0;
-    double decD = 0.0;
-    int    decM = 0;
-    int    decS = 0;
-    double tRAdouble;
-    double tDECdouble;
-
-    // Format RA in Hrs:Min:Sec and form string to be sent as target
-    raH = strtod(tArray[tAbsRow].tRAhRAm, &_end); // convert first hour chars
-    nextStr = strchr(tArray[tAbsRow].tRAhRAm,'h'); // get ptr to minute chars
-    if (nextStr != NULL) {
-      raM = atoi(nextStr+1);
-    } else {
-      VLF("found RA==NULL in treasure");
-    }
-    snprintf(tRAhhmmss[tAbsRow], 9, "%02d:%02d:00", (int)raH, raM);
-    snprintf(tRaSrCmd[tAbsRow], 13, ":Sr%02d:%02d:%02d#", (int)raH, raM, raS); //Note: this is in HOURS
-
-    // Format DEC in Deg:Min:Sec and form string to be sent as target
-    decD = strtod(tArray[tAbsRow].tsDECdDECm, &_end);
-    nextStr = strchr(tArray[tAbsRow].tsDECdDECm, 'd');
-    if (nextStr != NULL) {
-      decM = atoi(nextStr+1);
-    } else {
-      VLF("found DEC==NULL in treasure");
-    }
-    snprintf(tDECsddmmss[tAbsRow], 10, "%+03d*%02d:00", (int)decD, decM);
-    snprintf(tDecSrCmd[tAbsRow], 14, ":Sd%+03d*%02d:%02d#", (int)decD, decM, decS);
-    
-    // to get Altitude, first convert RAh and DEC to double
-    // Note: PM_HIGH is required for the format used here
-    convert.hmsToDouble(&tRAdouble, tRAhhmmss[tAbsRow], PM_HIGH);
-    convert.dmsToDouble(&tDECdouble, tDECsddmmss[tAbsRow], true, PM_HIGH);
-
+  while ((tRow < NUM_CAT_ROWS_PER_SCREEN) && (tAbsRow < treRowEntries)) {  
     // dtAlt[tAbsRow] is used by filter to check if above Horizon
     Coordinate treTarget;
-    treTarget.r = hrsToRad(tRAdouble);
-    treTarget.d = degToRad(tDECdouble);
+    treTarget.r = hrsToRad(treasureIdx.ra(tAbsRow));
+    treTarget.d = degToRad(treasureIdx.dec(tAbsRow));
     transform.rightAscensionToHourAngle(&treTarget, true);
     transform.equToAlt(&treTarget);
     transform.equToHor(&treTarget);
@@ -250,7 +200,7 @@ void TreasureCatScreen::drawTreasureCat() {
       tft.fillRect(CAT_X+CAT_W+5, CAT_Y+tRow*(CAT_H+CAT_Y_SPACING), 197, 17,  butBackground);
 
       // get object names and put them on the buttons
-      treasureDefButton.drawLJ(CAT_X, CAT_Y+tRow*(CAT_H+CAT_Y_SPACING), CAT_W, CAT_H, tArray[tAbsRow].tSubId, BUT_OFF);
+      treasureDefButton.drawLJ(CAT_X, CAT_Y+tRow*(CAT_H+CAT_Y_SPACING), CAT_W, CAT_H, treasureIdx.field(tAbsRow, TF_SUBID), BUT_OFF);
                   
       // format and print the text field for this row next to the button
       // FYI: mod1_treasure.csv file field order and spacing: 7;8;7;4;9;4;9;18 = 66 total w/out semicolons, 73 with ;'s
@@ -265,10 +215,10 @@ void TreasureCatScreen::drawTreasureCat() {
       //18 - SubId
       // select some Treasure fields to show beside button
       snprintf(catLine, sizeof(catLine), "%-4s |%-4s |%-9s |%-18s",  //35 + 6 + NULL = 42
-                                          tArray[tAbsRow].tMag, 
-                                          tArray[tAbsRow].tCons, 
-                                          tArray[tAbsRow].tObjType, 
-                                          tArray[tAbsRow].tObjName);
+                                          treasureIdx.field(tAbsRow, TF_MAG), 
+                                          treasureIdx.field(tAbsRow, TF_CONS), 
+                                          treasureIdx.field(tAbsRow, TF_OBJTYPE), 
+                                          treasureIdx.field(tAbsRow, TF_OBJNAME));
       tft.setCursor(CAT_X+CAT_W+SUB_STR_X_OFF, CAT_Y+tRow*(CAT_H+CAT_Y_SPACING)+FONT_Y_OFF); 
       tft.print(catLine);
       tFiltArray[tRow] = tAbsRow;
@@ -280,7 +230,7 @@ void TreasureCatScreen::drawTreasureCat() {
     tAbsRow++; // increments through all lines in the catalog
     
     // stop printing data if last row on the last page
-    if (tAbsRow == MAX_TREASURE_ROWS) {
+    if (tAbsRow >= treRowEntries) {
       tEndOfList = true; 
       if (tRow == 0) {canvTreasureInsPrint.printRJ(STATUS_STR_X, STATUS_STR_Y, STATUS_STR_W, STATUS_STR_H, "None above 10 deg", false);}
       return; 
@@ -342,19 +292,19 @@ void TreasureCatScreen::updateScreen() {
   // Toggle off previous selected button and toggle on current selected button
   if (tPrevPage == tCurrentPage) { //erase previous selection
     treasureDefButton.drawLJ(CAT_X, CAT_Y+pre_tRelIndex*(CAT_H+CAT_Y_SPACING), 
-      CAT_W, CAT_H, tArray[pre_tAbsIndex].tSubId, BUT_OFF); 
+      CAT_W, CAT_H, treasureIdx.field(pre_tAbsIndex, TF_SUBID), BUT_OFF); 
   }
   // highlight selected by settting background ON color 
   treasureDefButton.drawLJ(CAT_X, CAT_Y+tRelIndex*(CAT_H+CAT_Y_SPACING), 
-      CAT_W, CAT_H, tArray[tAbsIndex].tSubId, BUT_ON); 
+      CAT_W, CAT_H, treasureIdx.field(tAbsIndex, TF_SUBID), BUT_ON); 
   
   // the following 5 lines are displayed on the Catalog/More page
   // Note: ObjName and SubId are swapped here relative to other catalogs since the Treasure catalog is formatted differently
-  snprintf(moreScreen.catSelectionStr1, 26, "Name:%-18s", tArray[tAbsIndex].tSubId);   //VF("t_subID=");   VL(tArray[tAbsIndex].tSubId);
-  snprintf(moreScreen.catSelectionStr2, 26, "Mag-:%-4s",  tArray[tAbsIndex].tMag);     //VF("t_mag=");     VL(tArray[tAbsIndex].tMag);
-  snprintf(moreScreen.catSelectionStr3, 26, "Cons:%-4s",  tArray[tAbsIndex].tCons);    //VF("t_constel="); VL(tArray[tAbsIndex].tCons);
-  snprintf(moreScreen.catSelectionStr4, 26, "Type:%-9s",  tArray[tAbsIndex].tObjType); //VF("t_objType="); VL(tArray[tAbsIndex].tObjType);
-  snprintf(moreScreen.catSelectionStr5, 26, "Id--:%-7s",  tArray[tAbsIndex].tObjName); //VF("t_objName="); VL(tArray[tAbsIndex].tObjName);
+  snprintf(moreScreen.catSelectionStr1, 26, "Name:%-18s", treasureIdx.field(tAbsIndex, TF_SUBID));   //VF("t_subID=");   VL(treasureIdx.field(tAbsIndex, TF_SUBID));
+  snprintf(moreScreen.catSelectionStr2, 26, "Mag-:%-4s",  treasureIdx.field(tAbsIndex, TF_MAG));     //VF("t_mag=");     VL(treasureIdx.field(tAbsIndex, TF_MAG));
+  snprintf(moreScreen.catSelectionStr3, 26, "Cons:%-4s",  treasureIdx.field(tAbsIndex, TF_CONS));    //VF("t_constel="); VL(treasureIdx.field(tAbsIndex, TF_CONS));
+  snprintf(moreScreen.catSelectionStr4, 26, "Type:%-9s",  treasureIdx.field(tAbsIndex, TF_OBJTYPE)); //VF("t_objType="); VL(treasureIdx.field(tAbsIndex, TF_OBJTYPE));
+  snprintf(moreScreen.catSelectionStr5, 26, "Id--:%-7s",  treasureIdx.field(tAbsIndex, TF_OBJNAME)); //VF("t_objName="); VL(treasureIdx.field(tAbsIndex, TF_OBJNAME));
   
   // show if we are above and below visible limits
   tft.setFont(&Inconsolata_Bold8pt7b); 
@@ -377,26 +327,23 @@ void TreasureCatScreen::updateScreen() {
 // Save selected object data to custom catalog
 void TreasureCatScreen::saveTreasure() {
 // Custom Catalog Format: SubID or ObjName, Mag, Cons, ObjType, ObjName or SubID, RA, DEC
+  char raHMS[12], decDMS[12];
+  convert.doubleToHms(raHMS, treasureIdx.ra(curSelTIndex), false, PM_HIGH);
+  convert.doubleToDms(decDMS, treasureIdx.dec(curSelTIndex), false, true, PM_HIGH);
   snprintf(treaCustWrSD, sizeof(treaCustWrSD), "%-18s;%-4s;%-4s;%-14s;%-7s;%8s;%9s\n", 
-                                                  tArray[curSelTIndex].tSubId,
-                                                  tArray[curSelTIndex].tMag, 
-                                                  tArray[curSelTIndex].tCons, 
-                                                  tArray[curSelTIndex].tObjType,
-                                                  tArray[curSelTIndex].tObjName, 
-                                                  tRAhhmmss[curSelTIndex],
-                                                  tDECsddmmss[curSelTIndex]);
-  // write string to the SD card
-  File wrFile = SD.open("custom.csv", FILE_WRITE);
-  if (wrFile) {
-    wrFile.print(treaCustWrSD);
-    } else {
-      canvTreasureInsPrint.printRJ(STATUS_STR_X, STATUS_STR_Y, STATUS_STR_W,
-        STATUS_STR_H, "SD open ERROR", true);
-      return;
-    }
-    //VF("twrFileSize="); VL(wrFile.size());
-  wrFile.close();
+                                                  treasureIdx.field(curSelTIndex, TF_SUBID),
+                                                  treasureIdx.field(curSelTIndex, TF_MAG), 
+                                                  treasureIdx.field(curSelTIndex, TF_CONS), 
+                                                  treasureIdx.field(curSelTIndex, TF_OBJTYPE),
+                                                  treasureIdx.field(curSelTIndex, TF_OBJNAME), 
+                                                  raHMS,
+                                                  decDMS);
+  // append to the custom catalog journal on the SD card
+  if (!customStore.add(treaCustWrSD)) {
+    canvTreasureInsPrint.printRJ(STATUS_STR_X, STATUS_STR_Y, STATUS_STR_W,
+      STATUS_STR_H, "SD open ERROR", true);
   }
+}
 
 //=====================================================
 // **** Handle any buttons that have been pressed *****
@@ -408,7 +355,7 @@ bool TreasureCatScreen::touchPoll(uint16_t px, uint16_t py) {
     if (py > CAT_Y+(i*(CAT_H+CAT_Y_SPACING)) && py < (CAT_Y+(i*(CAT_H+CAT_Y_SPACING))) + CAT_H 
           && px > CAT_X && px < (CAT_X+CAT_W)) {
       BEEP;
-      if (tAbsRow <= 1 || (tAbsRow > MAX_TREASURE_ROWS+1)) return false; 
+      if (tAbsRow <= 1 || (tAbsRow > treRowEntries+1)) return false; 
       catButSelPos = i;
       trCatButDetected = true;
       return true;
@@ -463,11 +410,7 @@ bool TreasureCatScreen::touchPoll(uint16_t px, uint16_t py) {
 
 // ======= write Target Coordinates to controller =========
 void TreasureCatScreen::writeTreasureTarget(uint16_t index) {
-  //:Sr[HH:MM.T]# or :Sr[HH:MM:SS]# 
-  commandBool(tRaSrCmd[index]);
- 
-  //:Sd[sDD*MM]# or :Sd[sDD*MM:SS]#
-  commandBool(tDecSrCmd[index]);
+  mountApi.setTarget(treasureIdx.ra(index), treasureIdx.dec(index)); //Note: RA is in HOURS
   objSel = true;
 }
 
@@ -508,10 +451,10 @@ void TreasureCatScreen::showTargetCoords() {
 
   // Using the values stored in master array during drawCustomCat()
   // RA and DEC settings
-  sprintf(_reply, "RA : %s", tArray[tAbsIndex].tRAhRAm);
+  sprintf(_reply, "RA : %s", treasureIdx.field(tAbsIndex, TF_RA));
   //sprintf(_reply, "RA: %6.1f", cusTarget[cAbsIndex].r);
   canvTreasureDefPrint.printRJ(radec_x, ra_y, width, height, _reply, false);
-  sprintf(_reply, "DEC: %s", tArray[tAbsIndex].tsDECdDECm);
+  sprintf(_reply, "DEC: %s", treasureIdx.field(tAbsIndex, TF_DEC));
   //sprintf(_reply, "DEC: %6.1f", cusTarget[cAbsIndex].d);
   canvTreasureDefPrint.printRJ(radec_x, dec_y, width, height, _reply, false);
   
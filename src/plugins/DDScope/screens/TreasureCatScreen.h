@@ -10,8 +10,11 @@ class Display;
 
 #define NUM_CAT_ROWS_PER_SCREEN 16 //(370/CAT_H+CAT_Y_SPACING)
 #define SD_CARD_LINE_LEN       110 // Length of line stored to SD card for Custom Catalog
-#define MAX_TREASURE_PAGES       8 // more than needed with current settings
-#define MAX_TREASURE_ROWS      129 // full number of rows in catlog; starts with 1, not 0
+#define MAX_TREASURE_ROWS      512 // most rows read from mod1_treasure.csv
+#define MAX_TREASURE_PAGES     ((MAX_TREASURE_ROWS / NUM_CAT_ROWS_PER_SCREEN) + 2)
+
+// mod1_treasure.csv fields
+enum TreasureField {TF_OBJNAME, TF_RA, TF_DEC, TF_CONS, TF_OBJTYPE, TF_MAG, TF_SIZE, TF_SUBID, TF_COUNT};
 
 //====== Treasure Screen Class =========================
 class TreasureCatScreen : public Display {
@@ -23,20 +26,8 @@ class TreasureCatScreen : public Display {
     void updateTreasureStatus();
 
   private:  
-    typedef struct {
-      char* tObjName;
-      char* tRAhRAm;
-      char* tsDECdDECm;
-      char* tCons;
-      char* tObjType;
-      char* tMag;
-      char* tSize;
-      char* tSubId;
-    } treasure_t; 
-
     void updateScreen();
     bool loadTreasureArray();
-    void parseTcatIntoArray();
     void drawTreasureCat();
     void saveTreasure();
     void writeTreasureTarget(uint16_t index);
@@ -49,13 +40,7 @@ class TreasureCatScreen : public Display {
     bool isLastPage = false;
 
     // ======== Arrays ==========
-    char       tRaSrCmd[MAX_TREASURE_ROWS][13]; 
-    char      tDecSrCmd[MAX_TREASURE_ROWS][14];
-    char      tRAhhmmss[MAX_TREASURE_ROWS][9];
-    char    tDECsddmmss[MAX_TREASURE_ROWS][10];
-    char Treasure_Array[MAX_TREASURE_ROWS][SD_CARD_LINE_LEN];
-    uint16_t tFiltArray[MAX_TREASURE_ROWS];
-    treasure_t  tArray[MAX_TREASURE_ROWS];
+    uint16_t tFiltArray[NUM_CAT_ROWS_PER_SCREEN];
     double        dtAlt[MAX_TREASURE_ROWS];
     double        dtAzm[MAX_TREASURE_ROWS];
     uint16_t tPagingArrayIndex[MAX_TREASURE_PAGES];
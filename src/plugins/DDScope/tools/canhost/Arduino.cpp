@@ -0,0 +1,33 @@
+// =====================================================
+// Arduino.cpp
+//
+// Host stand-in for the Arduino timing and interrupt calls.
+
+// the firmware build compiles everything under src/, this is for the host only
+#ifdef CAN_HOST
+
+#include "Arduino.h"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+static const std::chrono::steady_clock::time_point boot = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - boot).count();
+}
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - boot).count();
+}
+
+void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+// held by the receive thread while it runs the handler, and between noInterrupts() and interrupts()
+std::mutex interruptLock;
+
+void noInterrupts() { interruptLock.lock(); }
+void interrupts() { interruptLock.unlock(); }
+
+#endif
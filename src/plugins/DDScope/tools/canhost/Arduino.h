@@ -0,0 +1,33 @@
+// =====================================================
+// Arduino.h
+//
+// Host stand-in for the few Arduino calls ODriveTeensyCAN uses, see odriveCanTest.py.
+// The receive "interrupt" is a thread (FlexCAN_T4.h), noInterrupts()/interrupts() lock
+// it out the way they do on the Teensy.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+typedef uint8_t byte;
+using std::min;
+using std::max;
+
+// ms and us since the program started, like since boot
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+void noInterrupts();
+void interrupts();
+
+// only named by ODriveTeensyCAN.cpp's stream operator, nothing prints through it
+class Print {
+  public:
+    template<class T> void print(T) { }
+    template<class T> void print(T, int) { }
+};
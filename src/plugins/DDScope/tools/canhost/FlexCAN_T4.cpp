@@ -0,0 +1,131 @@
+// =====================================================
+// FlexCAN_T4.cpp
+//
+// Host stand-in, the bus is a SocketCAN interface or a Unix datagram socket (unix:<path>)
+// to odriveCanSim.py carrying the same frames.
+
+// the firmware build compiles everything under src/, this is for the host only
+#ifdef CAN_HOST
+
+#include "FlexCAN_T4.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <errno.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+extern std::mutex interruptLock;
+
+static int canSocket = -1;
+static struct sockaddr_un simAddress;
+static bool unixBus = false;
+static char hostPath[sizeof(simAddress.sun_path)];
+static std::atomic<_MB_ptr> receiveHandler(NULL);
+static std::atomic<bool> running(false);
+static std::thread receiveThread;
+
+// the receive "interrupt"
+static void canHostReceive() {
+  while (running) {
+    struct pollfd p = { canSocket, POLLIN, 0 };
+    if (poll(&p, 1, 10) <= 0) continue;
+
+    struct can_frame frame;
+    if (recv(canSocket, &frame, sizeof(frame), 0) != sizeof(frame)) continue;
+
+    CAN_message_t msg;
+    msg.flags.extended = (frame.can_id & CAN_EFF_FLAG) != 0;
+    msg.flags.remote = (frame.can_id & CAN_RTR_FLAG) != 0;
+    msg.id = frame.can_id & (msg.flags.extended ? CAN_EFF_MASK : CAN_SFF_MASK);
+    msg.len = frame.can_dlc;
+    memcpy(msg.buf, frame.data, 8);
+
+    _MB_ptr handler = receiveHandler;
+    if (handler == NULL) continue;
+    interruptLock.lock();
+    handler(msg);
+    interruptLock.unlock();
+  }
+}
+
+bool canHostOpen(const char *interface) {
+  if (strncmp(interface, "unix:", 5) == 0) {
+    unixBus = true;
+    if (strlen(interface + 5) + strlen(".host") >= sizeof(simAddress.sun_path)) return false;
+    canSocket = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (canSocket < 0) return false;
+
+    memset(&simAddress, 0, sizeof(simAddress));
+    simAddress.sun_family = AF_UNIX;
+    strncpy(simAddress.sun_path, interface + 5, sizeof(simAddress.sun_path) - 1);
+
+    // our end, so the simulator has somewhere to reply to
+    struct sockaddr_un host;
+    memset(&host, 0, sizeof(host));
+    host.sun_family = AF_UNIX;
+    strcpy(hostPath, simAddress.sun_path);
+    strcat(hostPath, ".host");
+    strcpy(host.sun_path, hostPath);
+    unlink(hostPath);
+    if (bind(canSocket, (struct sockaddr *)&host, sizeof(host)) < 0) return false;
+  } else {
+    canSocket = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if (canSocket < 0) return false;
+
+    struct ifreq ifr;
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, interface, IFNAMSIZ - 1);
+    if (ioctl(canSocket, SIOCGIFINDEX, &ifr) < 0) return false;
+
+    struct sockaddr_can address;
+    memset(&address, 0, sizeof(address));
+    address.can_family = AF_CAN;
+    address.can_ifindex = ifr.ifr_ifindex;
+    if (bind(canSocket, (struct sockaddr *)&address, sizeof(address)) < 0) return false;
+  }
+
+  running = true;
+  receiveThread = std::thread(canHostReceive);
+  return true;
+}
+
+void canHostClose() {
+  running = false;
+  if (receiveThread.joinable()) receiveThread.join();
+  if (canSocket >= 0) close(canSocket);
+  canSocket = -1;
+  if (unixBus) unlink(hostPath);
+}
+
+// 1 if the frame was queued, 0 if the socket's queue is full like a full TX mailbox
+int canHostWrite(const CAN_message_t &msg) {
+  if (canSocket < 0) return 0;
+
+  struct can_frame frame;
+  memset(&frame, 0, sizeof(frame));
+  frame.can_id = msg.id;
+  if (msg.flags.extended) frame.can_id |= CAN_EFF_FLAG;
+  if (msg.flags.remote) frame.can_id |= CAN_RTR_FLAG;
+  frame.can_dlc = msg.len;
+  memcpy(frame.data, msg.buf, 8);
+
+  ssize_t sent;
+  if (unixBus) {
+    sent = sendto(canSocket, &frame, sizeof(frame), MSG_DONTWAIT, (struct sockaddr *)&simAddress, sizeof(simAddress));
+  } else {
+    sent = send(canSocket, &frame, sizeof(frame), MSG_DONTWAIT);
+  }
+  return sent == sizeof(frame) ? 1 : 0;
+}
+
+void canHostOnReceive(_MB_ptr handler) { receiveHandler = handler; }
+
+#endif
@@ -0,0 +1,72 @@
+// =====================================================
+// FlexCAN_T4.h
+//
+// Host stand-in for the parts of FlexCAN_T4 that ODriveTeensyCAN uses. Frames go out and
+// come in on a Linux SocketCAN interface (vcan0, can0) or, for an interface named
+// unix:<path>, as the same frames over a Unix datagram socket to odriveCanSim.py. Received
+// frames are handed to the onReceive() handler from a thread, in place of the FIFO interrupt.
+
+#pragma once
+
+#include "Arduino.h"
+
+typedef struct CAN_message_t {
+  uint32_t id = 0;
+  uint16_t timestamp = 0;
+  uint8_t idhit = 0;
+  struct {
+    bool extended = 0;
+    bool remote = 0;
+    bool overrun = 0;
+    bool reserved = 0;
+  } flags;
+  uint8_t len = 8;
+  uint8_t buf[8] = { 0 };
+  int8_t mb = 0;
+  uint8_t bus = 0;
+  bool seq = 0;
+} CAN_message_t;
+
+typedef struct CAN_error_t {
+  char state[30] = "Idle";
+  bool BIT1_ERR = 0;
+  bool BIT0_ERR = 0;
+  bool ACK_ERR = 0;
+  bool CRC_ERR = 0;
+  bool FRM_ERR = 0;
+  bool STF_ERR = 0;
+  bool RX_WRN = 0;
+  bool TX_WRN = 0;
+  char FLT_CONF[14] = { 0 };
+  uint8_t RX_ERR_COUNTER = 0;
+  uint8_t TX_ERR_COUNTER = 0;
+  uint32_t ESR1 = 0;
+  uint16_t ECR = 0;
+} CAN_error_t;
+
+typedef enum CAN_DEV_TABLE { CAN1, CAN2, CAN3 } CAN_DEV_TABLE;
+typedef enum FLEXCAN_RXQUEUE_TABLE { RX_SIZE_2 = 2, RX_SIZE_256 = 256 } FLEXCAN_RXQUEUE_TABLE;
+typedef enum FLEXCAN_TXQUEUE_TABLE { TX_SIZE_2 = 2, TX_SIZE_16 = 16 } FLEXCAN_TXQUEUE_TABLE;
+
+typedef void (*_MB_ptr)(const CAN_message_t &msg);
+
+// the bus, in FlexCAN_T4.cpp
+bool canHostOpen(const char *interface);
+void canHostClose();
+int canHostWrite(const CAN_message_t &msg);
+void canHostOnReceive(_MB_ptr handler);
+
+template<CAN_DEV_TABLE _bus, FLEXCAN_RXQUEUE_TABLE _rxSize = RX_SIZE_2, FLEXCAN_TXQUEUE_TABLE _txSize = TX_SIZE_2>
+class FlexCAN_T4 {
+  public:
+    void begin() { }
+    void setBaudRate(uint32_t) { }
+    void setMaxMB(uint8_t) { }
+    void enableFIFO(bool = true) { }
+    void enableFIFOInterrupt(bool = true) { }
+    void onReceive(_MB_ptr handler) { canHostOnReceive(handler); }
+    int write(const CAN_message_t &msg) { return canHostWrite(msg); }
+    bool error(CAN_error_t &, bool) { return false; }
+    // frames are handed over by the receive thread as they arrive
+    uint64_t events() { return 0; }
+};
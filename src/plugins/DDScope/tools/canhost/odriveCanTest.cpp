@@ -0,0 +1,169 @@
+// =====================================================
+// odriveCanTest.cpp
+//
+// Runs ODriveTeensyCAN on the host against odriveCanSim.py (one node, id 0, heartbeats on,
+// no cyclic frames) and checks the request engine, timeouts, subscriptions, heartbeat
+// supervision and setpoint streaming. Built and run by tools/odriveCanTest.py.
+//
+//   odriveCanTest <interface>     vcan0, can0 or unix:<path>
+//
+// Exits with the number of checks that failed.
+
+// the firmware build compiles everything under src/, this is for the host only
+#ifdef CAN_HOST
+
+#include "Arduino.h"
+#include "FlexCAN_T4.h"
+#include "ODriveTeensyCAN.h"
+
+#define NODE   0   // answered by the simulator
+#define ABSENT 1   // nothing on the bus answers for it
+
+#define AXIS_STATE_IDLE                1
+#define AXIS_STATE_CLOSED_LOOP_CONTROL 8
+#define AXIS_ERROR_ESTOP_REQUESTED     0x4000
+
+static ODriveTeensyCAN *odrive;
+static int failures = 0;
+
+static void check(bool pass, const char *what) {
+  printf("%s %s\n", pass ? "PASS" : "FAIL", what);
+  if (!pass) failures++;
+}
+
+// poll() every ms, as the ODrive task does
+static void run(unsigned long ms) {
+  unsigned long start = millis();
+  while (millis() - start < ms) { odrive->poll(); delay(1); }
+}
+
+static float latestFloat(int axis, int cmd, int offset) {
+  byte data[8];
+  float value = 0;
+  if (odrive->latest(axis, cmd, data)) memcpy(&value, &data[offset], sizeof(float));
+  return value;
+}
+
+static volatile int callbackAxis = -1;
+static volatile int callbackCmd = -1;
+static void replied(int axis_id, int cmd_id, const uint8_t *) { callbackAxis = axis_id; callbackCmd = cmd_id; }
+
+static void testFetch() {
+  byte data[8];
+  bool ok = odrive->fetch(NODE, ODriveTeensyCAN::CMD_ID_GET_VBUS_VOLTAGE_CURRENT, data, 100);
+  float vbus = 0;
+  memcpy(&vbus, data, sizeof(float));
+  check(ok && fabs(vbus - 24.0F) < 0.01F, "fetch() gets a fresh reply");
+
+  check(!odrive->fetch(ABSENT, ODriveTeensyCAN::CMD_ID_GET_VBUS_VOLTAGE_CURRENT, data, 20), "fetch() gives up when nothing answers");
+}
+
+static void testRequest() {
+  uint16_t count = odrive->replyCount(NODE, ODriveTeensyCAN::CMD_ID_GET_IQ);
+  bool sent = odrive->request(NODE, ODriveTeensyCAN::CMD_ID_GET_IQ, true, 8, NULL, replied);
+  unsigned long start = millis();
+  while (callbackCmd < 0 && millis() - start < 50) delay(1);
+  check(sent && callbackAxis == NODE && callbackCmd == ODriveTeensyCAN::CMD_ID_GET_IQ, "request() runs the callback with the reply");
+  check(odrive->replyCount(NODE, ODriveTeensyCAN::CMD_ID_GET_IQ) != count, "the reply is counted in the store");
+
+  // the getters return right away, the value follows once the reply is in
+  odrive->GetVbusVoltage(NODE);
+  run(20);
+  check(fabs(odrive->GetVbusVoltage(NODE) - 24.0F) < 0.01F, "a getter returns the stored reply");
+}
+
+static void testPending() {
+  // let anything still waiting time out, then fill the pending table with requests nothing will answer
+  delay(ODRIVE_CAN_TIMEOUT + 1);
+  bool all = true;
+  for (int i = 0; i < ODRIVE_CAN_PENDING; i++) all &= odrive->request(ABSENT, 0x03 + i, true, 8, NULL);
+  check(all, "requests are accepted until the pending table is full");
+  check(odrive->request(ABSENT, 0x03, true, 8, NULL), "a request already waiting is not sent again");
+  check(!odrive->request(ABSENT, 0x1C, true, 8, NULL), "a request is refused when the pending table is full");
+
+  delay(ODRIVE_CAN_TIMEOUT + 1);
+  check(odrive->request(ABSENT, 0x1C, true, 8, NULL), "timed out requests free their slots");
+}
+
+static void testHealth() {
+  // the first supervision is a second after start, run past the next one
+  run(1000 - millis() % 1000 + 1100);
+  ODriveCanHealth health = odrive->getHealth();
+  check(health.node[NODE].alive && health.node[NODE].age < ODRIVE_CAN_HEARTBEAT_MS*2, "heartbeats keep the node alive");
+  check(!health.node[ABSENT].alive, "a node that never sent a heartbeat isn't alive");
+  check(health.node[NODE].state == AXIS_STATE_IDLE && odrive->GetCurrentState(NODE) == AXIS_STATE_IDLE, "the axis state comes from the heartbeat");
+  check(health.framesPerSecond >= 1000/ODRIVE_CAN_HEARTBEAT_MS - 1, "frames per second are counted");
+  check(health.timeouts >= ODRIVE_CAN_PENDING + 2, "unanswered requests are counted as timeouts");
+  check(health.txFull == 0 && health.busErrors == 0, "no TX queue overflows or bus errors");
+}
+
+static void testSubscribe() {
+  odrive->subscribe(ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, 20);
+  run(50);
+  uint16_t count = odrive->replyCount(NODE, ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES);
+  run(500);
+  uint16_t replies = odrive->replyCount(NODE, ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES) - count;
+  check(replies >= 20 && replies <= 27, "a subscribed value is requested once per period");
+
+  byte data[8];
+  unsigned long time = 0;
+  odrive->latest(NODE, ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, data, &time);
+  check(millis() - time <= 25, "a subscribed value is kept fresh");
+}
+
+static void testStreaming() {
+  odrive->ClearErrors(NODE);
+  odrive->RunState(NODE, AXIS_STATE_CLOSED_LOOP_CONTROL);
+  run(300);
+  check(odrive->GetCurrentState(NODE) == AXIS_STATE_CLOSED_LOOP_CONTROL, "the axis enters closed loop control");
+
+  // a 0.05 turn/s ramp streamed at 200 Hz with velocity feed forward, then held
+  float start = latestFloat(NODE, ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, 0);
+  float target = start;
+  bool sent = true;
+  for (int i = 0; i < 200; i++) {
+    target = start + 0.05F*i/200.0F;
+    sent &= odrive->SetPosition(NODE, target, 0.05F);
+    run(5);
+  }
+  sent &= odrive->SetPosition(NODE, target);
+  check(sent, "every setpoint is queued");
+  check(odrive->GetInputPosition(NODE) == target, "the last setpoint is kept locally");
+
+  run(500);
+  float position = latestFloat(NODE, ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, 0);
+  printf("     streamed to %.5f turns, estimate %.5f turns\n", target, position);
+  check(fabs(position - target) < 0.0005F, "the axis follows the streamed setpoints");
+}
+
+static void testEstop() {
+  odrive->Estop(NODE);
+  run(300);
+  check(odrive->GetAxisError(NODE) == AXIS_ERROR_ESTOP_REQUESTED && odrive->GetCurrentState(NODE) == AXIS_STATE_IDLE, "an estop shows in the heartbeat");
+
+  odrive->ClearErrors(NODE);
+  run(1100);
+  ODriveCanHealth health = odrive->getHealth();
+  check(health.node[NODE].axisError == 0 && health.node[NODE].transitions >= 2, "clearing errors shows in the heartbeat");
+}
+
+int main(int argc, char **argv) {
+  const char *interface = argc > 1 ? argv[1] : "vcan0";
+  if (!canHostOpen(interface)) { printf("FAIL can't open %s\n", interface); return 1; }
+
+  odrive = new ODriveTeensyCAN(250000);
+  testFetch();
+  testRequest();
+  testPending();
+  testHealth();
+  testSubscribe();
+  testStreaming();
+  testEstop();
+  odrive->subscribe(ODriveTeensyCAN::CMD_ID_GET_ENCODER_ESTIMATES, 0);
+
+  canHostClose();
+  printf("%d check(s) failed\n", failures);
+  return failures;
+}
+
+#endif
@@ -0,0 +1,17 @@
+// =====================================================
+// Common.h
+//
+// Host stand-in, the debug macros print to stdout.
+
+#pragma once
+
+#include <iostream>
+
+inline void hostPrint(const char *s) { std::cout << s; }
+inline void hostPrint(char *s) { std::cout << s; }
+template<class T> inline void hostPrint(T v) { std::cout << +v; }
+
+#define V(x)   hostPrint(x)
+#define VF(x)  hostPrint(x)
+#define VL(x)  do { hostPrint(x); std::cout << std::endl; } while (0)
+#define VLF(x) VL(x)
@@ -0,0 +1,6 @@
+// =====================================================
+// OnTask.h
+//
+// Host stand-in, ODriveTeensyCAN includes it but starts no tasks.
+
+#pragma once
@@ -0,0 +1,251 @@
+#!/usr/bin/env python3
+# =====================================================
+# mkCatalogBin.py
+#
+# Builds catalogs.bin, the SD card catalog container read by catalog/SdCatalog.cpp,
+# from the catalog headers in libCatalogs/.
+#
+# The records are copied byte for byte from the compiled headers: a small dumper
+# is built with the host C++ compiler against catalog/CatalogTypes.h so the
+# packed record layouts are exactly the ones the firmware uses. The firmware
+# checks each catalog's record size and skips any that don't match.
+#
+# Each catalog also gets an RA zone index, its record numbers grouped by RA hour
+# (decoded with catalog/CatalogRecord.h), so the nearby filter reads only the
+# records in the hours around the telescope instead of the whole catalog.
+#
+# Catalogs are added in the order given, after any compiled into flash, so keep
+# the order of catalog[] in catalog/CatalogConfig.h when it is built with
+# CATALOGS_ON_SD (Stars, Messier, Caldwell, Herschel, Index are expected first).
+#
+#   python3 tools/mkCatalogBin.py [-o catalogs.bin] [SubMenu>file.h ...]
+#
+# Copy the output to the root of the SD card.
+
+import argparse
+import os
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+LIB_DIR = os.path.join(HERE, '..', 'libCatalogs')
+CAT_DIR = os.path.join(HERE, '..', 'catalog')
+
+# must match catalog/SdCatalog.h and the structs at the end of catalog/CatalogTypes.h
+MAGIC = b'DDCB'
+VERSION = 3
+PAGE_SIZE = 512
+HEADER_FMT = '<4sHHII'
+DIR_FMT = '<32sBBhIIIHIIIIIIII'
+ZONES = 24
+
+# enough of Arduino.h for catalog/CatalogRecord.h
+ARDUINO_STUB = '''
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+typedef uint8_t byte;
+'''
+
+# same catalogs and order as the Teensy4 section of catalog/CatalogConfig.h
+DEFAULT_CATALOGS = [
+  'Stars>stars.h',
+  'Messier>messier.h',
+  'Caldwell>caldwell.h',
+  'Herschel>herschel.h',
+  'IndexCat>ic_select_c.h',
+]
+
+DUMPER = r'''
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <type_traits>
+#include "CatalogRecord.h"
+#include "%(header)s"
+
+typedef std::remove_cv<std::remove_reference<decltype(%(sym)s[0])>::type>::type Record;
+
+static void putU32(FILE *f, uint32_t v) { fwrite(&v, 4, 1, f); }
+static void putStr(FILE *f, const char *s) { putU32(f, strlen(s)); fwrite(s, strlen(s), 1, f); }
+
+int main(int argc, char **argv) {
+  FILE *f = fopen(argv[1], "wb");
+  if (f == NULL) return 1;
+  putStr(f, %(sym)s_Title);
+  putStr(f, %(sym)s_Prefix);
+  putU32(f, %(sym)s_Type);
+  putU32(f, sizeof(%(sym)s[0]));
+  putU32(f, %(num)s);
+  fwrite(%(sym)s, sizeof(%(sym)s[0]), %(num)s, f);
+  for (long i = 0; i < %(num)s; i++) {
+    uint8_t flags[2] = { (uint8_t)%(sym)s[i].Has_name, (uint8_t)%(sym)s[i].Has_subId };
+    float rah = (float)CatLayout<Record>::rah(%(sym)s[i]);
+    fwrite(flags, sizeof(flags), 1, f);
+    fwrite(&rah, sizeof(rah), 1, f);
+  }
+  putStr(f, %(sym)s_Names);
+  putStr(f, %(sym)s_SubId);
+  fclose(f);
+  return 0;
+}
+'''
+
+def cat_type_values():
+  src = open(os.path.join(CAT_DIR, 'Catalog.h')).read()
+  m = re.search(r'enum CAT_TYPES\s*\{(.*?)\}', src, re.S)
+  return [name.strip() for name in m.group(1).split(',')]
+
+def dump_catalog(path, work):
+  src = open(path, encoding='latin-1').read()
+  m = re.search(r'^const \w+ (Cat_\w+)\[(NUM_\w+)\]', src, re.M)
+  if not m:
+    sys.exit('mkCatalogBin: no record array found in ' + path)
+  sym, num = m.group(1), m.group(2)
+
+  base = os.path.join(work, sym)
+  with open(base + '.cpp', 'w') as f:
+    f.write(DUMPER % {'header': os.path.abspath(path), 'sym': sym, 'num': num})
+  with open(os.path.join(work, 'Arduino.h'), 'w') as f:
+    f.write(ARDUINO_STUB)
+  # -w: the headers rely on implicit const char* conversions of string literals
+  cmd = ['g++', '-w', '-std=gnu++11', '-I' + work, '-I' + CAT_DIR, base + '.cpp', '-o', base]
+  if subprocess.call(cmd) != 0:
+    sys.exit('mkCatalogBin: failed to compile the dumper for ' + path)
+  if subprocess.call([base, base + '.dat']) != 0:
+    sys.exit('mkCatalogBin: dumper failed for ' + path)
+
+  data = open(base + '.dat', 'rb').read()
+  pos = 0
+  def u32():
+    nonlocal pos
+    v = struct.unpack_from('<I', data, pos)[0]; pos += 4
+    return v
+  def blob(n):
+    nonlocal pos
+    v = data[pos:pos + n]; pos += n
+    return v
+
+  cat = {}
+  cat['title'] = blob(u32())
+  cat['prefix'] = blob(u32())
+  cat['type'] = u32()
+  cat['size'] = u32()
+  cat['num'] = u32()
+  cat['records'] = blob(cat['size']*cat['num'])
+  cat['has_name'] = []
+  cat['has_subid'] = []
+  cat['rah'] = []
+  for i in range(cat['num']):
+    has_name, has_subid, rah = struct.unpack_from('<BBf', data, pos); pos += 6
+    cat['has_name'].append(has_name)
+    cat['has_subid'].append(has_subid)
+    cat['rah'].append(rah)
+  cat['names'] = blob(u32())
+  cat['subids'] = blob(u32())
+  return cat
+
+def string_codes(text, flags):
+  # the n-th flagged record uses the n-th ';' separated element, as CatMgr::getElementFromString(),
+  # the codes are those element numbers and the offsets where each element starts
+  offsets = [0]
+  for i, c in enumerate(text):
+    if c == ord(';'):
+      offsets.append(i + 1)
+  codes = []
+  n = 0
+  for flag in flags:
+    if flag and n < len(offsets):
+      codes.append(n); n += 1
+    else:
+      codes.append(-1)
+  return codes, offsets
+
+def zone_index(rah):
+  # record numbers by RA hour, in record order within each hour as SdCatalog::zoneNext() expects,
+  # and where each hour starts in that list with a final entry for the end
+  hours = [min(max(int(r), 0), ZONES - 1) for r in rah]
+  order = sorted(range(len(rah)), key=lambda i: (hours[i], i))
+  starts = [0]*(ZONES + 1)
+  for h in hours:
+    starts[h + 1] += 1
+  for h in range(ZONES):
+    starts[h + 1] += starts[h]
+  return starts, order
+
+def main():
+  parser = argparse.ArgumentParser(description='Build the SD card catalog container.')
+  parser.add_argument('-o', '--output', default='catalogs.bin')
+  parser.add_argument('catalogs', nargs='*', default=DEFAULT_CATALOGS,
+                      help='SubMenu>header.h from libCatalogs/, e.g. "Deep Sky>ngc.h"')
+  args = parser.parse_args()
+
+  types = cat_type_values()
+  work = tempfile.mkdtemp(prefix='mkCatalogBin')
+  cats = []
+  for spec in args.catalogs:
+    subMenu, _, header = spec.rpartition('>')
+    path = header if os.path.exists(header) else os.path.join(LIB_DIR, header)
+    cat = dump_catalog(path, work)
+    cat['title'] = ((subMenu + '>' if subMenu else '').encode('latin-1') + cat['title'])[:31]
+    cats.append(cat)
+
+  # layout: header, directory, then each catalog's sections with its records page aligned
+  dir_size = struct.calcsize(DIR_FMT)
+  out = bytearray(struct.pack(HEADER_FMT, MAGIC, VERSION, len(cats), dir_size, 0))
+  out += bytes(dir_size*len(cats))
+
+  def align():
+    out.extend(bytes(-len(out) % PAGE_SIZE))
+
+  entries = []
+  for cat in cats:
+    size = cat['size']
+    per_page = PAGE_SIZE//size
+
+    align()
+    records = len(out)
+    for i in range(cat['num']):
+      if i and i % per_page == 0:
+        align()
+      out += cat['records'][i*size:(i + 1)*size]
+
+    prefix = len(out); out += cat['prefix'] + b'\0'
+    names = len(out); out += cat['names'] + b'\0'
+    subids = len(out); out += cat['subids'] + b'\0'
+    tables = []
+    for text, flags in ((cat['names'], cat['has_name']), (cat['subids'], cat['has_subid'])):
+      codes, offsets = string_codes(text, flags)
+      tables.append(len(out))
+      for code in codes:
+        out += struct.pack('<i', code)
+      tables.append(len(out))
+      for offset in offsets:
+        out += struct.pack('<I', offset)
+    name_idx, name_offsets, subid_idx, subid_offsets = tables
+    starts, order = zone_index(cat['rah'])
+    zones = len(out)
+    for start in starts:
+      out += struct.pack('<I', start)
+    zone_records = len(out)
+    for r in order:
+      out += struct.pack('<I', r)
+
+    entries.append(struct.pack(DIR_FMT, cat['title'], cat['type'], size, 2000, cat['num'],
+                               records, prefix, len(cat['prefix']), names, subids,
+                               name_idx, subid_idx, name_offsets, subid_offsets, zones, zone_records))
+    print('%-32s %-20s %6d records' % (cat['title'].decode('latin-1'), types[cat['type']], cat['num']))
+
+  for i, entry in enumerate(entries):
+    at = struct.calcsize(HEADER_FMT) + i*dir_size
+    out[at:at + dir_size] = entry
+
+  with open(args.output, 'wb') as f:
+    f.write(out)
+  print('wrote %s, %d bytes' % (args.output, len(out)))
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,270 @@
+#!/usr/bin/env python3
+# =====================================================
+# mkCmdRoute.py
+#
+# Generates src/telescope/CommandRoute.table.h, the perfect hash table that
+# Telescope::command() and CmdDirect use to go from the two command characters
+# straight to the subsystems that can handle the command and to its reply type
+# (see src/telescope/CommandRoute.h).
+#
+# The handlers are found by scanning each subsystem's command() source for its
+# command[0]/command[1] tests. A command[0] block whose second character can't
+# be read from the source (a computed or rewritten command[1]) claims every
+# command with that first character. A handler that passes the command on to
+# another object's command() (the rotator and focusers to their Axis) also
+# claims what that one handles, see FORWARDS. The reply types follow the LX200
+# rules CmdDirect::processCommand() used to apply with strchr() tests.
+#
+# The table is checked before it is written: every command a handler parses
+# must be routed to that handler.
+#
+# Run from anywhere after any command() handler changes:
+#   python3 tools/mkCmdRoute.py
+
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SRC_DIR = os.path.normpath(os.path.join(HERE, '..', '..', '..'))
+OUT_FILE = os.path.join(SRC_DIR, 'telescope', 'CommandRoute.table.h')
+
+# in Telescope::command() cascade order, must match CommandHandler in CommandRoute.h
+HANDLERS = [
+  ('CH_MOUNT',    ['telescope/mount/Mount.command.cpp']),
+  ('CH_GUIDE',    ['telescope/mount/guide/Guide.command.cpp']),
+  ('CH_GPIO',     ['lib/gpioEx/GpioBase.cpp', 'lib/gpioEx/sws/Sws.cpp']),
+  ('CH_STATUS',   ['telescope/mount/status/Status.command.cpp']),
+  ('CH_GOTO',     ['telescope/mount/goto/Goto.command.cpp']),
+  ('CH_PARK',     ['telescope/mount/park/Park.command.cpp']),
+  ('CH_LIBRARY',  ['telescope/mount/library/Library.command.cpp']),
+  ('CH_SITE',     ['telescope/mount/site/Site.command.cpp']),
+  ('CH_LIMITS',   ['telescope/mount/limits/Limits.command.cpp']),
+  ('CH_HOME',     ['telescope/mount/home/Home.command.cpp']),
+  ('CH_PEC',      ['telescope/mount/pec/Pec.command.cpp']),
+  ('CH_AXIS1',    ['lib/axis/Axis.command.cpp']),
+  ('CH_AXIS2',    ['lib/axis/Axis.command.cpp']),
+  ('CH_ROTATOR',  ['telescope/rotator/Rotator.command.cpp']),
+  ('CH_FOCUSER',  ['telescope/focuser/Focuser.command.cpp']),
+  ('CH_FEATURES', ['telescope/auxiliary/Features.command.cpp']),
+]
+
+# command() calls from inside a handler and the source of the command() they reach,
+# a call that matches none of these stops the generator
+FORWARDS = [
+  (r'\baxis\d+\.command\(', 'lib/axis/Axis.command.cpp'),     # Rotator
+  (r'\baxes\[[^\]]*\]->command\(', 'lib/axis/Axis.command.cpp'), # Focuser
+]
+
+WILD = 0xFF  # second character of a key that matches any command with this first character
+
+# reply types, must match CommandReply in CommandRoute.h
+CR_FULL, CR_SHORT, CR_NONE, CR_PARAM = 0, 1, 2, 3
+
+# (first char, second chars, reply) from CmdDirect::processCommand()
+REPLY_RULES = [
+  ('M', 'ewnsg',            CR_NONE),
+  ('M', 'ADNPS',            CR_SHORT),
+  ('Q', '\0ewns',           CR_NONE),
+  ('A', 'W123456789+',      CR_SHORT),
+  ('F', '+-QZHhF1234',      CR_NONE),
+  ('F', 'Aapc',             CR_SHORT),
+  ('f', '+-QZHhF1234',      CR_NONE),
+  ('f', 'Aapc',             CR_SHORT),
+  ('r', '+-PRFC<>Q1234',    CR_NONE),
+  ('r', '~S',               CR_SHORT),
+  ('R', 'AEGCMS0123456789', CR_NONE),
+  ('S', 'CLSGtgMNOPrdhoTBXY', CR_SHORT),
+  ('L', 'BNCDL!',           CR_NONE),
+  ('L', 'o$W',              CR_SHORT),
+  ('B', '+-',               CR_NONE),
+  ('C', 'S',                CR_NONE),
+  ('h', 'FC',               CR_NONE),
+  ('h', 'QPR',              CR_SHORT),
+  ('T', 'QR+-SLK',          CR_NONE),
+  ('T', 'edrn',             CR_SHORT),
+  ('W', 'S',                CR_SHORT),
+  ('W', '0123',             CR_NONE),
+]
+# reply depends on the parameter too, worked out at run time
+REPLY_PARAM = [('G', 'X'), ('W', 'R'), ('$', 'Q')] + [(c, d) for c in 'Ff' for d in '123456']
+REPLY_WILD = [('U', CR_NONE)]
+
+C_CHAR = r"'(\\.|[^'\\])'"
+
+def c_char(lit):
+  if lit.startswith('\\'):
+    return {'0': '\0', 'n': '\n', '\\': '\\', "'": "'"}[lit[1]]
+  return lit
+
+def strip_code(text):
+  text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+  text = re.sub(r'//[^\n]*', '', text)
+  return text
+
+def block_end(text, start):
+  depth = 0
+  for i in range(start, len(text)):
+    if text[i] == '{': depth += 1
+    elif text[i] == '}':
+      depth -= 1
+      if depth == 0: return i
+  return len(text)
+
+# second characters tested in a piece of code, None if they can't all be read
+def second_chars(code):
+  if re.search(r'command\[1\]\s*=[^=]', code):
+    return None
+  chars = set()
+  for m in re.finditer(r"command\[1\]\s*==\s*(?:" + C_CHAR + r"|0\b)", code):
+    chars.add(c_char(m.group(1)) if m.group(1) else '\0')
+  for m in re.finditer(r"toupper\(command\[1\]\)\s*==\s*" + C_CHAR, code):
+    chars.add(c_char(m.group(1))); chars.add(c_char(m.group(1)).lower())
+  for m in re.finditer(r'strchr\("([^"]*)",\s*command\[1\]\)', code):
+    chars.update(m.group(1))
+  for m in re.finditer(r"command\[1\]\s*>=\s*" + C_CHAR + r"\s*&&\s*command\[1\]\s*<=\s*([^&)]+)", code):
+    lo = c_char(m.group(1))
+    lm = re.match(C_CHAR + r"$", m.group(2).strip())
+    if lm: hi = c_char(lm.group(1))
+    elif lo.isdigit(): hi = '9'  # e.g. ALIGN_MAX_NUM_STARS + '0'
+    else: return None
+    for c in range(ord(lo), ord(hi) + 1): chars.add(chr(c))
+  return chars
+
+def scan(path, seen=()):
+  text = strip_code(open(os.path.join(SRC_DIR, path), encoding='utf-8', errors='replace').read())
+  keys = set()
+  known = set()
+  for pattern, target in FORWARDS:
+    for m in re.finditer(pattern, text):
+      known.add(m.end())
+      if target not in seen: keys |= scan(target, seen + (path,))
+  for m in re.finditer(r'(?:\.|->)command\(', text):
+    if m.end() not in known:
+      line = text.count('\n', 0, m.start()) + 1
+      sys.exit('%s:%d: unknown command() forward, add it to FORWARDS' % (path, line))
+  for m in re.finditer(r"if\s*\(\s*command\[0\]\s*==\s*" + C_CHAR, text):
+    c0 = c_char(m.group(1))
+    line_end = text.find('\n', m.end())
+    cond = text[m.start():line_end]
+    brace = cond.rfind('{')
+    if 'command[1]' in cond[:brace if brace >= 0 else len(cond)]:
+      chars = second_chars(cond)
+      if chars is None: keys.add((c0, WILD))
+      else: keys.update((c0, c) for c in chars)
+    elif brace >= 0:
+      start = m.start() + brace
+      chars = second_chars(text[start:block_end(text, start) + 1])
+      if chars is None or not chars: keys.add((c0, WILD))
+      else: keys.update((c0, c) for c in chars)
+    else:
+      keys.add((c0, WILD))
+  return keys
+
+# the route commandRoute() in CommandRoute.h finds, None if there is none
+def lookup(c0, c1, n, disp, used, routes, keys):
+  key = (ord(c0) << 8) | c1
+  for i in range(2):
+    s = slot(key, disp[bucket(key, len(disp))], n)
+    if used.get(s) == key: return routes[keys[key]]
+    key |= WILD
+  return None
+
+def key_value(c0, c1):
+  return (ord(c0) << 8) | (c1 if c1 == WILD else ord(c1))
+
+def key_name(c0, c1):
+  if c1 == WILD: return c0 + '*'
+  if c1 == '\0': return c0
+  return c0 + c1
+
+# hash and displace, must match commandRoute() in CommandRoute.h
+def bucket(k, nb):   return ((k * 0x9E3779B1) & 0xFFFFFFFF) >> 16 & (nb - 1)
+def slot(k, d, n):   return (((k ^ (d * 0x5BD1)) * 0x85EBCA6B) & 0xFFFFFFFF) >> 16 & (n - 1)
+
+def perfect_hash(keys):
+  n = 1
+  while n < len(keys) * 5 // 4: n *= 2
+  while True:
+    nb = max(1, n // 4)
+    buckets = [[] for _ in range(nb)]
+    for k in keys: buckets[bucket(k, nb)].append(k)
+    disp = [0] * nb
+    used = {}
+    ok = True
+    for b in sorted(range(nb), key=lambda b: -len(buckets[b])):
+      if not buckets[b]: continue
+      for d in range(256):
+        slots = [slot(k, d, n) for k in buckets[b]]
+        if len(set(slots)) == len(slots) and not any(s in used for s in slots):
+          disp[b] = d
+          for k, s in zip(buckets[b], slots): used[s] = k
+          break
+      else:
+        ok = False
+        break
+    if ok: return n, disp, used
+    n *= 2
+
+def main():
+  routes = {}
+  parsed = []
+  for bit, (name, files) in enumerate(HANDLERS):
+    found = set()
+    for f in files: found |= scan(f)
+    parsed.append(found)
+    for k in found: routes.setdefault(k, [0, CR_FULL])[0] |= 1 << bit
+    print('%-12s %s' % (name, ' '.join(sorted(key_name(*k) for k in found))))
+
+  for c0, chars, reply in REPLY_RULES:
+    for c1 in chars:
+      r = routes.setdefault((c0, c1), [0, CR_FULL])
+      if r[1] == CR_FULL: r[1] = reply  # first rule wins, as in the strchr() cascade
+  for c0, c1 in REPLY_PARAM: routes.setdefault((c0, c1), [0, CR_FULL])[1] = CR_PARAM
+  for c0, reply in REPLY_WILD: routes.setdefault((c0, WILD), [0, CR_FULL])[1] = reply
+
+  # a command with a known first character still goes to the handlers that take any second character
+  for (c0, c1), r in routes.items():
+    if c1 != WILD and (c0, WILD) in routes: r[0] |= routes[(c0, WILD)][0]
+
+  keys = {key_value(*k): k for k in routes}
+  n, disp, used = perfect_hash(list(keys))
+
+  # every command a handler parses reaches it, a wildcard is tried with a second character no key has
+  missing = []
+  for bit, found in enumerate(parsed):
+    for c0, c1 in found:
+      r = lookup(c0, 0x01 if c1 == WILD else ord(c1), n, disp, used, routes, keys)
+      if r is None or not r[0] & (1 << bit): missing.append('%s %s' % (HANDLERS[bit][0], key_name(c0, c1)))
+  if missing: sys.exit('not routed: ' + ', '.join(sorted(missing)))
+
+  out = []
+  out.append('// This data is machine generated by tools/mkCmdRoute.py from the command() handler sources.')
+  out.append('// Do NOT edit this data manually. Rather, fix the generator and rerun.')
+  out.append('//')
+  out.append('// %d keys in %d slots, see CommandRoute.h' % (len(keys), n))
+  out.append('')
+  out.append('#define COMMAND_ROUTE_SLOTS   %d' % n)
+  out.append('#define COMMAND_ROUTE_BUCKETS %d' % len(disp))
+  out.append('')
+  out.append('const uint8_t CommandRouteDisp[COMMAND_ROUTE_BUCKETS] = {')
+  for i in range(0, len(disp), 16):
+    out.append('  ' + ', '.join('%3d' % d for d in disp[i:i + 16]) + ',')
+  out.append('};')
+  out.append('')
+  out.append('const CommandRoute CommandRouteTable[COMMAND_ROUTE_SLOTS] = {')
+  for s in range(n):
+    if s in used:
+      k = used[s]
+      mask, reply = routes[keys[k]]
+      names = [HANDLERS[b][0] for b in range(len(HANDLERS)) if mask & (1 << b)]
+      out.append('  { 0x%04X, %d, 0x%05X }, // %-3s %s' % (k, reply, mask, key_name(*keys[k]), ' '.join(names)))
+    else:
+      out.append('  { 0x0000, 0, 0x00000 },')
+  out.append('};')
+
+  with open(OUT_FILE, 'w') as f: f.write('\n'.join(out) + '\n')
+  print('wrote %s, %d keys in %d slots' % (OUT_FILE, len(keys), n))
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+# =====================================================
+# mkNameIndex.py
+#
+# Generates libCatalogs/name_index.h, the flash resident common name index
+# used by the Go To screen's name search (see catalog/NameIndex.cpp).
+#
+# Every catalog header in libCatalogs/ plus mod1_treasure.csv is scanned.
+# For each named object an entry {name offset, record} is emitted, sorted by
+# the keypad (T9) digit sequence of its name so that a prefix typed on the
+# keypad always selects one contiguous run of entries per catalog.
+#
+# Run from anywhere after any catalog header or mod1_treasure.csv changes:
+#   python3 tools/mkNameIndex.py
+
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+LIB_DIR = os.path.join(HERE, '..', 'libCatalogs')
+OUT_FILE = os.path.join(LIB_DIR, 'name_index.h')
+TREASURE_FILE = os.path.join(LIB_DIR, 'mod1_treasure.csv')
+
+# must match nameIdxKey() in catalog/NameIndex.cpp
+T9 = {}
+for digit, letters in (('2', 'abc'), ('3', 'def'), ('4', 'ghi'), ('5', 'jkl'),
+                       ('6', 'mno'), ('7', 'pqrs'), ('8', 'tuv'), ('9', 'wxyz')):
+  for ch in letters:
+    T9[ch] = digit
+
+def t9_key(name):
+  key = []
+  for ch in name.lower():
+    if ch in T9:          key.append(T9[ch])
+    elif ch.isdigit():    key.append(ch)
+    elif ch == ' ':       key.append('0')
+    else:                 key.append('1')
+  return ''.join(key)
+
+def c_string(text):
+  return text.replace('\\', '\\\\').replace('"', '\\"')
+
+def parse_names(src, sym):
+  # returns list of (name, byte offset) for the concatenated Names literal
+  m = re.search(r'const char \*' + sym + r'_Names\s*=\s*(.*?);\s*\n', src, re.S)
+  if not m:
+    return None
+  pieces = re.findall(r'"((?:[^"\\]|\\.)*)"', m.group(1))
+  blob = ''.join(p.replace('\\"', '"').replace('\\\\', '\\') for p in pieces)
+  names = []
+  offset = 0
+  for name in blob.split(';')[:-1] if blob.endswith(';') else blob.split(';'):
+    if name != '':
+      names.append((name, offset))
+    offset += len(name.encode('latin-1')) + 1
+  return names
+
+def parse_has_name(src, sym):
+  m = re.search(r'const \w+ ' + sym + r'\[\w+\]\s*=\s*\{(.*?)\n\};', src, re.S)
+  if not m:
+    return None
+  return [int(r) for r in re.findall(r'^\s*\{\s*(\d+)\s*,', m.group(1), re.M)]
+
+def scan_catalog(path):
+  src = open(path, encoding='latin-1').read()
+  m = re.search(r'#define\s+NUM_(\w+)\s+(\d+)', src)
+  sym = re.search(r'#define\s+(Cat_\w+)_Title', src)
+  if not m or not sym:
+    return None
+  sym = sym.group(1)
+  cat_type = re.search(sym + r'_Type\s*=\s*(CAT_\w+)', src).group(1)
+  if cat_type.startswith('CAT_DBL_STAR') or cat_type.startswith('CAT_VAR_STAR'):
+    return None # the name field of these holds spectral or variability class, not a common name
+  names = parse_names(src, sym)
+  has_name = parse_has_name(src, sym)
+  if names is None or has_name is None:
+    sys.exit('%s: could not parse names or records' % path)
+  named = [i for i, h in enumerate(has_name) if h]
+  if len(named) < len(names):
+    names = names[:len(named)]
+  entries = [(t9_key(n), n, off, rec) for (n, off), rec in zip(names, named)]
+  if entries and max(e[2] for e in entries) > 0xFFFF:
+    sys.exit('%s: name string too large for a 16 bit offset' % path)
+  entries.sort()
+  return {'num': m.group(1), 'count': int(m.group(2)), 'sym': sym, 'type': cat_type,
+          'entries': entries, 'file': os.path.basename(path)}
+
+def parse_hm(text):
+  # "00h39.6m" -> hours, "+61d06m" -> degrees
+  m = re.match(r'\s*([+-]?)(\d+)[hd](\d+(?:\.\d+)?)m', text)
+  v = int(m.group(2)) + float(m.group(3)) / 60.0
+  return -v if m.group(1) == '-' else v
+
+def scan_treasure(path):
+  names = []
+  for row, line in enumerate(open(path, encoding='latin-1').read().splitlines()):
+    f = [s.strip() for s in line.split(';')]
+    if len(f) < 8:
+      continue
+    ra, dec = parse_hm(f[1]), parse_hm(f[2])
+    for name in (f[7], f[0]):
+      if name and name not in ('None', 'XXXX'):
+        names.append((name, row, ra, dec))
+  blob = ''
+  entries = []
+  for name, row, ra, dec in names:
+    entries.append((t9_key(name), name, len(blob), row, ra, dec))
+    blob += name + ';'
+  entries.sort()
+  return blob, entries
+
+def main():
+  # catalogs are told apart by record count at compile time, _c and _vc variants with
+  # the same count usually share names and record order and so share one section, else
+  # each gets its own section tagged with its catalog type for the runtime to pick from
+  sections = []
+  for fn in sorted(os.listdir(LIB_DIR)):
+    if not fn.endswith('.h') or fn == os.path.basename(OUT_FILE):
+      continue
+    cat = scan_catalog(os.path.join(LIB_DIR, fn))
+    if cat is None or not cat['entries']:
+      continue
+    same = [s for s in sections if (s['sym'], s['count']) == (cat['sym'], cat['count'])]
+    shared = [s for s in same if [e[2:] for e in s['entries']] == [e[2:] for e in cat['entries']]]
+    if shared:
+      shared[0]['file'] += ', ' + fn
+      shared[0]['type'] = 'CAT_NONE'
+    else:
+      if same:
+        for s in same:
+          s['ident_sfx'] = '_' + s['file'][:-2]
+        cat['ident_sfx'] = '_' + fn[:-2]
+      sections.append(cat)
+  blob, treasure = scan_treasure(TREASURE_FILE)
+
+  out = []
+  out.append('// This data is machine generated by tools/mkNameIndex.py from the catalog headers and mod1_treasure.csv.')
+  out.append('// Do NOT edit this data manually. Rather, fix the generator and rerun.')
+  out.append('//')
+  out.append('// Entries are sorted by the keypad digit sequence of each name, see catalog/NameIndex.cpp')
+  out.append('')
+  for cat in sections:
+    ident = 'NameIdx_' + cat['sym'][4:] + '_' + str(cat['count']) + cat.get('ident_sfx', '')
+    cat['ident'] = ident
+    out.append('// %s' % cat['file'])
+    out.append('#if defined(NUM_%s) && NUM_%s == %d' % (cat['num'], cat['num'], cat['count']))
+    out.append('const name_idx_t %s[%d] = {' % (ident, len(cat['entries'])))
+    for key, name, off, rec in cat['entries']:
+      out.append('  { %5d, %5d }, // %s' % (off, rec, name))
+    out.append('};')
+    out.append('#endif')
+    out.append('')
+
+  out.append('// mod1_treasure.csv, names and object ids with the row in the file and J2000 RA (hours) and Dec (degrees)')
+  out.append('const char *NameIdx_Treasure_Names=')
+  for i in range(0, len(blob), 100):
+    out.append('"%s"' % c_string(blob[i:i+100]))
+  out[-1] += ';'
+  out.append('')
+  out.append('const name_idx_t NameIdx_Treasure[%d] = {' % len(treasure))
+  for key, name, off, row, ra, dec in treasure:
+    out.append('  { %5d, %5d }, // %s' % (off, row, name))
+  out.append('};')
+  out.append('')
+  out.append('const name_idx_coord_t NameIdx_Treasure_Coords[%d] = {' % len(treasure))
+  for key, name, off, row, ra, dec in treasure:
+    out.append('  { %8.4f, %8.4f },' % (ra, dec))
+  out.append('};')
+  out.append('')
+
+  out.append('// sections for the catalogs compiled in, the runtime skips any not listed in catalog[]')
+  out.append('const name_idx_section_t NameIdx_Sections[] = {')
+  for cat in sections:
+    out.append('#if defined(NUM_%s) && NUM_%s == %d' % (cat['num'], cat['num'], cat['count']))
+    out.append('  { %s, %s, %s_Names, %s, NULL, %d },' % (cat['sym'], cat['type'], cat['sym'], cat['ident'], len(cat['entries'])))
+    out.append('#endif')
+  out.append('  { NULL, CAT_NONE, NameIdx_Treasure_Names, NameIdx_Treasure, NameIdx_Treasure_Coords, %d },' % len(treasure))
+  out.append('  { NULL, CAT_NONE, NULL, NULL, NULL, 0 }')
+  out.append('};')
+
+  with open(OUT_FILE, 'w', newline='\n') as f:
+    f.write('\n'.join(out) + '\n')
+  print('wrote %s: %d catalog sections, %d treasure entries' % (OUT_FILE, len(sections), len(treasure)))
+
+if __name__ == '__main__':
+  main()
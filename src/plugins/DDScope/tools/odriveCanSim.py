@@ -0,0 +1,339 @@
+#!/usr/bin/env python3
+# =====================================================
+# odriveCanSim.py
+#
+# A simulated ODrive (firmware 0.5 CAN Simple) on a Linux SocketCAN interface,
+# so the DDScope CAN stack (ODriveTeensyCAN, ODriveMotor, ODriveExt) can be
+# exercised and benchmarked without the telescope. Connect the Teensy's CAN
+# bus to a USB CAN adapter and bring it up at the ODrive's rate:
+#
+#   sudo ip link set can0 up type can bitrate 250000
+#   python3 tools/odriveCanSim.py can0
+#
+# or try the simulator alone on a virtual bus (cansniffer/cansend from can-utils):
+#
+#   sudo ip link add dev vcan0 type vcan && sudo ip link set vcan0 up
+#   python3 tools/odriveCanSim.py vcan0
+#
+# An interface named unix:<path> is a Unix datagram socket carrying the same
+# SocketCAN frames instead, for hosts without CAN support (no root needed).
+# Replies go to whoever sent the last frame. tools/odriveCanTest.py uses either
+# to run the ODriveTeensyCAN driver on the host against the simulator.
+#
+# Each node answers the remote requests the firmware uses, sends heartbeats
+# and, with --encoder-ms, cyclic encoder estimates. A position controller with
+# the ODrive's gains drives a motor model with inertia, friction and an
+# optional wind load. --latency-ms and --drop delay or lose replies to
+# exercise the request timeouts. Each second it prints, per node, the frames
+# it answered, the setpoints it received and their interval jitter, and the
+# tracking error.
+
+import argparse
+import math
+import os
+import random
+import select
+import socket
+import struct
+import sys
+import time
+
+# SocketCAN frame: id with flags, length, padding, data
+CAN_FRAME_FMT = '=IB3x8s'
+CAN_RTR_FLAG = 0x40000000
+CAN_EFF_FLAG = 0x80000000
+CAN_SFF_MASK = 0x7FF
+
+# must match CommandId_t in ODriveTeensyCAN/ODriveTeensyCAN.h
+HEARTBEAT = 0x001
+ESTOP = 0x002
+GET_MOTOR_ERROR = 0x003
+GET_ENCODER_ERROR = 0x004
+SET_AXIS_REQUESTED_STATE = 0x007
+GET_ENCODER_ESTIMATES = 0x009
+GET_ENCODER_COUNT = 0x00A
+SET_CONTROLLER_MODES = 0x00B
+SET_INPUT_POS = 0x00C
+SET_INPUT_VEL = 0x00D
+GET_IQ = 0x014
+REBOOT = 0x016
+GET_VBUS_VOLTAGE = 0x017
+CLEAR_ERRORS = 0x018
+SET_LINEAR_COUNT = 0x019
+SET_POS_GAIN = 0x01A
+SET_VEL_GAINS = 0x01B
+GET_ADC_VOLTAGE = 0x01C
+
+AXIS_STATE_IDLE = 1
+AXIS_STATE_CLOSED_LOOP_CONTROL = 8
+AXIS_ERROR_ESTOP_REQUESTED = 0x4000
+
+CPR = 16384
+ARCSEC_PER_TURN = 1296000.0
+
+
+class Node:
+    def __init__(self, node_id, args):
+        self.id = node_id
+        self.args = args
+        self.state = AXIS_STATE_IDLE
+        self.axis_error = 0
+        self.pos = args.start_turns
+        self.vel = 0.0
+        self.input_pos = self.pos
+        self.vel_ff = 0.0
+        self.torque_ff = 0.0
+        self.input_vel = 0.0
+        self.control_mode = 3  # position
+        self.pos_gain = args.pos_gain
+        self.vel_gain = args.vel_gain
+        self.vel_int_gain = args.vel_int_gain
+        self.integrator = 0.0
+        self.iq_setpoint = 0.0
+        self.reset_stats()
+
+    def reset_stats(self):
+        self.answered = 0
+        self.dropped = 0
+        self.setpoints = 0
+        self.last_setpoint = None
+        self.intervals = []
+        self.error_sq = 0.0
+        self.error_peak = 0.0
+        self.ticks = 0
+
+    # one step of the controller and motor, dt in seconds
+    def step(self, dt, now):
+        iq = 0.0
+        if self.state == AXIS_STATE_CLOSED_LOOP_CONTROL:
+            if self.control_mode == 3:
+                vel_setpoint = self.pos_gain*(self.input_pos - self.pos) + self.vel_ff
+            else:
+                vel_setpoint = self.input_vel
+            vel_error = vel_setpoint - self.vel
+            self.integrator += self.vel_int_gain*vel_error*dt
+            iq = self.vel_gain*vel_error + self.integrator + self.torque_ff
+            limit = self.args.current_limit
+            if abs(iq) > limit:
+                iq = math.copysign(limit, iq)
+                self.integrator -= self.vel_int_gain*vel_error*dt  # no windup while saturated
+        else:
+            self.integrator = 0.0
+        self.iq_setpoint = iq
+
+        load = self.args.wind*math.sin(2*math.pi*self.args.wind_hz*now + self.id)
+        friction = self.args.friction*self.vel
+        accel = (iq + load - friction)/self.args.inertia
+        self.vel += accel*dt
+        self.pos += self.vel*dt
+
+        if self.state == AXIS_STATE_CLOSED_LOOP_CONTROL:
+            error = (self.pos - self.input_pos)*ARCSEC_PER_TURN
+            self.error_sq += error*error
+            self.error_peak = max(self.error_peak, abs(error))
+            self.ticks += 1
+
+    def reply(self, cmd_id, vbus):
+        if cmd_id == HEARTBEAT:
+            controller_flags = 0
+            return struct.pack('<IBBBB', self.axis_error, self.state, 0, 0, controller_flags)
+        if cmd_id == GET_MOTOR_ERROR:
+            return struct.pack('<Q', 0)
+        if cmd_id == GET_ENCODER_ERROR:
+            return struct.pack('<II', 0, 0)
+        if cmd_id == GET_ENCODER_ESTIMATES:
+            return struct.pack('<ff', self.pos, self.vel)
+        if cmd_id == GET_ENCODER_COUNT:
+            counts = int(round(self.pos*CPR))
+            return struct.pack('<ii', counts, counts % CPR)
+        if cmd_id == GET_IQ:
+            return struct.pack('<ff', self.iq_setpoint, self.iq_setpoint)
+        if cmd_id == GET_VBUS_VOLTAGE:
+            return struct.pack('<ff', vbus, 0.0)
+        if cmd_id == GET_ADC_VOLTAGE:
+            return struct.pack('<ff', 1.65, 0.0)
+        return None
+
+    def command(self, cmd_id, data, now):
+        data = data.ljust(8, b'\0')
+        if cmd_id == SET_AXIS_REQUESTED_STATE:
+            state = struct.unpack_from('<I', data)[0]
+            if state == AXIS_STATE_CLOSED_LOOP_CONTROL and self.axis_error == 0:
+                self.input_pos = self.pos
+                self.state = state
+            elif state == AXIS_STATE_IDLE:
+                self.state = state
+        elif cmd_id == SET_INPUT_POS:
+            pos, vel_ff, torque_ff = struct.unpack_from('<fhh', data)
+            self.input_pos = pos
+            self.vel_ff = vel_ff*0.001
+            self.torque_ff = torque_ff*0.001
+            self.setpoints += 1
+            if self.last_setpoint is not None:
+                self.intervals.append(now - self.last_setpoint)
+            self.last_setpoint = now
+        elif cmd_id == SET_INPUT_VEL:
+            self.input_vel = struct.unpack_from('<f', data)[0]
+        elif cmd_id == SET_CONTROLLER_MODES:
+            self.control_mode = struct.unpack_from('<i', data)[0]
+        elif cmd_id == SET_LINEAR_COUNT:
+            self.pos = struct.unpack_from('<i', data)[0]/CPR
+        elif cmd_id == SET_POS_GAIN:
+            self.pos_gain = struct.unpack_from('<f', data)[0]
+        elif cmd_id == SET_VEL_GAINS:
+            self.vel_gain, self.vel_int_gain = struct.unpack_from('<ff', data)
+        elif cmd_id == CLEAR_ERRORS:
+            self.axis_error = 0
+        elif cmd_id == ESTOP:
+            self.axis_error |= AXIS_ERROR_ESTOP_REQUESTED
+            self.state = AXIS_STATE_IDLE
+        elif cmd_id == REBOOT:
+            self.__init__(self.id, self.args)
+
+
+class Simulator:
+    def __init__(self, args):
+        self.args = args
+        self.peer = None
+        if args.interface.startswith('unix:'):
+            path = args.interface[5:]
+            if os.path.exists(path):
+                os.unlink(path)
+            self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_DGRAM)
+            self.sock.bind(path)
+        else:
+            self.sock = socket.socket(socket.PF_CAN, socket.SOCK_RAW, socket.CAN_RAW)
+            self.sock.bind((args.interface,))
+        self.sock.setblocking(False)
+        self.nodes = {i: Node(i, args) for i in range(args.nodes)}
+        self.outbox = []  # (due time, can id, data)
+        self.requests = {}
+
+    def send(self, node_id, cmd_id, data):
+        frame = struct.pack(CAN_FRAME_FMT, (node_id << 5) | cmd_id, len(data), data.ljust(8, b'\0'))
+        try:
+            if self.sock.family == socket.AF_UNIX:
+                if self.peer is not None:
+                    self.sock.sendto(frame, self.peer)
+            else:
+                self.sock.send(frame)
+        except OSError:
+            pass  # TX queue full, like a busy bus
+
+    def queue(self, now, node_id, cmd_id, data):
+        self.outbox.append((now + self.args.latency_ms/1000.0, node_id, cmd_id, data))
+
+    def receive(self, now):
+        while True:
+            try:
+                frame, peer = self.sock.recvfrom(16)
+            except BlockingIOError:
+                return
+            if self.sock.family == socket.AF_UNIX:
+                self.peer = peer
+            can_id, length, data = struct.unpack(CAN_FRAME_FMT, frame)
+            if can_id & CAN_EFF_FLAG:
+                continue
+            node_id = (can_id & CAN_SFF_MASK) >> 5
+            cmd_id = can_id & 0x1F
+            node = self.nodes.get(node_id)
+            if node is None:
+                continue
+            if can_id & CAN_RTR_FLAG:
+                self.requests[cmd_id] = self.requests.get(cmd_id, 0) + 1
+                if random.random() < self.args.drop:
+                    node.dropped += 1
+                    continue
+                reply = node.reply(cmd_id, self.args.vbus)
+                if reply is not None:
+                    node.answered += 1
+                    self.queue(now, node_id, cmd_id, reply)
+            else:
+                node.command(cmd_id, data[:length], now)
+
+    def run(self):
+        start = time.monotonic()
+        dt = 0.001
+        next_tick = start
+        next_heartbeat = start
+        next_encoder = start
+        next_report = start + 1.0
+        print('simulating %d ODrive node(s) on %s, Ctrl+C stops' % (len(self.nodes), self.args.interface))
+        while True:
+            timeout = max(0.0, next_tick - time.monotonic())
+            select.select([self.sock], [], [], timeout)
+            now = time.monotonic()
+            self.receive(now)
+
+            while next_tick <= now:
+                for node in self.nodes.values():
+                    node.step(dt, next_tick - start)
+                next_tick += dt
+
+            due = [m for m in self.outbox if m[0] <= now]
+            self.outbox = [m for m in self.outbox if m[0] > now]
+            for _, node_id, cmd_id, data in due:
+                self.send(node_id, cmd_id, data)
+
+            if self.args.heartbeat_ms and now >= next_heartbeat:
+                next_heartbeat += self.args.heartbeat_ms/1000.0
+                for node in self.nodes.values():
+                    self.send(node.id, HEARTBEAT, node.reply(HEARTBEAT, self.args.vbus))
+            if self.args.encoder_ms and now >= next_encoder:
+                next_encoder += self.args.encoder_ms/1000.0
+                for node in self.nodes.values():
+                    self.send(node.id, GET_ENCODER_ESTIMATES, node.reply(GET_ENCODER_ESTIMATES, self.args.vbus))
+
+            if now >= next_report:
+                next_report += 1.0
+                self.report()
+
+    def report(self):
+        for node in self.nodes.values():
+            jitter = 0.0
+            if len(node.intervals) > 1:
+                mean = sum(node.intervals)/len(node.intervals)
+                jitter = math.sqrt(sum((i - mean)**2 for i in node.intervals)/len(node.intervals))*1000.0
+            rms = math.sqrt(node.error_sq/node.ticks) if node.ticks else 0.0
+            print('node %d: state %d, %d replies, %d dropped, %d setpoints/s (jitter %.2f ms), error RMS %.1f" peak %.1f"' %
+                  (node.id, node.state, node.answered, node.dropped, node.setpoints, jitter, rms, node.error_peak))
+            node.reset_stats()
+        if self.requests:
+            print('  requests/s by command: ' + ', '.join('0x%03X:%d' % (c, n) for c, n in sorted(self.requests.items())))
+        self.requests = {}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Simulated ODrive on a SocketCAN interface')
+    parser.add_argument('interface', nargs='?', default='vcan0', help='SocketCAN interface or unix:<path> (default vcan0)')
+    parser.add_argument('--nodes', type=int, default=2, help='node ids 0 to n-1 (default 2)')
+    parser.add_argument('--heartbeat-ms', type=int, default=100, help='heartbeat period, 0 for none (default 100)')
+    parser.add_argument('--encoder-ms', type=int, default=0, help='cyclic encoder estimates period, 0 for none (default)')
+    parser.add_argument('--latency-ms', type=float, default=0.2, help='reply delay (default 0.2)')
+    parser.add_argument('--drop', type=float, default=0.0, help='fraction of requests left unanswered (default 0)')
+    parser.add_argument('--pos-gain', type=float, default=20.0)
+    parser.add_argument('--vel-gain', type=float, default=1.5)
+    parser.add_argument('--vel-int-gain', type=float, default=2.0)
+    parser.add_argument('--inertia', type=float, default=0.05, help='A per turn/s^2 (default 0.05)')
+    parser.add_argument('--friction', type=float, default=0.1, help='A per turn/s (default 0.1)')
+    parser.add_argument('--current-limit', type=float, default=10.0)
+    parser.add_argument('--wind', type=float, default=0.0, help='wind load amplitude in A (default 0)')
+    parser.add_argument('--wind-hz', type=float, default=0.5)
+    parser.add_argument('--vbus', type=float, default=24.0)
+    parser.add_argument('--start-turns', type=float, default=0.0)
+    args = parser.parse_args()
+
+    if not args.interface.startswith('unix:') and not hasattr(socket, 'PF_CAN'):
+        sys.exit('SocketCAN needs Linux')
+    try:
+        sim = Simulator(args)
+    except OSError as e:
+        sys.exit('%s: %s' % (args.interface, e))
+    try:
+        sim.run()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+# =====================================================
+# odriveCanTest.py
+#
+# Builds the ODriveTeensyCAN driver for the host, with canhost/ standing in for
+# Arduino and FlexCAN_T4, starts odriveCanSim.py and runs canhost/odriveCanTest.cpp
+# against it: requests and their callbacks, the pending table and timeouts,
+# subscriptions, heartbeat supervision and setpoint streaming. Needs Linux and
+# the host C++ compiler, no Teensy.
+#
+#   python3 tools/odriveCanTest.py [interface]
+#
+# The interface is a SocketCAN one (a vcan0 made as in odriveCanSim.py) or, by
+# default, unix:<temp path> which needs no CAN support or root, as in CI.
+# Exits non-zero if the build or any check fails.
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+HOST_DIR = os.path.join(HERE, 'canhost')
+DRIVER_DIR = os.path.join(HERE, '..', 'ODriveTeensyCAN')
+
+SOURCES = [
+  os.path.join(HOST_DIR, 'odriveCanTest.cpp'),
+  os.path.join(HOST_DIR, 'Arduino.cpp'),
+  os.path.join(HOST_DIR, 'FlexCAN_T4.cpp'),
+  os.path.join(DRIVER_DIR, 'ODriveTeensyCAN.cpp'),
+]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Host test of ODriveTeensyCAN against the simulated ODrive')
+    parser.add_argument('interface', nargs='?', help='SocketCAN interface (default a unix: socket)')
+    parser.add_argument('--cxx', default=os.environ.get('CXX', 'g++'), help='host C++ compiler (default g++)')
+    parser.add_argument('-v', '--verbose', action='store_true', help='show the simulator reports')
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmp:
+        exe = os.path.join(tmp, 'odriveCanTest')
+        cmd = [args.cxx, '-std=c++11', '-O1', '-Wall', '-pthread', '-DCAN_HOST', '-I', HOST_DIR, '-I', DRIVER_DIR, '-o', exe] + SOURCES
+        if subprocess.call(cmd) != 0:
+            sys.exit('build failed')
+
+        interface = args.interface or 'unix:' + os.path.join(tmp, 'bus')
+        sim = subprocess.Popen([sys.executable, os.path.join(HERE, 'odriveCanSim.py'), interface, '--nodes', '1'],
+                               stdout=None if args.verbose else subprocess.DEVNULL)
+        try:
+            # give it time to bind the socket
+            time.sleep(0.5)
+            if sim.poll() is not None:
+                sys.exit('odriveCanSim.py failed to start on %s' % interface)
+            result = subprocess.call([exe, interface])
+        finally:
+            sim.terminate()
+            sim.wait()
+
+    sys.exit(1 if result else 0)
+
+
+if __name__ == '__main__':
+    main()
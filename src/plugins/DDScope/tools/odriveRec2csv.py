@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# =====================================================
+# odriveRec2csv.py
+#
+# Converts an ODrive telemetry recording (odrecNNN.bin, written by
+# odriveExt/ODriveRecorder.cpp after :SQR1#) to CSV and summarizes the
+# tracking error of each axis: RMS, peak and the dominant oscillation
+# frequency. The motors are direct drive so one turn is 360 degrees of sky,
+# errors are reported in arc-seconds.
+#
+#   python3 tools/odriveRec2csv.py odrec000.bin [-o odrec000.csv] [--plot]
+#
+# --plot needs matplotlib, the frequency estimate uses numpy when it's there
+# and counts zero crossings otherwise.
+
+import argparse
+import csv
+import math
+import os
+import struct
+import sys
+
+# must match the structs in odriveExt/ODriveRecorder.h
+MAGIC = b'ODRC'
+VERSION = 1
+HEADER_FMT = '<4sHHIBB'
+RECORD_FMT = '<IBffff'
+ARCSEC_PER_TURN = 1296000.0
+
+
+def read_recording(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    header_size = struct.calcsize(HEADER_FMT)
+    if len(data) < header_size:
+        sys.exit('%s: too short for a recording' % path)
+    magic, version, record_size, start_millis, azm_axis, alt_axis = struct.unpack_from(HEADER_FMT, data)
+    if magic != MAGIC or version != VERSION:
+        sys.exit('%s: not a version %d ODrive recording' % (path, VERSION))
+    if record_size != struct.calcsize(RECORD_FMT):
+        sys.exit('%s: record size %d, expected %d' % (path, record_size, struct.calcsize(RECORD_FMT)))
+
+    names = {azm_axis: 'AZM', alt_axis: 'ALT'}
+    records = []
+    first = None
+    last = None
+    wraps = 0
+    # a record cut off by a power cut or an unfinished flush is ignored
+    for offset in range(header_size, len(data) - record_size + 1, record_size):
+        micros, axis, setpoint, position, velocity, iq = struct.unpack_from(RECORD_FMT, data, offset)
+        if last is not None and micros < last:
+            wraps += 1
+        last = micros
+        t = micros + wraps*4294967296
+        if first is None:
+            first = t
+        records.append(((t - first)/1e6, names.get(axis, str(axis)), setpoint, position, velocity, iq))
+    return start_millis, records
+
+
+def dominant_frequency(times, errors):
+    if len(errors) < 16 or times[-1] <= times[0]:
+        return 0.0
+    mean = sum(errors)/len(errors)
+    try:
+        import numpy
+        # resampled evenly, the frames arrive with some jitter
+        n = len(errors)
+        even = numpy.linspace(times[0], times[-1], n)
+        y = numpy.interp(even, times, errors) - mean
+        spectrum = numpy.abs(numpy.fft.rfft(y*numpy.hanning(n)))
+        freqs = numpy.fft.rfftfreq(n, (times[-1] - times[0])/(n - 1))
+        spectrum[0] = 0
+        return float(freqs[int(numpy.argmax(spectrum))])
+    except ImportError:
+        crossings = sum(1 for a, b in zip(errors, errors[1:]) if (a - mean)*(b - mean) < 0)
+        return crossings/2.0/(times[-1] - times[0])
+
+
+def summarize(records):
+    axes = sorted(set(r[1] for r in records))
+    for name in axes:
+        rows = [r for r in records if r[1] == name]
+        times = [r[0] for r in rows]
+        errors = [(r[3] - r[2])*ARCSEC_PER_TURN for r in rows]
+        rms = math.sqrt(sum(e*e for e in errors)/len(errors))
+        peak = max(abs(e) for e in errors)
+        span = times[-1] - times[0]
+        rate = (len(rows) - 1)/span if span > 0 else 0.0
+        print('%s: %d records at %.0f Hz, tracking error RMS %.1f" peak %.1f", dominant %.2f Hz, Iq peak %.2f A' %
+              (name, len(rows), rate, rms, peak, dominant_frequency(times, errors), max(abs(r[5]) for r in rows)))
+
+
+def plot(records, title):
+    import matplotlib.pyplot as plt
+    axes = sorted(set(r[1] for r in records))
+    fig, plots = plt.subplots(3, 1, sharex=True)
+    for name in axes:
+        rows = [r for r in records if r[1] == name]
+        t = [r[0] for r in rows]
+        plots[0].plot(t, [(r[3] - r[2])*ARCSEC_PER_TURN for r in rows], label=name)
+        plots[1].plot(t, [r[4] for r in rows], label=name)
+        plots[2].plot(t, [r[5] for r in rows], label=name)
+    plots[0].set_ylabel('error (")')
+    plots[1].set_ylabel('velocity (turn/s)')
+    plots[2].set_ylabel('Iq (A)')
+    plots[2].set_xlabel('time (s)')
+    plots[0].legend()
+    fig.suptitle(title)
+    plt.show()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert an ODrive telemetry recording to CSV')
+    parser.add_argument('recording')
+    parser.add_argument('-o', '--output', help='CSV file, default is the recording name with .csv')
+    parser.add_argument('--plot', action='store_true', help='plot error, velocity and Iq')
+    args = parser.parse_args()
+
+    start_millis, records = read_recording(args.recording)
+    if not records:
+        sys.exit('%s: no records' % args.recording)
+
+    output = args.output or os.path.splitext(args.recording)[0] + '.csv'
+    with open(output, 'w', newline='') as f:
+        w = csv.writer(f)
+        w.writerow(['time_s', 'axis', 'setpoint_turns', 'position_turns', 'velocity_turns_s', 'iq_a', 'error_arcsec'])
+        for t, name, setpoint, position, velocity, iq in records:
+            w.writerow(['%.6f' % t, name, '%.8f' % setpoint, '%.8f' % position, '%.6f' % velocity, '%.3f' % iq,
+                        '%.2f' % ((position - setpoint)*ARCSEC_PER_TURN)])
+    print('%s: %d records from %.1f s after boot to %s' % (args.recording, len(records), start_millis/1000.0, output))
+
+    summarize(records)
+    if args.plot:
+        plot(records, os.path.basename(args.recording))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,43 @@
+//--------------------------------------------------------------------------------------------------
+// OnStepX command routing, from the two command characters to the subsystems that can claim the
+// command and to its LX200 reply type, without trying each subsystem's command() in turn
+#pragma once
+
+#include <Arduino.h>
+
+// subsystems in Telescope::command() cascade order, one bit each in CommandRoute.handlers
+enum CommandHandler: uint8_t {
+  CH_MOUNT, CH_GUIDE, CH_GPIO, CH_STATUS, CH_GOTO, CH_PARK, CH_LIBRARY, CH_SITE,
+  CH_LIMITS, CH_HOME, CH_PEC, CH_AXIS1, CH_AXIS2, CH_ROTATOR, CH_FOCUSER, CH_FEATURES,
+  CH_COUNT
+};
+#define CH_ALL ((1UL << CH_COUNT) - 1)
+
+// how the reply to a command is framed
+enum CommandReply: uint8_t {
+  CR_FULL,   // '#' terminated string
+  CR_SHORT,  // single character, no '#'
+  CR_NONE,   // nothing
+  CR_PARAM   // depends on the characters after the command, see CmdDirect::processCommand()
+};
+
+typedef struct CommandRoute {
+  uint16_t key;       // first command character << 8 | second (0 for single character commands, 0xFF for any)
+  uint8_t  reply;     // CommandReply
+  uint32_t handlers;  // CommandHandler bits
+} CommandRoute;
+
+#include "CommandRoute.table.h"
+
+// route for the command, the exact key first then the route for its first character alone
+// returns NULL for commands no subsystem claims, these go to all handlers with a full reply
+inline const CommandRoute *commandRoute(char c0, char c1) {
+  uint16_t key = ((uint8_t)c0 << 8) | (uint8_t)c1;
+  for (int i = 0; i < 2; i++) {
+    uint8_t d = CommandRouteDisp[(uint16_t)((uint32_t)key*0x9E3779B1UL >> 16) & (COMMAND_ROUTE_BUCKETS - 1)];
+    const CommandRoute *route = &CommandRouteTable[(uint16_t)((uint32_t)(key ^ (d*0x5BD1U))*0x85EBCA6BUL >> 16) & (COMMAND_ROUTE_SLOTS - 1)];
+    if (route->key == key) return route;
+    key |= 0xFF;
+  }
+  return NULL;
+}
@@ -0,0 +1,533 @@
+// This data is machine generated by tools/mkCmdRoute.py from the command() handler sources.
+// Do NOT edit this data manually. Rather, fix the generator and rerun.
+//
+// 217 keys in 512 slots, see CommandRoute.h
+
+#define COMMAND_ROUTE_SLOTS   512
+#define COMMAND_ROUTE_BUCKETS 128
+
+const uint8_t CommandRouteDisp[COMMAND_ROUTE_BUCKETS] = {
+    0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   1,   0,   0,   0,   0,   2,   0,   0,   0,   0,   1,   0,   1,
+    1,   0,   1,   2,   0,   1,   0,   0,   0,   0,   0,   2,   0,   2,   2,   0,
+    2,   0,   0,   0,   3,   0,   0,   2,   2,   0,   0,   0,   5,   0,   0,   0,
+    1,   0,   4,   0,   0,   2,   1,   1,   0,   0,   0,   0,   0,   2,   0,   2,
+    0,   1,   3,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,
+    0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   1,   2,   1,   0,   0,   0,
+    0,   2,   0,   0,   0,   1,   0,   1,   0,   0,   0,   0,   0,   0,   3,   0,
+};
+
+const CommandRoute CommandRouteTable[COMMAND_ROUTE_SLOTS] = {
+  { 0x5730, 2, 0x00080 }, // W0  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x4741, 0, 0x00001 }, // GA  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5451, 2, 0x00001 }, // TQ  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5364, 1, 0x00010 }, // Sd  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7241, 0, 0x02000 }, // rA  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x724D, 0, 0x02000 }, // rM  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x6852, 1, 0x06020 }, // hR  CH_PARK CH_ROTATOR CH_FOCUSER
+  { 0x2451, 3, 0x00400 }, // $Q  CH_PEC
+  { 0x5353, 1, 0x00000 }, // SS  
+  { 0x55FF, 2, 0x00000 }, // U*  
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x544B, 2, 0x00001 }, // TK  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7233, 2, 0x02000 }, // r3  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4136, 1, 0x00010 }, // A6  CH_GOTO
+  { 0x4764, 0, 0x00010 }, // Gd  CH_GOTO
+  { 0x4772, 0, 0x00010 }, // Gr  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7232, 2, 0x02000 }, // r2  CH_ROTATOR
+  { 0x5246, 0, 0x00002 }, // RF  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4135, 1, 0x00010 }, // A5  CH_GOTO
+  { 0x4641, 1, 0x04000 }, // FA  CH_FOCUSER
+  { 0x6850, 1, 0x06020 }, // hP  CH_PARK CH_ROTATOR CH_FOCUSER
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4C21, 2, 0x00040 }, // L!  CH_LIBRARY
+  { 0x4139, 1, 0x00010 }, // A9  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6651, 2, 0x00000 }, // fQ  
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4755, 0, 0x00008 }, // GU  CH_STATUS
+  { 0x4757, 0, 0x00008 }, // GW  CH_STATUS
+  { 0x0000, 0, 0x00000 },
+  { 0x4D47, 0, 0x00002 }, // MG  CH_GUIDE
+  { 0x4774, 0, 0x00080 }, // Gt  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x4134, 1, 0x00010 }, // A4  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x4747, 0, 0x00080 }, // GG  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5350, 1, 0x00080 }, // SP  CH_SITE
+  { 0x5648, 0, 0x00400 }, // VH  CH_PEC
+  { 0x0000, 0, 0x00000 },
+  { 0x7263, 0, 0x02000 }, // rc  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x4C49, 0, 0x00040 }, // LI  CH_LIBRARY
+  { 0x0000, 0, 0x00000 },
+  { 0x5239, 2, 0x00002 }, // R9  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x516E, 2, 0x00002 }, // Qn  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x4133, 1, 0x00010 }, // A3  CH_GOTO
+  { 0x4761, 0, 0x00090 }, // Ga  CH_GOTO CH_SITE
+  { 0x7249, 0, 0x02000 }, // rI  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x5236, 2, 0x00002 }, // R6  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x534F, 1, 0x00080 }, // SO  CH_SITE
+  { 0x4C3F, 0, 0x00040 }, // L?  CH_LIBRARY
+  { 0x4137, 1, 0x00010 }, // A7  CH_GOTO
+  { 0x7262, 0, 0x02000 }, // rb  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5368, 1, 0x00100 }, // Sh  CH_LIMITS
+  { 0x544C, 2, 0x00001 }, // TL  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x4D77, 2, 0x00002 }, // Mw  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6668, 2, 0x00000 }, // fh  
+  { 0x4776, 0, 0x00080 }, // Gv  CH_SITE
+  { 0x4132, 1, 0x00010 }, // A2  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5231, 2, 0x00002 }, // R1  CH_GUIDE
+  { 0x6635, 3, 0x00000 }, // f5  
+  { 0x5432, 0, 0x00001 }, // T2  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5237, 2, 0x00002 }, // R7  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4670, 1, 0x04000 }, // Fp  CH_FOCUSER
+  { 0x4754, 0, 0x00001 }, // GT  CH_MOUNT
+  { 0x4D44, 1, 0x00010 }, // MD  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5464, 1, 0x00001 }, // Td  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x476D, 0, 0x00008 }, // Gm  CH_STATUS
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6634, 3, 0x00000 }, // f4  
+  { 0x5431, 0, 0x00001 }, // T1  CH_MOUNT
+  { 0x723E, 2, 0x02000 }, // r>  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6636, 3, 0x00000 }, // f6  
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5453, 2, 0x00001 }, // TS  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7246, 2, 0x02000 }, // rF  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6633, 3, 0x00000 }, // f3  
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5465, 1, 0x00001 }, // Te  CH_MOUNT
+  { 0x5235, 2, 0x00002 }, // R5  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4752, 0, 0x00001 }, // GR  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4C4C, 2, 0x00040 }, // LL  CH_LIBRARY
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6846, 2, 0x00200 }, // hF  CH_HOME
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x477A, 0, 0x00010 }, // Gz  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x4C44, 2, 0x00040 }, // LD  CH_LIBRARY
+  { 0x0000, 0, 0x00000 },
+  { 0x5234, 2, 0x00002 }, // R4  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x722B, 2, 0x02000 }, // r+  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x524D, 2, 0x00002 }, // RM  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7244, 0, 0x02000 }, // rD  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6631, 3, 0x00000 }, // f1  
+  { 0x0000, 0, 0x00000 },
+  { 0x422B, 2, 0x00000 }, // B+  
+  { 0x0000, 0, 0x00000 },
+  { 0x6632, 3, 0x00000 }, // f2  
+  { 0x0000, 0, 0x00000 },
+  { 0x4D73, 2, 0x00002 }, // Ms  CH_GUIDE
+  { 0x5233, 2, 0x00002 }, // R3  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x573F, 0, 0x00080 }, // W?  CH_SITE
+  { 0x4750, 0, 0x00080 }, // GP  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6663, 1, 0x00000 }, // fc  
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7235, 0, 0x02000 }, // r5  CH_ROTATOR
+  { 0x7243, 2, 0x02000 }, // rC  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x422D, 2, 0x00000 }, // B-  
+  { 0x0000, 0, 0x00000 },
+  { 0x4C42, 2, 0x00040 }, // LB  CH_LIBRARY
+  { 0x0000, 0, 0x00000 },
+  { 0x5232, 2, 0x00002 }, // R2  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x474F, 0, 0x00080 }, // GO  CH_SITE
+  { 0x4131, 1, 0x00010 }, // A1  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x4635, 3, 0x04000 }, // F5  CH_FOCUSER
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4768, 0, 0x00100 }, // Gh  CH_LIMITS
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6843, 2, 0x00200 }, // hC  CH_HOME
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4651, 2, 0x04000 }, // FQ  CH_FOCUSER
+  { 0x465A, 2, 0x04000 }, // FZ  CH_FOCUSER
+  { 0x0000, 0, 0x00000 },
+  { 0x6648, 2, 0x00000 }, // fH  
+  { 0x5361, 0, 0x00010 }, // Sa  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x474C, 0, 0x00080 }, // GL  CH_SITE
+  { 0x474E, 0, 0x00080 }, // GN  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6661, 1, 0x00000 }, // fa  
+  { 0x537A, 0, 0x00010 }, // Sz  CH_GOTO
+  { 0x5672, 0, 0x00400 }, // Vr  CH_PEC
+  { 0x0000, 0, 0x00000 },
+  { 0x4767, 0, 0x00080 }, // Gg  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5347, 1, 0x00080 }, // SG  CH_SITE
+  { 0x542B, 2, 0x00001 }, // T+  CH_MOUNT
+  { 0x4D67, 2, 0x00002 }, // Mg  CH_GUIDE
+  { 0x725A, 0, 0x02000 }, // rZ  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x4D70, 0, 0x00002 }, // Mp  CH_GUIDE
+  { 0x5100, 2, 0x00002 }, // Q   CH_GUIDE
+  { 0x5230, 2, 0x00002 }, // R0  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x474D, 0, 0x00080 }, // GM  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5165, 2, 0x00002 }, // Qe  CH_GUIDE
+  { 0x7252, 2, 0x02000 }, // rR  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x4636, 3, 0x04000 }, // F6  CH_FOCUSER
+  { 0x727E, 1, 0x00000 }, // r~  
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6841, 0, 0x00200 }, // hA  CH_HOME
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5173, 2, 0x00002 }, // Qs  CH_GUIDE
+  { 0x6646, 2, 0x00000 }, // fF  
+  { 0x0000, 0, 0x00000 },
+  { 0x5657, 0, 0x00400 }, // VW  CH_PEC
+  { 0x0000, 0, 0x00000 },
+  { 0x7272, 0, 0x02000 }, // rr  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x5752, 3, 0x00400 }, // WR  CH_PEC
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7231, 2, 0x02000 }, // r1  CH_ROTATOR
+  { 0x475A, 0, 0x00001 }, // GZ  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5345, 0, 0x00001 }, // SE  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x542D, 2, 0x00001 }, // T-  CH_MOUNT
+  { 0x4D6E, 2, 0x00002 }, // Mn  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x46FF, 0, 0x04000 }, // F*  CH_FOCUSER
+  { 0x0000, 0, 0x00000 },
+  { 0x4C57, 1, 0x00040 }, // LW  CH_LIBRARY
+  { 0x0000, 0, 0x00000 },
+  { 0x5247, 2, 0x00002 }, // RG  CH_GUIDE
+  { 0x5753, 1, 0x00000 }, // WS  
+  { 0x0000, 0, 0x00000 },
+  { 0x4634, 3, 0x04000 }, // F4  CH_FOCUSER
+  { 0x2542, 0, 0x00001 }, // %B  CH_MOUNT
+  { 0x4C24, 1, 0x00040 }, // L$  CH_LIBRARY
+  { 0x0000, 0, 0x00000 },
+  { 0x683F, 0, 0x00200 }, // h?  CH_HOME
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7257, 0, 0x02000 }, // rW  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4C6F, 1, 0x00040 }, // Lo  CH_LIBRARY
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5376, 0, 0x00080 }, // Sv  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4633, 3, 0x04000 }, // F3  CH_FOCUSER
+  { 0x4758, 3, 0x0FD97 }, // GX  CH_MOUNT CH_GUIDE CH_GPIO CH_GOTO CH_SITE CH_LIMITS CH_PEC CH_AXIS1 CH_AXIS2 CH_ROTATOR CH_FOCUSER CH_FEATURES
+  { 0x4D53, 1, 0x00010 }, // MS  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x5343, 1, 0x00080 }, // SC  CH_SITE
+  { 0x7234, 2, 0x02000 }, // r4  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5245, 2, 0x00002 }, // RE  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4632, 3, 0x04000 }, // F2  CH_FOCUSER
+  { 0x723C, 2, 0x02000 }, // r<  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x534D, 1, 0x00080 }, // SM  CH_SITE
+  { 0x5342, 1, 0x00000 }, // SB  
+  { 0x413F, 0, 0x00010 }, // A?  CH_GOTO
+  { 0x4353, 2, 0x00010 }, // CS  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x662B, 2, 0x00000 }, // f+  
+  { 0x0000, 0, 0x00000 },
+  { 0x5653, 0, 0x00400 }, // VS  CH_PEC
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5374, 1, 0x00080 }, // St  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x722D, 2, 0x02000 }, // r-  CH_ROTATOR
+  { 0x4631, 3, 0x04000 }, // F1  CH_FOCUSER
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7254, 0, 0x02000 }, // rT  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6641, 1, 0x00000 }, // fA  
+  { 0x5652, 0, 0x00400 }, // VR  CH_PEC
+  { 0x0000, 0, 0x00000 },
+  { 0x4663, 1, 0x04000 }, // Fc  CH_FOCUSER
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x665A, 2, 0x00000 }, // fZ  
+  { 0x5243, 2, 0x00002 }, // RC  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4646, 2, 0x04000 }, // FF  CH_FOCUSER
+  { 0x0000, 0, 0x00000 },
+  { 0x4D50, 1, 0x00010 }, // MP  CH_GOTO
+  { 0x4763, 0, 0x00080 }, // Gc  CH_SITE
+  { 0x7247, 0, 0x02000 }, // rG  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x476F, 0, 0x00100 }, // Go  CH_LIMITS
+  { 0x4753, 0, 0x00080 }, // GS  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5359, 1, 0x00000 }, // SY  
+  { 0x0000, 0, 0x00000 },
+  { 0x4668, 2, 0x04000 }, // Fh  CH_FOCUSER
+  { 0x0000, 0, 0x00000 },
+  { 0x4C52, 0, 0x00040 }, // LR  CH_LIBRARY
+  { 0x0000, 0, 0x00000 },
+  { 0x5372, 1, 0x00010 }, // Sr  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7239, 0, 0x02000 }, // r9  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5177, 2, 0x00002 }, // Qw  CH_GUIDE
+  { 0x546F, 0, 0x00001 }, // To  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x4C43, 2, 0x00040 }, // LC  CH_LIBRARY
+  { 0x4648, 2, 0x04000 }, // FH  CH_FOCUSER
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5358, 1, 0x0FD1D }, // SX  CH_MOUNT CH_GPIO CH_STATUS CH_GOTO CH_LIMITS CH_PEC CH_AXIS1 CH_AXIS2 CH_ROTATOR CH_FOCUSER CH_FEATURES
+  { 0x0000, 0, 0x00000 },
+  { 0x4661, 1, 0x04000 }, // Fa  CH_FOCUSER
+  { 0x0000, 0, 0x00000 },
+  { 0x412B, 1, 0x00010 }, // A+  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x5241, 2, 0x00002 }, // RA  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7238, 0, 0x02000 }, // r8  CH_ROTATOR
+  { 0x5238, 2, 0x00002 }, // R8  CH_GUIDE
+  { 0x4D4E, 1, 0x00010 }, // MN  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x546E, 1, 0x00001 }, // Tn  CH_MOUNT
+  { 0x7253, 1, 0x02000 }, // rS  CH_ROTATOR
+  { 0x7251, 2, 0x02000 }, // rQ  CH_ROTATOR
+  { 0x5732, 2, 0x00080 }, // W2  CH_SITE
+  { 0x4D41, 1, 0x00010 }, // MA  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5733, 2, 0x00080 }, // W3  CH_SITE
+  { 0x4400, 0, 0x00010 }, // D   CH_GOTO
+  { 0x4744, 0, 0x00001 }, // GD  CH_MOUNT
+  { 0x534E, 1, 0x00080 }, // SN  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x662D, 2, 0x00000 }, // f-  
+  { 0x0000, 0, 0x00000 },
+  { 0x462D, 2, 0x04000 }, // F-  CH_FOCUSER
+  { 0x7237, 0, 0x02000 }, // r7  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6670, 1, 0x00000 }, // fp  
+  { 0x2442, 0, 0x00001 }, // $B  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x7250, 2, 0x02000 }, // rP  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x6851, 1, 0x00020 }, // hQ  CH_PARK
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4743, 0, 0x00080 }, // GC  CH_SITE
+  { 0x5253, 2, 0x00002 }, // RS  CH_GUIDE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x536F, 1, 0x00100 }, // So  CH_LIMITS
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x7236, 0, 0x02000 }, // r6  CH_ROTATOR
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x434D, 0, 0x00010 }, // CM  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x4775, 0, 0x00008 }, // Gu  CH_STATUS
+  { 0x0000, 0, 0x00000 },
+  { 0x4D65, 2, 0x00002 }, // Me  CH_GUIDE
+  { 0x5355, 0, 0x00080 }, // SU  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x5731, 2, 0x00080 }, // W1  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x534C, 1, 0x00080 }, // SL  CH_SITE
+  { 0x4C4E, 2, 0x00040 }, // LN  CH_LIBRARY
+  { 0x0000, 0, 0x00000 },
+  { 0x5452, 2, 0x00001 }, // TR  CH_MOUNT
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x462B, 2, 0x04000 }, // F+  CH_FOCUSER
+  { 0x5367, 1, 0x00080 }, // Sg  CH_SITE
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x4138, 1, 0x00010 }, // A8  CH_GOTO
+  { 0x4157, 1, 0x00010 }, // AW  CH_GOTO
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x0000, 0, 0x00000 },
+  { 0x5472, 1, 0x00001 }, // Tr  CH_MOUNT
+  { 0x5354, 1, 0x00001 }, // ST  CH_MOUNT
+};
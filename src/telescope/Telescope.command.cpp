@@ -4,11 +4,14 @@
 #include "../Common.h"
 
 #include "Telescope.h"
+#include "CommandRoute.h"
 
 #include "../lib/tasks/OnTask.h"
 #include "../lib/gpioEx/GpioEx.h"
 #include "../lib/nv/Nv.h"
 #include "../lib/convert/Convert.h"
+#include "../lib/commands/ReplyCache.h"
+#include "../lib/commands/CmdLatency.h"
 
 #include "../libApp/commands/ProcessCmds.h"
 #include "../libApp/weather/Weather.h"
@@ -34,8 +37,44 @@
   HAL_RESET_FUNC;
 #endif
 
+// command() of one subsystem, false if it's not present or doesn't claim the command
+static bool subsystemCommand(uint8_t handler, char reply[], char command[], char parameter[], bool *supressFrame, bool *numericReply, CommandError *commandError) {
+  switch (handler) {
+  #ifdef MOUNT_PRESENT
+    case CH_MOUNT:    return mount.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    case CH_GUIDE:    return guide.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    #if GPIO_DEVICE != OFF
+      case CH_GPIO:   return gpio.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    #endif
+    case CH_STATUS:   return mountStatus.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    case CH_GOTO:     return goTo.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    case CH_PARK:     return park.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    case CH_LIBRARY:  return library.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    case CH_SITE:     return site.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    case CH_LIMITS:   return limits.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    case CH_HOME:     return home.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    case CH_PEC:      return pec.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    case CH_AXIS1:    return axis1.command(reply, command, parameter, supressFrame, numericReply, commandError);
+    case CH_AXIS2:    return axis2.command(reply, command, parameter, supressFrame, numericReply, commandError);
+  #endif
+  #ifdef ROTATOR_PRESENT
+    case CH_ROTATOR:  return rotator.command(reply, command, parameter, supressFrame, numericReply, commandError);
+  #endif
+  #ifdef FOCUSER_PRESENT
+    case CH_FOCUSER:  return focuser.command(reply, command, parameter, supressFrame, numericReply, commandError);
+  #endif
+  #ifdef FEATURES_PRESENT
+    case CH_FEATURES: return features.command(reply, command, parameter, supressFrame, numericReply, commandError);
+  #endif
+    default:          return false;
+  }
+}
+
 bool Telescope::command(char reply[], char command[], char parameter[], bool *supressFrame, bool *numericReply, CommandError *commandError) {
 
+  // anything but a get (focuser position included) can change what the polled get commands return
+  if (command[0] != 'G' && !(command[0] == 'F' && command[1] == 'G')) ReplyCache::invalidate();
+
   #if PLUGIN1 != OFF && PLUGIN1_COMMAND_PROCESSING == ON
     if (PLUGIN1.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
   #endif
@@ -61,35 +100,14 @@ bool Telescope::command(char reply[], char command[], char parameter[], bool *su
     if (PLUGIN8.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
   #endif
 
-  #ifdef MOUNT_PRESENT
-    if (mount.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    if (guide.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    #if GPIO_DEVICE != OFF
-      if (gpio.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    #endif
-    if (mountStatus.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    if (goTo.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    if (park.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    if (library.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    if (site.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    if (limits.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    if (home.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    if (pec.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    if (axis1.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-    if (axis2.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-  #endif
-
-  #ifdef ROTATOR_PRESENT
-    if (rotator.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-  #endif
-
-  #ifdef FOCUSER_PRESENT
-    if (focuser.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-  #endif
-
-  #ifdef FEATURES_PRESENT
-    if (features.command(reply, command, parameter, supressFrame, numericReply, commandError)) return true;
-  #endif
+  // only the subsystems that can claim this command, in cascade order
+  const CommandRoute *route = commandRoute(command[0], command[1]);
+  uint32_t handlers = route ? route->handlers : CH_ALL;
+  while (handlers) {
+    uint8_t handler = __builtin_ctzl(handlers);
+    handlers &= handlers - 1;
+    if (subsystemCommand(handler, reply, command, parameter, supressFrame, numericReply, commandError)) return true;
+  }
 
   //  B - Reticle/Accessory Control
   // :B+#       Increase reticle Brightness
@@ -195,6 +213,18 @@ bool Telescope::command(char reply[], char command[], char parameter[], bool *su
       *numericReply = false;
     } else
 
+    #if DEBUG_COMMAND_LATENCY == ON
+      // :GY#       Get the command channels with latency histograms
+      //            Returns: s# (a channel character each, A for SERIAL_A, L for SERIAL_LOCAL, etc.)
+      // :GY[c][s]# Get a latency histogram for channel c, s is w (wait), e (execute), r (reply write),
+      //            a command letter A to Z (execute for that command), or * for other commands
+      //            Returns: n,n,n...# (bucket counts in hex, bucket 0 is under 16us, bucket n from 2^(n+3)us)
+      if (command[1] == 'Y') {
+        if (!commandLatency.report(reply, parameter)) *commandError = CE_PARAM_FORM;
+        *numericReply = false;
+      } else
+    #endif
+
     if (command[1] == 'X' && parameter[2] == 0) {
       if (parameter[0] == '9') {
         // :GX9A#     temperature in deg. C
@@ -250,6 +280,14 @@ bool Telescope::command(char reply[], char command[], char parameter[], bool *su
     } else return false;
   } else
 
+  #if DEBUG_COMMAND_LATENCY == ON
+    // :SY#       Clear the command latency histograms
+    //            Returns: 1
+    if (command[0] == 'S' && command[1] == 'Y' && parameter[0] == 0) {
+      commandLatency.reset();
+    } else
+  #endif
+
   if (command[0] == 'S' && command[1] == 'X' && parameter[2] == ',') {
     if (parameter[0] == '9') {
       char *conv_end;
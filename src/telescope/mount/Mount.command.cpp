@@ -26,6 +26,7 @@ bool Mount::command(char *reply, char *command, char *parameter, bool *supressFr
     //            Returns: sDD*MM'SS.SSS# (high precision)
     if (command[1] == 'A' && (parameter[0] == 0 || parameter[1] == 0)) {
       if (parameter[0] == 'H') precisionMode = PM_HIGHEST; else if (parameter[0] != 0) { *commandError = CE_PARAM_FORM; return true; }
+      if (replyA.get(reply, precisionMode)) { *numericReply = false; return true; }
       double a = getPosition(CR_MOUNT_ALT).a;
       #if AXIS1_SECTOR_GEAR == OFF && AXIS2_TANGENT_ARM == OFF
         if (guide.state == GU_HOME_GUIDE || guide.state == GU_HOME_GUIDE_ABORT) {
@@ -34,6 +35,7 @@ bool Mount::command(char *reply, char *command, char *parameter, bool *supressFr
         }
       #endif
       convert.doubleToDms(reply, radToDeg(a), false, true, precisionMode);
+      replyA.set(reply, precisionMode);
       *numericReply = false;
     } else
 
@@ -42,6 +44,7 @@ bool Mount::command(char *reply, char *command, char *parameter, bool *supressFr
     // :GDH#      Returns: sDD*MM:SS.SSS# (high precision)
     if (command[1] == 'D' && (parameter[0] == 0 || parameter[1] == 0)) {
       if (parameter[0] == 'H' || parameter[0] == 'e') precisionMode = PM_HIGHEST; else if (parameter[0] != 0) { *commandError = CE_PARAM_FORM; return true; }
+      if (replyD.get(reply, precisionMode)) { *numericReply = false; return true; }
       double d = getPosition().d;
       #if AXIS1_SECTOR_GEAR == OFF && AXIS2_TANGENT_ARM == OFF
         if (guide.state == GU_HOME_GUIDE || guide.state == GU_HOME_GUIDE_ABORT) {
@@ -50,6 +53,7 @@ bool Mount::command(char *reply, char *command, char *parameter, bool *supressFr
         }
       #endif
       convert.doubleToDms(reply, radToDeg(d), false, true, precisionMode);
+      replyD.set(reply, precisionMode);
       *numericReply = false;
     } else
 
@@ -58,6 +62,7 @@ bool Mount::command(char *reply, char *command, char *parameter, bool *supressFr
     // :GRH#      Returns: HH:MM:SS.SSSS# (high precision)
     if (command[1] == 'R' && (parameter[0] == 0 || parameter[1] == 0)) {
       if (parameter[0] == 'H' || parameter[0] == 'a') precisionMode = PM_HIGHEST; else if (parameter[0] != 0) { *commandError = CE_PARAM_FORM; return true; }
+      if (replyR.get(reply, precisionMode)) { *numericReply = false; return true; }
       double r = getPosition().r;
       #if AXIS1_SECTOR_GEAR == OFF && AXIS2_TANGENT_ARM == OFF
         if (guide.state == GU_HOME_GUIDE || guide.state == GU_HOME_GUIDE_ABORT) {
@@ -66,6 +71,7 @@ bool Mount::command(char *reply, char *command, char *parameter, bool *supressFr
         }
       #endif
       convert.doubleToHms(reply, radToHrs(r), false, precisionMode);
+      replyR.set(reply, precisionMode);
       *numericReply = false;
     } else
 
@@ -158,6 +164,7 @@ bool Mount::command(char *reply, char *command, char *parameter, bool *supressFr
     //            Returns: DDD*MM'SS.SSS# (high precision)
     if (command[1] == 'Z' && (parameter[0] == 0 || parameter[1] == 0)) {
       if (parameter[0] == 'H') precisionMode = PM_HIGHEST; else if (parameter[0] != 0) { *commandError = CE_PARAM_FORM; return true; }
+      if (replyZ.get(reply, precisionMode)) { *numericReply = false; return true; }
       double z = getPosition(CR_MOUNT_HOR).z;
       #if AXIS1_SECTOR_GEAR == OFF && AXIS2_TANGENT_ARM == OFF
         if (guide.state == GU_HOME_GUIDE || guide.state == GU_HOME_GUIDE_ABORT) {
@@ -166,6 +173,7 @@ bool Mount::command(char *reply, char *command, char *parameter, bool *supressFr
         }
       #endif
       convert.doubleToDms(reply, NormalizeAzimuth(radToDeg(z)), true, false, precisionMode);
+      replyZ.set(reply, precisionMode);
       *numericReply = false;
     } else return false;
   } else
@@ -434,23 +442,10 @@ bool Mount::command(char *reply, char *command, char *parameter, bool *supressFr
     if (command[1] == '+') { site.setSiderealPeriod(site.getSiderealPeriod() - hzToSubMicros(0.02F)); } else
     if (command[1] == '-') { site.setSiderealPeriod(site.getSiderealPeriod() + hzToSubMicros(0.02F)); } else
     if (command[1] == 'R') { site.setSiderealPeriod(SIDEREAL_PERIOD); } else
-    if (command[1] == 'e') {
-      #if GOTO_FEATURE == ON
-        if (park.state != PS_PARKED) {
-      #endif
-      tracking(true);
-      #if GOTO_FEATURE == ON
-        } else *commandError = CE_PARKED;
-      #endif
-    } else
-    if (command[1] == 'd') {
-      tracking(false);
-    } else *commandError = CE_CMD_UNKNOWN;
+    if (command[1] == 'e') { *commandError = setTracking(true); } else
+    if (command[1] == 'd') { *commandError = setTracking(false); } else *commandError = CE_CMD_UNKNOWN;
 
-    if (!transform.isEquatorial()) {
-      if (settings.rc == RC_MODEL) settings.rc = RC_MODEL_DUAL;
-      if (settings.rc == RC_REFRACTION) settings.rc = RC_REFRACTION_DUAL;
-    }
+    dualAxisIfAltAz();
 
     if (*commandError == CE_NONE) {
       switch (command[1]) { case 'S': case 'K': case 'L': case 'Q': case '+': case '-': case 'R': *numericReply = false; }
@@ -227,6 +227,26 @@ void Mount::tracking(bool state) {
   update();
 }
 
+// enables or disables tracking as :Te# and :Td# do, refused while parked, the settings are saved
+CommandError Mount::setTracking(bool state) {
+  #if GOTO_FEATURE == ON
+    if (state && park.state == PS_PARKED) return CE_PARKED;
+  #endif
+  tracking(state);
+  dualAxisIfAltAz();
+  nv.updateBytes(NV_MOUNT_SETTINGS_BASE, &settings, sizeof(MountSettings));
+  update();
+  return CE_NONE;
+}
+
+// an alt-az mount compensates on both axes
+void Mount::dualAxisIfAltAz() {
+  if (!transform.isEquatorial()) {
+    if (settings.rc == RC_MODEL) settings.rc = RC_MODEL_DUAL;
+    if (settings.rc == RC_REFRACTION) settings.rc = RC_REFRACTION_DUAL;
+  }
+}
+
 // enables or disables power to the mount motors
 void Mount::enable(bool state) {
   if (state == true) {
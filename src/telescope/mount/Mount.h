@@ -7,6 +7,7 @@
 #ifdef MOUNT_PRESENT
 
 #include "../../lib/axis/Axis.h"
+#include "../../lib/commands/ReplyCache.h"
 #include "../../libApp/commands/ProcessCmds.h"
 #include "coordinates/Transform.h"
 #include "home/Home.h"
@@ -74,6 +75,9 @@ class Mount {
     // enables or disables tracking, enabling tracking powers on the motors if necessary
     void tracking(bool state);
 
+    // enables or disables tracking as :Te# and :Td# do, refused while parked, the settings are saved
+    CommandError setTracking(bool state);
+
     // returns true if the mount is tracking
     inline bool isTracking() { return trackingState == TS_SIDEREAL; }
 
@@ -106,6 +110,9 @@ class Mount {
     // alternate tracking rate calculation method
     float ztr(float a);
 
+    // an alt-az mount compensates on both axes
+    void dualAxisIfAltAz();
+
     // update where we are pointing *now*
     void updatePosition(CoordReturn coordReturn);
 
@@ -115,6 +122,9 @@ class Mount {
     Coordinate current;
 
     TrackingState trackingState = TS_NONE;
+
+    // last :GA# :GD# :GR# :GZ# replies
+    ReplyCache replyA, replyD, replyR, replyZ;
 };
 
 #ifdef AXIS1_STEP_DIR_PRESENT
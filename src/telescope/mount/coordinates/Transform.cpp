@@ -291,12 +291,21 @@ void Transform::horToAa(Coordinate *coord) {
   if (coord->aa1 > Deg180) coord->aa1 -= Deg360;
 }
 
-double Transform::trueRefrac(double altitude) {
+float Transform::refractionTPC() {
+  unsigned long t = millis();
+  if (tpcValid && (long)(t - tpcUpdated) < 1000) return tpc;
   float pressure = 1010.0F;
   float temperature = 10.0F;
   if (!isnan(weather.getPressure())) pressure = weather.getPressure();
   if (!isnan(weather.getTemperature())) temperature = weather.getTemperature();
-  float TPC = (pressure/1010.0F)*(283.0F/(273.0F + temperature));
+  tpc = (pressure/1010.0F)*(283.0F/(273.0F + temperature));
+  tpcUpdated = t;
+  tpcValid = true;
+  return tpc;
+}
+
+double Transform::trueRefrac(double altitude) {
+  float TPC = refractionTPC();
   float r   = 2.9670597e-4F*cotf(altitude + 0.0031375594F/(altitude + 0.089186324F))*TPC;
   if (r < 0.0F) r = 0.0F;
   return r;
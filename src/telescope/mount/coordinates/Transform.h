@@ -82,6 +82,9 @@ class Transform {
     // converts from equatorial (h,d) to AltAlt (aa1,aa2) coordinates
     void equToAa(Coordinate *coord) { equToHor(coord); horToAa(coord); };
 
+    // pressure and temperature scale factor for refraction, from weather readings taken at most once a second
+    float refractionTPC();
+
     // refraction at altitude, pressure (millibars), and temperature (celsius)
     // returns amount of refraction at the true altitude
     double trueRefrac(double altitude);
@@ -101,6 +104,10 @@ class Transform {
   private:
 
     float cotf(float n);
+
+    float tpc = 1.0F;
+    unsigned long tpcUpdated = 0;
+    bool tpcValid = false;
     
     // adjust coordinate back into 0 to 360 "degrees" range (in radians)
     double backInRads(double angle);
@@ -245,7 +245,7 @@ bool Goto::command(char *reply, char *command, char *parameter, bool *supressFra
     if (command[1] == 'A' && parameter[0] == 0) {
       transform.horToEqu(&gotoTarget);
       transform.hourAngleToRightAscension(&gotoTarget, true);
-      CommandError e = request(gotoTarget, settings.preferredPierSide);
+      CommandError e = requestGotoTarget();
       strcpy(reply,"0");
       if (e >= CE_SLEW_ERR_BELOW_HORIZON && e <= CE_SLEW_ERR_UNSPECIFIED) reply[0] = (char)(e - CE_SLEW_ERR_BELOW_HORIZON) + '1';
       if (e == CE_NONE) reply[0] = '0';
@@ -339,7 +339,7 @@ bool Goto::command(char *reply, char *command, char *parameter, bool *supressFra
     //              8=already in motion
     //              9=unspecified error
     if (command[1] == 'S' && parameter[0] == 0) {
-      CommandError e = request(gotoTarget, settings.preferredPierSide);
+      CommandError e = requestGotoTarget();
       strcpy(reply,"0");
       if (e >= CE_SLEW_ERR_BELOW_HORIZON && e <= CE_SLEW_ERR_UNSPECIFIED) reply[0] = (char)(e - CE_SLEW_ERR_BELOW_HORIZON) + '1';
       if (e == CE_NONE) reply[0] = '0';
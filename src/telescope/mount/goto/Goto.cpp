@@ -72,6 +72,11 @@ CommandError Goto::request() {
   return request(target, settings.preferredPierSide);
 }
 
+// goto the goto target (Native coordinate system) using the default preferredPierSide
+CommandError Goto::requestGotoTarget() {
+  return request(gotoTarget, settings.preferredPierSide);
+}
+
 #if GOTO_FEATURE == ON
 
 // goto equatorial position (Native or Mount coordinate system)
@@ -44,6 +44,9 @@ class Goto {
     // goto to equatorial target position (Native coordinate system) using the defaut preferredPierSide
     CommandError request();
 
+    // goto the goto target (Native coordinate system) using the default preferredPierSide
+    CommandError requestGotoTarget();
+
     // goto equatorial position (Native or Mount coordinate system)
     CommandError request(Coordinate coords, PierSideSelect pierSideSelect, bool native = true);
 
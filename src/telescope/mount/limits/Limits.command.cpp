@@ -55,12 +55,7 @@ bool Limits::command(char *reply, char *command, char *parameter, bool *supressF
     //                    1 on success
     if (command[1] == 'h') {
       int16_t deg;
-      if (convert.atoi2(parameter, &deg)) {
-        if (deg >= -30.0F && deg <= 30.0F) {
-          settings.altitude.min = degToRadF(deg);
-          nv.updateBytes(NV_MOUNT_LIMITS_BASE, &settings, sizeof(LimitSettings));
-        } else *commandError = CE_PARAM_RANGE;
-      } else *commandError = CE_PARAM_FORM;
+      if (convert.atoi2(parameter, &deg)) *commandError = setAltitudeMin(deg); else *commandError = CE_PARAM_FORM;
     } else
 
     //  :So[DD]#
@@ -69,12 +64,7 @@ bool Limits::command(char *reply, char *command, char *parameter, bool *supressF
     //                    1 on success
     if (command[1] == 'o') {
       int16_t deg;
-      if (convert.atoi2(parameter, &deg)) {
-        if (deg >= 60.0F && deg <= 90.0F) {
-          settings.altitude.max = degToRadF(deg);
-          nv.updateBytes(NV_MOUNT_LIMITS_BASE, &settings, sizeof(LimitSettings));
-        } else *commandError = CE_PARAM_RANGE;
-      } else *commandError = CE_PARAM_FORM;
+      if (convert.atoi2(parameter, &deg)) *commandError = setAltitudeMax(deg); else *commandError = CE_PARAM_FORM;
     } else
 
     //  :SXE9,[n]#
@@ -36,6 +36,22 @@ void Limits::init() {
   if (tasks.add(100, 0, true, 2, limitsWrapper, "MtLimit")) { VLF("success"); } else { VLF("FAILED!"); }
 }
 
+// set the horizon limit (-30 to 30 degrees) and save it
+CommandError Limits::setAltitudeMin(int16_t degs) {
+  if (degs < -30 || degs > 30) return CE_PARAM_RANGE;
+  settings.altitude.min = degToRadF(degs);
+  nv.updateBytes(NV_MOUNT_LIMITS_BASE, &settings, sizeof(LimitSettings));
+  return CE_NONE;
+}
+
+// set the overhead limit (60 to 90 degrees) and save it
+CommandError Limits::setAltitudeMax(int16_t degs) {
+  if (degs < 60 || degs > 90) return CE_PARAM_RANGE;
+  settings.altitude.max = degToRadF(degs);
+  nv.updateBytes(NV_MOUNT_LIMITS_BASE, &settings, sizeof(LimitSettings));
+  return CE_NONE;
+}
+
 // constrain meridian limits to the allowed range
 void Limits::constrainMeridianLimits() {
   if (settings.pastMeridianE > Deg360) {
@@ -50,6 +50,12 @@ class Limits {
 
     bool command(char *reply, char *command, char *parameter, bool *supressFrame, bool *numericReply, CommandError *commandError);
 
+    // set the horizon limit (-30 to 30 degrees) and save it
+    CommandError setAltitudeMin(int16_t degs);
+
+    // set the overhead limit (60 to 90 degrees) and save it
+    CommandError setAltitudeMax(int16_t degs);
+
     // constrain meridian limits to the allowed range
     void constrainMeridianLimits();
 
@@ -37,6 +37,8 @@ bool Status::command(char *reply, char *command, char *parameter, bool *supressF
     // :GU#       Get telescope Status
     //            Returns: s#
     if (command[1] == 'U' && parameter[0] == 0)  {
+      *numericReply = false;
+      if (replyU.get(reply)) return true;
       int i = 0;
       if (!mount.isTracking())                 reply[i++]='n';                     // [n]ot tracking
       if (goTo.state == GS_NONE)               reply[i++]='N';                     // [N]o goto
@@ -91,7 +93,7 @@ bool Status::command(char *reply, char *command, char *parameter, bool *supressF
       reply[i++]='0' + limits.errorCode();                                         // Provide general error code
       reply[i++]=0;
 
-      *numericReply = false;
+      replyU.set(reply);
     } else
 
     // :Gu#       Get bit packed telescope status
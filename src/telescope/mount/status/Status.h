@@ -6,6 +6,7 @@
 
 #ifdef MOUNT_PRESENT
 
+#include "../../../lib/commands/ReplyCache.h"
 #include "../../../libApp/commands/ProcessCmds.h"
 #include "../../../lib/sound/Sound.h"
 
@@ -36,6 +37,9 @@ class Status {
   private:
     uint8_t statusTaskHandle = 0;
     Sound sound;
+
+    // last :GU# reply
+    ReplyCache replyU;
 };
 
 extern Status mountStatus;